@@ -0,0 +1,100 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Arena.c
+ * \brief This is where all methods defined in src/Arena.h are implemented.
+ *
+ */
+#include "Arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+size_t arenaBlockBytes(size_t count, size_t size){
+    return (count * size + MATRIX_ALIGNMENT - 1) / MATRIX_ALIGNMENT * MATRIX_ALIGNMENT;
+}
+
+size_t arenaMatrixBytes(int rows, int cols){
+    return arenaBlockBytes((size_t)rows * matrixStride(cols), sizeof(Real));
+}
+
+static void* mapPages(size_t* bytes, int hugePages){
+#ifdef WIN32
+    return VirtualAlloc(NULL, *bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE); ///committed pages are only backed once first touched WIN32
+#else
+    void* ptr = MAP_FAILED; /*!< The mapped block*/
+#ifdef MAP_HUGETLB
+    if(hugePages == ReservedHugePages){ ///reserved huge pages must be mapped in whole pages
+        size_t rounded = (*bytes + ARENA_HUGE_PAGE_SIZE - 1) / ARENA_HUGE_PAGE_SIZE * ARENA_HUGE_PAGE_SIZE;
+        ptr = mmap(NULL, rounded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if(ptr != MAP_FAILED)
+            *bytes = rounded;
+    }
+#endif
+    if(ptr == MAP_FAILED) ///map regular pages, which are only backed once first touched POSIX
+        ptr = mmap(NULL, *bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if(ptr == MAP_FAILED)
+        return NULL;
+#ifdef MADV_HUGEPAGE
+    if(hugePages != NoHugePages)
+        madvise(ptr, *bytes, MADV_HUGEPAGE); ///only advice, so a system without transparent huge pages keeps regular pages
+#endif
+    return ptr;
+#endif
+}
+
+Arena createArena(size_t capacity, int hugePages){
+    Arena arena; /*!< Declare the arena to be returned*/
+    arena.mapped = capacity;
+    arena.base = mapPages(&arena.mapped, hugePages); ///the only allocation made for the buffers of a run
+    arena.capacity = capacity;
+    arena.used = 0;
+    if(!arena.base){ ///if the memory could not be allocated tell the user and exit failure
+        fprintf(stderr, "There was an issue allocating an arena of %zu bytes.\n", capacity);
+        exit(EXIT_FAILURE);
+    }
+    return arena;
+}
+
+void* arenaAlloc(Arena* arena, size_t count, size_t size){
+    size_t bytes = arenaBlockBytes(count, size); /*!< The space taken by the block, padded so the next one stays aligned*/
+    if(bytes > arena->capacity - arena->used){ ///if the arena is too small tell the user and exit failure
+        fprintf(stderr, "The arena of %zu bytes has no room for %zu more bytes.\n", arena->capacity, bytes);
+        exit(EXIT_FAILURE);
+    }
+    void* ptr = arena->base + arena->used; /*!< The block being handed out*/
+    arena->used += bytes;
+    memset(ptr, 0, bytes); ///the block may hold values from the previous experiment
+    return ptr;
+}
+
+Matrix arenaMatrix(Arena* arena, int rows, int cols){
+    Matrix matrix; /*!< Declare the matrix to be returned*/
+    matrix.rows = rows;
+    matrix.cols = cols;
+    matrix.stride = matrixStride(cols);
+    matrix.data = arenaAlloc(arena, (size_t)rows * matrix.stride, sizeof(Real)); ///every row in a single block, padding included
+    return matrix;
+}
+
+void resetArena(Arena* arena){
+    arena->used = 0;
+}
+
+void releaseArena(Arena* arena){
+#ifdef WIN32
+    VirtualFree(arena->base, 0, MEM_RELEASE); ///unmap the block WIN32
+#else
+    munmap(arena->base, arena->mapped); ///unmap the block POSIX
+#endif
+    arena->base = NULL;
+    arena->mapped = 0;
+    arena->capacity = 0;
+    arena->used = 0;
+}
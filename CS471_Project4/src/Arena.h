@@ -0,0 +1,91 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Arena.h
+ * \brief This is where the arena every buffer of a single run is allocated from is defined.
+ *
+ *  An arena is a single aligned block which hands out memory by bumping an offset. Each tested dimension owns one, sized
+ *  up front by runArenaBytes in src/Utilities.h, which is reset before every experiment instead of freeing the buffers
+ *  one at a time, so the iterations of a run never touch the heap.
+ *
+ *  The block is mapped straight from the system and left untouched, so every page is placed on the memory node of the
+ *  thread which first writes it. That is the worker of the run, which zeroes each block in arenaAlloc, and with the
+ *  'Thread Affinity' line it is pinned to the same CPU for every experiment of its dimension.
+ */
+#ifndef TESTINGSUITE_ARENA_H
+#define TESTINGSUITE_ARENA_H
+
+#include "Matrix.h"
+
+#define ARENA_HUGE_PAGE_SIZE (2 * 1024 * 1024) /*!< declare the constant for the size of a reserved huge page the arena is rounded up to*/
+
+/*!
+ * enum representing how the arena of every run is backed by pages, selected in the init file
+ */
+enum HugePageMode{
+    NoHugePages, /*!< The arena is backed by regular pages*/
+    TransparentHugePages, /*!< The arena is advised to be backed by transparent huge pages where the system supports them*/
+    ReservedHugePages /*!< The arena is backed by reserved huge pages, falling back to transparent huge pages if none are free*/
+};
+
+/*!
+ * A block of memory handed out front to back. Every allocation starts on a MATRIX_ALIGNMENT boundary.
+ */
+typedef struct _Arena{
+    unsigned char* base;
+    size_t capacity;
+    size_t used;
+    size_t mapped;
+}Arena;
+
+/// \fn size_t arenaBlockBytes(size_t count, size_t size)
+/// \brief Calculates how much of an arena an allocation takes once it is padded to the alignment.
+///
+/// \param count - the number of elements to allocate
+/// \param size - the size of a single element
+/// \return count * size rounded up to a multiple of MATRIX_ALIGNMENT
+size_t arenaBlockBytes(size_t count, size_t size);
+/// \fn size_t arenaMatrixBytes(int rows, int cols)
+/// \brief Calculates how much of an arena a matrix takes.
+///
+/// \param rows - the number of rows of the matrix
+/// \param cols - the number of columns of the matrix
+/// \return the size of the matrix with the padding of every row
+size_t arenaMatrixBytes(int rows, int cols);
+/// \fn Arena createArena(size_t capacity, int hugePages)
+/// \brief Maps the block of an arena with a single call without touching it. Exits failure if it cannot be mapped.
+///
+/// \param capacity - the number of bytes the arena can hand out
+/// \param hugePages - the HugePageMode enum value selecting the pages backing the block
+/// \return the empty arena
+Arena createArena(size_t capacity, int hugePages);
+/// \fn void* arenaAlloc(Arena* arena, size_t count, size_t size)
+/// \brief Hands out the next zeroed and aligned block of the arena. Exits failure if the arena is too small, since that
+/// means runArenaBytes does not account for a buffer.
+///
+/// \param arena - the arena to allocate from
+/// \param count - the number of elements to allocate
+/// \param size - the size of a single element
+/// \return the zeroed memory, valid until the arena is reset
+void* arenaAlloc(Arena* arena, size_t count, size_t size);
+/// \fn Matrix arenaMatrix(Arena* arena, int rows, int cols)
+/// \brief The arena version of allocateEmptyMatrix in src/Matrix.h.
+///
+/// \param arena - the arena to allocate from
+/// \param rows - The number of rows to be allocated
+/// \param cols - The number of columns to be allocated per row
+/// \return returns an empty matrix with every value set to 0, which must not be passed to releaseMatrix
+Matrix arenaMatrix(Arena* arena, int rows, int cols);
+/// \fn void resetArena(Arena* arena)
+/// \brief Releases everything allocated from the arena at once so it can be reused by the next experiment.
+///
+/// \param arena - the arena to reset
+void resetArena(Arena* arena);
+/// \fn void releaseArena(Arena* arena)
+/// \brief Frees the block of the arena.
+///
+/// \param arena - the arena to be freed
+void releaseArena(Arena* arena);
+
+#endif //TESTINGSUITE_ARENA_H
@@ -0,0 +1,151 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file BulkRandom.c
+ * \brief This is where all methods defined in src/BulkRandom.h are implemented.
+ *
+ *  The raw 64-bit outputs are produced one block of BULK_RAND_LANES values at a time by a scalar, AVX2 or AVX-512
+ *  step function, then converted to doubles or bounded integers a chunk at a time.
+ */
+#include "BulkRandom.h"
+#include "CpuFeatures.h"
+#include <string.h>
+
+/*!
+ * The function signature shared by the block generators. Generates numBlocks blocks of BULK_RAND_LANES raw values.
+ */
+typedef void (*BulkRandBlocks)(BulkRandState*, uint64_t*, int);
+
+static uint64_t splitMix64(uint64_t* x){
+    uint64_t z = (*x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+void seedBulkRand(BulkRandState* state, uint64_t seed){
+    /*!
+     * Fill the state lane by lane so that each lane is an independently seeded xoshiro256+ stream.
+     */
+    for(int l = 0; l < BULK_RAND_LANES; l++){
+        for(int w = 0; w < BULK_RAND_WORDS; w++){
+            state->s[w][l] = splitMix64(&seed);
+        }
+    }
+}
+
+static void bulkBlocksScalar(BulkRandState* st, uint64_t* out, int numBlocks){
+    for(int b = 0; b < numBlocks; b++){
+        for(int l = 0; l < BULK_RAND_LANES; l++){
+            uint64_t s0 = st->s[0][l], s1 = st->s[1][l], s2 = st->s[2][l], s3 = st->s[3][l];
+            uint64_t t = s1 << 17;
+            out[b * BULK_RAND_LANES + l] = s0 + s3;
+            s2 ^= s0;
+            s3 ^= s1;
+            s1 ^= s2;
+            s0 ^= s3;
+            s2 ^= t;
+            s3 = (s3 << 45) | (s3 >> 19);
+            st->s[0][l] = s0; st->s[1][l] = s1; st->s[2][l] = s2; st->s[3][l] = s3;
+        }
+    }
+}
+
+#ifdef SIMD_X86
+TARGET_AVX2 static void bulkBlocksAVX2(BulkRandState* st, uint64_t* out, int numBlocks){
+    /*!
+     * The eight lanes are held as two halves of four lanes, each in its own set of registers.
+     */
+    __m256i s0a = _mm256_loadu_si256((const __m256i*)&st->s[0][0]), s0b = _mm256_loadu_si256((const __m256i*)&st->s[0][4]),
+            s1a = _mm256_loadu_si256((const __m256i*)&st->s[1][0]), s1b = _mm256_loadu_si256((const __m256i*)&st->s[1][4]),
+            s2a = _mm256_loadu_si256((const __m256i*)&st->s[2][0]), s2b = _mm256_loadu_si256((const __m256i*)&st->s[2][4]),
+            s3a = _mm256_loadu_si256((const __m256i*)&st->s[3][0]), s3b = _mm256_loadu_si256((const __m256i*)&st->s[3][4]);
+    for(int b = 0; b < numBlocks; b++){
+        __m256i ta = _mm256_slli_epi64(s1a, 17), tb = _mm256_slli_epi64(s1b, 17);
+        _mm256_storeu_si256((__m256i*)&out[b * BULK_RAND_LANES], _mm256_add_epi64(s0a, s3a));
+        _mm256_storeu_si256((__m256i*)&out[b * BULK_RAND_LANES + 4], _mm256_add_epi64(s0b, s3b));
+        s2a = _mm256_xor_si256(s2a, s0a); s2b = _mm256_xor_si256(s2b, s0b);
+        s3a = _mm256_xor_si256(s3a, s1a); s3b = _mm256_xor_si256(s3b, s1b);
+        s1a = _mm256_xor_si256(s1a, s2a); s1b = _mm256_xor_si256(s1b, s2b);
+        s0a = _mm256_xor_si256(s0a, s3a); s0b = _mm256_xor_si256(s0b, s3b);
+        s2a = _mm256_xor_si256(s2a, ta); s2b = _mm256_xor_si256(s2b, tb);
+        s3a = _mm256_or_si256(_mm256_slli_epi64(s3a, 45), _mm256_srli_epi64(s3a, 19));
+        s3b = _mm256_or_si256(_mm256_slli_epi64(s3b, 45), _mm256_srli_epi64(s3b, 19));
+    }
+    _mm256_storeu_si256((__m256i*)&st->s[0][0], s0a); _mm256_storeu_si256((__m256i*)&st->s[0][4], s0b);
+    _mm256_storeu_si256((__m256i*)&st->s[1][0], s1a); _mm256_storeu_si256((__m256i*)&st->s[1][4], s1b);
+    _mm256_storeu_si256((__m256i*)&st->s[2][0], s2a); _mm256_storeu_si256((__m256i*)&st->s[2][4], s2b);
+    _mm256_storeu_si256((__m256i*)&st->s[3][0], s3a); _mm256_storeu_si256((__m256i*)&st->s[3][4], s3b);
+}
+
+TARGET_AVX512 static void bulkBlocksAVX512(BulkRandState* st, uint64_t* out, int numBlocks){
+    __m512i s0 = _mm512_loadu_si512((const void*)st->s[0]),
+            s1 = _mm512_loadu_si512((const void*)st->s[1]),
+            s2 = _mm512_loadu_si512((const void*)st->s[2]),
+            s3 = _mm512_loadu_si512((const void*)st->s[3]);
+    for(int b = 0; b < numBlocks; b++){
+        __m512i t = _mm512_slli_epi64(s1, 17);
+        _mm512_storeu_si512((void*)&out[b * BULK_RAND_LANES], _mm512_add_epi64(s0, s3));
+        s2 = _mm512_xor_si512(s2, s0);
+        s3 = _mm512_xor_si512(s3, s1);
+        s1 = _mm512_xor_si512(s1, s2);
+        s0 = _mm512_xor_si512(s0, s3);
+        s2 = _mm512_xor_si512(s2, t);
+        s3 = _mm512_rol_epi64(s3, 45);
+    }
+    _mm512_storeu_si512((void*)st->s[0], s0);
+    _mm512_storeu_si512((void*)st->s[1], s1);
+    _mm512_storeu_si512((void*)st->s[2], s2);
+    _mm512_storeu_si512((void*)st->s[3], s3);
+}
+#endif
+
+/*!
+ * Selects the widest block generator the processor supports.
+ */
+static BulkRandBlocks selectBlocks(){
+#ifdef SIMD_X86
+    int level = detectSimdLevel();
+    if(level >= SimdAVX512)
+        return &bulkBlocksAVX512;
+    if(level >= SimdAVX2)
+        return &bulkBlocksAVX2;
+#endif
+    return &bulkBlocksScalar;
+}
+
+void bulkRandDoubles(BulkRandState* state, double* out, int count, double min, double max){
+    uint64_t raw[BULK_RAND_CHUNK]; /*!< Declare the buffer storing a chunk of raw values*/
+    BulkRandBlocks blocks = selectBlocks(); /*!< Select the block generator for this processor*/
+    double span = max - min; /*!< Store the width of the range locally*/
+    /*!
+     * Generate the raw values a chunk at a time, rounding up to whole blocks. The top 52 bits of each value are placed
+     * in the mantissa of a double in [1, 2) which is shifted down to [0, 1) and scaled into the range.
+     */
+    for(int done = 0; done < count; done += BULK_RAND_CHUNK){
+        int n = count - done < BULK_RAND_CHUNK ? count - done : BULK_RAND_CHUNK;
+        blocks(state, raw, (n + BULK_RAND_LANES - 1) / BULK_RAND_LANES);
+        for(int i = 0; i < n; i++){
+            uint64_t bits = (raw[i] >> 12) | 0x3FF0000000000000ULL;
+            double unit;
+            memcpy(&unit, &bits, sizeof(unit));
+            out[done + i] = min + span * (unit - 1.0);
+        }
+    }
+}
+
+void bulkRandInts(BulkRandState* state, int* out, int count, int max){
+    uint64_t raw[BULK_RAND_CHUNK]; /*!< Declare the buffer storing a chunk of raw values*/
+    BulkRandBlocks blocks = selectBlocks(); /*!< Select the block generator for this processor*/
+    /*!
+     * Generate the raw values a chunk at a time and map the top 32 bits of each into [0, max) with a multiply and shift.
+     */
+    for(int done = 0; done < count; done += BULK_RAND_CHUNK){
+        int n = count - done < BULK_RAND_CHUNK ? count - done : BULK_RAND_CHUNK;
+        blocks(state, raw, (n + BULK_RAND_LANES - 1) / BULK_RAND_LANES);
+        for(int i = 0; i < n; i++){
+            out[done + i] = (int)(((raw[i] >> 32) * (uint64_t)max) >> 32);
+        }
+    }
+}
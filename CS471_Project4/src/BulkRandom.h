@@ -0,0 +1,53 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file BulkRandom.h
+ * \brief This is where the bulk random number generator used to fill whole arrays of random values is defined.
+ *
+ *  The generator runs BULK_RAND_LANES interleaved xoshiro256+ streams side by side so that a full block of outputs is
+ *  produced per step with AVX2 or AVX-512 instructions when the processor supports them. Every path produces the
+ *  same sequence, so the results do not depend on the processor the program runs on.
+ */
+#ifndef TESTINGSUITE_BULKRANDOM_H
+#define TESTINGSUITE_BULKRANDOM_H
+
+#include <stdint.h>
+
+#define BULK_RAND_LANES 8 /*!< declare the constant for the number of interleaved streams in the bulk generator*/
+#define BULK_RAND_WORDS 4 /*!< declare the constant for the number of state words per stream*/
+#define BULK_RAND_CHUNK 256 /*!< declare the constant for the number of raw values generated per chunk when filling arrays*/
+
+/*!
+ * Stores the state of the interleaved streams with the word index outermost so a word of every lane can be loaded
+ * into a single vector register.
+ */
+typedef struct _BulkRandState{
+    uint64_t s[BULK_RAND_WORDS][BULK_RAND_LANES];
+}BulkRandState;
+
+/// \fn void seedBulkRand(BulkRandState* state, uint64_t seed)
+/// \brief Seeds every lane of the bulk generator from a single 64-bit seed using splitmix64.
+///
+/// \param state - the BulkRandState struct to be seeded
+/// \param seed - the seed for the generator
+void seedBulkRand(BulkRandState* state, uint64_t seed);
+/// \fn void bulkRandDoubles(BulkRandState* state, double* out, int count, double min, double max)
+/// \brief Fills an array with random doubles in the range [min, max).
+///
+/// \param state - the generator to draw from
+/// \param out - the array to be filled
+/// \param count - the number of values to fill
+/// \param min - the minimum value in the range
+/// \param max - the maximum value in the range
+void bulkRandDoubles(BulkRandState* state, double* out, int count, double min, double max);
+/// \fn void bulkRandInts(BulkRandState* state, int* out, int count, int max)
+/// \brief Fills an array with random non-negative integers in the range [0, max) using a multiply and shift rather than a division.
+///
+/// \param state - the generator to draw from
+/// \param out - the array to be filled
+/// \param count - the number of values to fill
+/// \param max - the exclusive upper bound of the values
+void bulkRandInts(BulkRandState* state, int* out, int count, int max);
+
+#endif //TESTINGSUITE_BULKRANDOM_H
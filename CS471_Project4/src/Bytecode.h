@@ -0,0 +1,110 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Bytecode.h
+ * \brief This is where the register bytecode the objective formulas of src/Formulas.h are compiled to is defined.
+ *
+ *  A program is a list of operations on registers, each register holding FORMULA_BLOCK lanes. The lanes are the terms
+ *  of a sum when a single vector is evaluated, or the vectors of a batch, so every operation runs over a whole block
+ *  and the cost of decoding it is shared by all of its lanes. The first registers hold the inputs of every lane, the
+ *  constants of a program are held in registers filled once before it runs, and the rest are temporaries.
+ *
+ *  formulaScalarOp is the reference every runner follows. src/Formulas.c runs programs with it one lane at a time, and
+ *  src/SimdKernels.h runs them VEC_WIDTH lanes at a time with the vectorized functions of the objective kernels.
+ */
+#ifndef TESTINGSUITE_BYTECODE_H
+#define TESTINGSUITE_BYTECODE_H
+
+#include <math.h>
+
+#define FORMULA_BLOCK 64 /*!< declare the constant for the number of lanes of every register*/
+#define FORMULA_LANE_GROUP 8 /*!< declare the constant for the widest VEC_WIDTH, the lanes are filled in whole groups of it*/
+#define FORMULA_MAX_REGISTERS 32 /*!< declare the constant for the most registers a program uses*/
+#define FORMULA_MAX_OPS 256 /*!< declare the constant for the most operations in a program*/
+#define FORMULA_MAX_SUMS 8 /*!< declare the constant for the most sums and products in a formula*/
+
+/*!
+ * The registers holding the inputs of every lane.
+ */
+enum FormulaInput{
+    ElementRegister, /*!< x[i]*/
+    NextRegister, /*!< x[i+1], for the sums over neighbouring pairs*/
+    IndexRegister, /*!< i, starting at 0*/
+    SizeRegister, /*!< n, the number of dimensions*/
+    FirstFreeRegister /*!< The first register holding a constant or a temporary*/
+};
+
+/*!
+ * The operations of the bytecode. The unary operations only read their left register.
+ */
+enum FormulaCode{
+    FormulaAdd,
+    FormulaSub,
+    FormulaMul,
+    FormulaDiv,
+    FormulaPow,
+    FormulaNeg,
+    FormulaSqrt,
+    FormulaAbs,
+    FormulaSin,
+    FormulaCos,
+    FormulaExp,
+    FormulaLog
+};
+
+/*!
+ * A single operation, storing the result of code applied to the left and right registers into the dest register.
+ */
+typedef struct _FormulaOp{
+    unsigned char code;
+    unsigned char dest;
+    unsigned char left;
+    unsigned char right;
+}FormulaOp;
+
+/*!
+ * A compiled program, either the term of a sum or product, or the expression combining the sums of a formula.
+ */
+typedef struct _FormulaProgram{
+    FormulaOp ops[FORMULA_MAX_OPS];
+    int numOps;
+    double constants[FORMULA_MAX_REGISTERS]; /*!< The value of every constant*/
+    unsigned char constantRegisters[FORMULA_MAX_REGISTERS]; /*!< The register every constant is held in*/
+    int numConstants;
+    int result; /*!< The register holding the result of the program*/
+    int pairs; /*!< Whether the term reads x[i+1], so the sum runs over the neighbouring pairs*/
+    int product; /*!< Whether the terms are multiplied instead of added*/
+}FormulaProgram;
+
+/*!
+ * The signature of the functions running a program over the first count lanes of the registers. When accumulator is
+ * given, the result of every lane is added to, or for a product multiplied into, the same lane of it.
+ */
+typedef void (*FormulaRunner)(const FormulaProgram* program, double (*registers)[FORMULA_BLOCK], int count, double* accumulator);
+
+/// \fn double formulaScalarOp(int code, double left, double right)
+/// \brief Applies an operation to a single lane, with the functions of the C library.
+///
+/// \param code - the FormulaCode of the operation
+/// \param left - the value of the left register
+/// \param right - the value of the right register, ignored by the unary operations
+/// \return the result of the operation
+static inline double formulaScalarOp(int code, double left, double right){
+    switch(code){
+        case FormulaAdd: return left + right;
+        case FormulaSub: return left - right;
+        case FormulaMul: return left * right;
+        case FormulaDiv: return left / right;
+        case FormulaPow: return pow(left, right);
+        case FormulaNeg: return -left;
+        case FormulaSqrt: return sqrt(left);
+        case FormulaAbs: return fabs(left);
+        case FormulaSin: return sin(left);
+        case FormulaCos: return cos(left);
+        case FormulaExp: return exp(left);
+        default: return log(left);
+    }
+}
+
+#endif //TESTINGSUITE_BYTECODE_H
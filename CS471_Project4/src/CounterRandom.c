@@ -0,0 +1,81 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file CounterRandom.c
+ * \brief This is where all methods defined in src/CounterRandom.h are implemented.
+ *
+ *  Philox4x32-10 as described by Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3" (SC11).
+ */
+#include "CounterRandom.h"
+#include <string.h>
+
+#define PHILOX_M0 0xD2511F53U /*!< declare the constant for the first Philox multiplier*/
+#define PHILOX_M1 0xCD9E8D57U /*!< declare the constant for the second Philox multiplier*/
+#define PHILOX_W0 0x9E3779B9U /*!< declare the constant for the first Philox key increment*/
+#define PHILOX_W1 0xBB67AE85U /*!< declare the constant for the second Philox key increment*/
+
+static uint64_t mix64(uint64_t z){
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+CounterKey makeCounterKey(uint64_t cellSeed){
+    CounterKey key; /*!< Declare the key to be returned*/
+    uint64_t h = mix64(cellSeed + 0x9e3779b97f4a7c15ULL); /*!< Scramble the seed so nearby seeds get unrelated keys*/
+    key.k[0] = (uint32_t)h;
+    key.k[1] = (uint32_t)(h >> 32);
+    return key;
+}
+
+void philox4x32(const CounterKey* key, const uint32_t ctr[4], uint32_t out[4]){
+    uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3], /*!< Store the counter words locally*/
+    k0 = key->k[0], k1 = key->k[1]; /*!< Store the key words locally, they are bumped every round*/
+    for(int r = 0; r < PHILOX_ROUNDS; r++){
+        uint64_t p0 = (uint64_t)PHILOX_M0 * c0, /*!< The full product of the first multiplier*/
+        p1 = (uint64_t)PHILOX_M1 * c2; /*!< The full product of the second multiplier*/
+        c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+        c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+        c1 = (uint32_t)p1;
+        c3 = (uint32_t)p0;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+    out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+
+void counterRandDoubles(const CounterKey* key, uint32_t iteration, uint32_t particle, uint32_t stream, double* out, int count, double min, double max){
+    uint32_t ctr[4] = {0, particle, iteration, stream}, /*!< The counter, the first word is the block position*/
+    words[4]; /*!< The random words of the current block*/
+    double span = max - min; /*!< Store the width of the range locally*/
+    /*!
+     * Each block of four words provides two values. The top 52 bits of each pair of words are placed in the mantissa
+     * of a double in [1, 2) which is shifted down to [0, 1) and scaled into the range.
+     */
+    for(int i = 0; i < count; i += 2){
+        ctr[0] = (uint32_t)(i / 2);
+        philox4x32(key, ctr, words);
+        for(int w = 0; w < 2 && i + w < count; w++){
+            uint64_t bits = ((((uint64_t)words[2 * w] << 32) | words[2 * w + 1]) >> 12) | 0x3FF0000000000000ULL;
+            double unit;
+            memcpy(&unit, &bits, sizeof(unit));
+            out[i + w] = min + span * (unit - 1.0);
+        }
+    }
+}
+
+void counterRandInts(const CounterKey* key, uint32_t iteration, uint32_t particle, uint32_t stream, int* out, int count, int max){
+    uint32_t ctr[4] = {0, particle, iteration, stream}, /*!< The counter, the first word is the block position*/
+    words[4]; /*!< The random words of the current block*/
+    /*!
+     * Each block of four words provides four values, each mapped into [0, max) with a multiply and shift.
+     */
+    for(int i = 0; i < count; i += 4){
+        ctr[0] = (uint32_t)(i / 4);
+        philox4x32(key, ctr, words);
+        for(int w = 0; w < 4 && i + w < count; w++){
+            out[i + w] = (int)(((uint64_t)words[w] * (uint64_t)max) >> 32);
+        }
+    }
+}
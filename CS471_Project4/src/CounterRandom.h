@@ -0,0 +1,67 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file CounterRandom.h
+ * \brief This is where the counter based random number generator used for order independent random draws is defined.
+ *
+ *  Every value is computed with the Philox4x32-10 block cipher from a key and a counter, and keeps no state between
+ *  calls. The key is derived from the seed of a single run (see deriveCellSeed in src/MersenneMatrix.h), and the
+ *  counter holds the iteration, the particle, the purpose of the draw and the position of the value. Any thread can
+ *  therefore compute the random values for any particle without sharing a generator, and the values do not depend on
+ *  the order the particles are processed in.
+ */
+#ifndef TESTINGSUITE_COUNTERRANDOM_H
+#define TESTINGSUITE_COUNTERRANDOM_H
+
+#include <stdint.h>
+
+#define PHILOX_ROUNDS 10 /*!< declare the constant for the number of Philox rounds*/
+#define COUNTER_PURPOSE_SHIFT 24 /*!< declare the constant for the bit position of the purpose within the last counter word*/
+
+/*!
+ * The key of the Philox generator, identifying a single run.
+ */
+typedef struct _CounterKey{
+    uint32_t k[2];
+}CounterKey;
+
+/// \fn CounterKey makeCounterKey(uint64_t cellSeed)
+/// \brief Derives the key for a single run from the seed of the run.
+///
+/// \param cellSeed - the seed of the run
+/// \return the key for the run
+CounterKey makeCounterKey(uint64_t cellSeed);
+/// \fn void philox4x32(const CounterKey* key, const uint32_t ctr[4], uint32_t out[4])
+/// \brief Computes the four random words for a single counter.
+///
+/// \param key - the key of the run
+/// \param ctr - the counter to encrypt
+/// \param out - the array receiving the four random words
+void philox4x32(const CounterKey* key, const uint32_t ctr[4], uint32_t out[4]);
+/// \fn void counterRandDoubles(const CounterKey* key, uint32_t iteration, uint32_t particle, uint32_t stream, double* out, int count, double min, double max)
+/// \brief Fills an array with the random doubles in [min, max) found at the given address. The value at position i of the
+/// array only depends on the key, the address and i.
+///
+/// \param key - the key of the run
+/// \param iteration - the iteration the values are drawn for
+/// \param particle - the particle the values are drawn for
+/// \param stream - the purpose and partner of the draw, combined by the caller
+/// \param out - the array to be filled
+/// \param count - the number of values to be filled
+/// \param min - the minimum value in the range
+/// \param max - the maximum value in the range
+void counterRandDoubles(const CounterKey* key, uint32_t iteration, uint32_t particle, uint32_t stream, double* out, int count, double min, double max);
+/// \fn void counterRandInts(const CounterKey* key, uint32_t iteration, uint32_t particle, uint32_t stream, int* out, int count, int max)
+/// \brief Fills an array with the random non-negative integers in [0, max) found at the given address.
+///
+/// \param key - the key of the run
+/// \param iteration - the iteration the values are drawn for
+/// \param particle - the particle the values are drawn for
+/// \param stream - the purpose and partner of the draw, combined by the caller
+/// \param out - the array to be filled
+/// \param count - the number of values to be filled
+/// \param max - the exclusive upper bound of the values
+void counterRandInts(const CounterKey* key, uint32_t iteration, uint32_t particle, uint32_t stream, int* out, int count, int max);
+
+#endif //TESTINGSUITE_COUNTERRANDOM_H
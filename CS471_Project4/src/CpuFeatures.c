@@ -0,0 +1,48 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file CpuFeatures.c
+ * \brief This is where the method defined in src/CpuFeatures.h is implemented.
+ *
+ */
+#include "CpuFeatures.h"
+#if defined(SIMD_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+static int simdLevel = -1; /*!< The cached result of the detection, -1 until it has been detected*/
+
+int detectSimdLevel(){
+    if(simdLevel >= 0){ ///already detected, return the cached level
+        return simdLevel;
+    }
+    int level = SimdScalar; /*!< Start at the scalar level and raise it for each supported instruction set*/
+#if defined(SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("sse2"))
+        level = SimdSSE2;
+    if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        level = SimdAVX2;
+    if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+        level = SimdAVX512;
+#elif defined(SIMD_X86) && defined(_MSC_VER)
+    int regs[4]; /*!< The eax, ebx, ecx and edx registers returned by CPUID*/
+    __cpuid(regs, 1);
+    if(regs[3] & (1 << 26))
+        level = SimdSSE2;
+    /*!
+     * AVX state has to be enabled by the operating system (OSXSAVE and XCR0) before the wider levels can be used.
+     */
+    if((regs[2] & (1 << 27)) && (regs[2] & (1 << 12))){
+        unsigned long long xcr0 = _xgetbv(0);
+        __cpuidex(regs, 7, 0);
+        if((xcr0 & 0x6) == 0x6 && (regs[1] & (1 << 5)))
+            level = SimdAVX2;
+        if((xcr0 & 0xE6) == 0xE6 && (regs[1] & (1 << 16)) && (regs[1] & (1 << 17)))
+            level = SimdAVX512;
+    }
+#endif
+    simdLevel = level;
+    return level;
+}
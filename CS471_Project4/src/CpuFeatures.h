@@ -0,0 +1,53 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file CpuFeatures.h
+ * \brief This is where the detection of the SIMD instruction sets supported by the running processor is defined.
+ *
+ *  Kernels with AVX2 or AVX-512 implementations are compiled for those instruction sets individually with the
+ *  TARGET_AVX2 and TARGET_AVX512 attributes, and the best one supported by the processor is chosen at runtime
+ *  using the level reported here.
+ */
+#ifndef TESTINGSUITE_CPUFEATURES_H
+#define TESTINGSUITE_CPUFEATURES_H
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define SIMD_X86 1 /*!< declare the constant signifying the x86 SIMD kernels can be compiled*/
+#include <immintrin.h>
+#endif
+
+#if defined(SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+#define TARGET_SSE2 __attribute__((target("sse2"))) /*!< compile the following function for SSE2*/
+#define TARGET_AVX2 __attribute__((target("avx2,fma"))) /*!< compile the following function for AVX2 and FMA*/
+#define TARGET_AVX512 __attribute__((target("avx512f,avx512dq,avx2,fma"))) /*!< compile the following function for AVX-512*/
+#else
+#define TARGET_SSE2
+#define TARGET_AVX2
+#define TARGET_AVX512
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define ALWAYS_INLINE __attribute__((always_inline)) inline /*!< inlines the following function into every caller, so the constants it is given are folded into its body*/
+#else
+#define ALWAYS_INLINE inline
+#endif
+
+/*!
+ * enum representing the widest SIMD instruction set supported by the processor, in increasing order
+ */
+enum SimdLevel{
+    SimdScalar,
+    SimdSSE2,
+    SimdAVX2,
+    SimdAVX512
+};
+
+/// \fn int detectSimdLevel()
+/// \brief Queries CPUID once for the supported instruction sets and returns the widest one the kernels can use.
+/// The result is cached so it is cheap to call from any thread after main has called it once.
+///
+/// \return the SimdLevel enum value for the running processor
+int detectSimdLevel();
+
+#endif //TESTINGSUITE_CPUFEATURES_H
@@ -0,0 +1,232 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file DeltaEquations.c
+ * \brief This is where the methods defined in src/DeltaEquations.h are implemented.
+ *
+ *  The terms below are written exactly as the terms summed by the functions in src/Equations.c, so a delta only
+ *  differs from evaluating the whole vector again by the order the terms are added in. Every function has its own
+ *  delta function with its term inlined, picked once per run with deltaFunction.
+ */
+#include "DeltaEquations.h"
+#include "Utilities.h"
+#include "CpuFeatures.h"
+
+/*!
+ * The shapes of the sums the objective functions are made of.
+ */
+enum TermShape{
+    ElementTerms, /*!< Term j uses element j*/
+    PairTerms, /*!< Term j uses elements j and j + 1*/
+    LevyTerms /*!< Term j uses element j for all but the last element, which is added with the first outside of the sum*/
+};
+
+/*!
+ * A single term of a sum, given the element, the next element for pair terms, and the index of the term.
+ */
+typedef double (*TermFunction)(double element, double nextElem, int index);
+
+static double schwefelTerm(double element, double nextElem, int index){
+    (void)nextElem; (void)index;
+    return (-1.0 * element) * sin(sqrt(fabs(element)));
+}
+static double deJongTerm(double element, double nextElem, int index){
+    (void)nextElem; (void)index;
+    return pow(element, 2.0);
+}
+static double rosenbrockTerm(double element, double nextElem, int index){
+    (void)index;
+    return (100.0 * pow(pow(element, 2.0) - nextElem, 2.0)) + pow((1.0 - element), 2.0);
+}
+static double rastgrinTerm(double element, double nextElem, int index){
+    (void)nextElem; (void)index;
+    return pow(element, 2.0) - (10.0 * cos(2.0 * M_PI * element));
+}
+static double sineEnvTerm(double element, double nextElem, int index){
+    (void)index;
+    return 0.5 + (sin(pow( pow(element, 2.0) +  pow(nextElem, 2.0) - 0.5,2.0))/pow(1.0 + 0.001*(pow(element, 2.0) +  pow(nextElem, 2.0)), 2.0));
+}
+static double stretchVTerm(double element, double nextElem, int index){
+    (void)index;
+    return pow(pow(element, 2.0) +  pow(nextElem, 2.0), 0.25) * sin(pow(50.0 * pow(pow(element, 2.0) +  pow(nextElem, 2.0), 0.1),2.0)) + 1.0;
+}
+static double ackleyOneTerm(double element, double nextElem, int index){
+    (void)index;
+    return ((1.0/exp(0.2))*sqrt(pow(element, 2.0) +  pow(nextElem, 2.0))) +  3.0 * (cos(2.0 * element) + sin(2.0 * nextElem));
+}
+static double ackleyTwoTerm(double element, double nextElem, int index){
+    (void)index;
+    return 20.0 + exp(1.0) - (20.0/exp(0.2 * sqrt((pow(element, 2.0) +  pow(nextElem, 2.0)) / 2.0))) - exp(0.5*(cos(2.0 * M_PI * element) + cos(2.0 * M_PI * nextElem)));
+}
+static double eggHolderTerm(double element, double nextElem, int index){
+    (void)index;
+    return (-1.0 * element * sin(sqrt(fabs(element - nextElem - 47)))) - ((nextElem + 47) * sin(sqrt(fabs(nextElem + 47 + (element / 2.0)))));
+}
+static double ranaTerm(double element, double nextElem, int index){
+    (void)index;
+    return (element * sin(sqrt(fabs(nextElem - element + 1.0))) * cos(sqrt(fabs(nextElem + element + 1.0))))
+           + ((nextElem + 1.0) * cos(sqrt(fabs(nextElem - element + 1.0))) * sin(sqrt(fabs(nextElem + element + 1.0))));
+}
+static double pathologicalTerm(double element, double nextElem, int index){
+    (void)index;
+    return 0.5 + ((sin(pow(sqrt((100.0 * pow(element, 2.0)) + pow(nextElem, 2.0)),2.0)) - 0.5)
+                  /(1.0 + (0.001 * pow(pow(element, 2.0) - (2.0 * element * nextElem) + pow(nextElem, 2.0), 2.0))));
+}
+static double michalewiczTerm(double element, double nextElem, int index){
+    (void)nextElem;
+    return sin(element) * pow(sin(((index+1) * pow(element, 2.0)) / M_PI), 20.0);
+}
+static double mastersTerm(double element, double nextElem, int index){
+    (void)index;
+    return exp((-1.0 / 8.0) *(pow(element, 2.0) + pow(nextElem, 2.0) + (0.5 * nextElem * element)))
+           * cos(pow(pow(element, 2.0) + pow(nextElem, 2.0) + (0.5 * nextElem * element), 0.25));
+}
+static double quarticTerm(double element, double nextElem, int index){
+    (void)nextElem;
+    return (index + 1.0) * pow(element, 4.0);
+}
+static double levyTerm(double element, double nextElem, int index){
+    (void)nextElem; (void)index;
+    double wi = 1.0 + ((element - 1.0)/4.0); /*!< Wi of the element*/
+    return pow(wi - 1.0, 2.0) * (1.0 + 10.0 * pow(sin((M_PI * wi) + 1.0), 2.0));
+}
+static double stepTerm(double element, double nextElem, int index){
+    (void)nextElem; (void)index;
+    return pow(fabs(element) + 0.5, 2.0);
+}
+static double alpineTerm(double element, double nextElem, int index){
+    (void)nextElem; (void)index;
+    return fabs((element * sin(element)) + (0.1 * element));
+}
+
+/*!
+ * The part of Levy outside of its sum: the W0 term, and the Wn term levyHost adds once for every other element.
+ */
+static double levyEnds(double first, double last, int numDim){
+    double levyFirstConst = 1.0 + ((first - 1.0) /4.0), /*!< W0 of the vector*/
+    levyLastConst = 1.0 + ((last - 1.0) /4.0); /*!< Wn of the vector*/
+    return pow(sin(M_PI * levyFirstConst), 2.0)
+           + (numDim - 1) * (pow(levyLastConst - 1.0, 2.0) * (1.0 + pow(sin(2.0 * M_PI * levyLastConst), 2.0)));
+}
+
+/*!
+ * The value an element had before the move. Entry k of the log is the coordinate next to or at dim, so only its
+ * neighbours in the log can hold dim.
+ */
+static double previousValue(const Real* vector, const MoveLog* log, int k, int dim){
+    for(int i = k - 1; i <= k + 1; i++){
+        if(i >= 0 && i < log->count && log->dims[i] == dim)
+            return log->previous[i];
+    }
+    return vector[dim];
+}
+
+size_t moveLogBytes(int dimensions){
+    int capacity = dimensions / DELTA_DENSITY_DIVISOR; /*!< The most coordinates a logged move may change*/
+    return arenaBlockBytes(capacity, sizeof(int)) + arenaBlockBytes(capacity, sizeof(Real));
+}
+
+MoveLog createMoveLog(Arena* arena, int dimensions){
+    MoveLog log; /*!< Declare the log to be returned*/
+    log.capacity = dimensions / DELTA_DENSITY_DIVISOR;
+    log.dims = arenaAlloc(arena, log.capacity, sizeof(int));
+    log.previous = arenaAlloc(arena, log.capacity, sizeof(Real));
+    log.count = 0;
+    return log;
+}
+
+/*!
+ * Calculates the fitness after a move from the fitness before it, as fitness = constant + (scale + scalePerDim * numDim)
+ * * sum of the terms. Every function below inlines it with its own shape, term and scale, so the term is inlined into
+ * the loop instead of called through a pointer.
+ */
+static ALWAYS_INLINE double deltaSum(int shape, TermFunction term, double scale, double scalePerDim, const Real* vector, int numDim, const MoveLog* log, double baseFit){
+    int pairs = shape == PairTerms, /*!< Whether every term uses the next element as well*/
+    numTerms = shape == ElementTerms ? numDim : numDim - 1, /*!< The number of terms in the sum*/
+    done = -1; /*!< The last term whose change has been added*/
+    double change = 0.0; /*!< The change of the sum*/
+    /*!
+     * Loop through the changed coordinates, adding the new value minus the old value of every term using them which
+     * was not already added for the previous coordinate.
+     */
+    for(int k = 0; k < log->count; k++){
+        int dim = log->dims[k], /*!< The changed coordinate*/
+        first = pairs ? dim - 1 : dim, /*!< The first term using the coordinate*/
+        last = dim < numTerms - 1 ? dim : numTerms - 1; /*!< The last term using the coordinate*/
+        if(first <= done)
+            first = done + 1;
+        if(first < 0)
+            first = 0;
+        for(int t = first; t <= last; t++){
+            double nextElem = pairs ? vector[t + 1] : 0.0, /*!< The next element after the move*/
+            oldNext = pairs ? previousValue(vector, log, k, t + 1) : 0.0; /*!< The next element before the move*/
+            change += term(vector[t], nextElem, t) - term(previousValue(vector, log, k, t), oldNext, t);
+        }
+        if(last > done)
+            done = last;
+    }
+    /*!
+     * Levy also uses its first and last element outside of the sum, so their change is added when either moved.
+     */
+    if(shape == LevyTerms && (log->dims[0] == 0 || log->dims[log->count - 1] == numDim - 1)){
+        double oldFirst = log->dims[0] == 0 ? log->previous[0] : vector[0], /*!< The first element before the move*/
+        oldLast = log->dims[log->count - 1] == numDim - 1 ? log->previous[log->count - 1] : vector[numDim - 1]; /*!< The last element before the move*/
+        change += levyEnds(vector[0], vector[numDim - 1], numDim) - levyEnds(oldFirst, oldLast, numDim);
+    }
+    return baseFit + (scale + scalePerDim * numDim) * change;
+}
+
+/*!
+ * Defines the delta function of an objective function from the shape of its sum, its term and its scale.
+ */
+#define DELTA_FUNCTION(name, shape, scale, scalePerDim) \
+static double name##Delta(const Real* vector, int numDim, const MoveLog* log, double baseFit){ \
+    return deltaSum(shape, name##Term, scale, scalePerDim, vector, numDim, log, baseFit); \
+}
+
+DELTA_FUNCTION(schwefel, ElementTerms, -1.0, 0.0)
+DELTA_FUNCTION(deJong, ElementTerms, 1.0, 0.0)
+DELTA_FUNCTION(rosenbrock, PairTerms, 1.0, 0.0)
+DELTA_FUNCTION(rastgrin, ElementTerms, 0.0, 10.0)
+DELTA_FUNCTION(sineEnv, PairTerms, -1.0, 0.0)
+DELTA_FUNCTION(stretchV, PairTerms, 1.0, 0.0)
+DELTA_FUNCTION(ackleyOne, PairTerms, 1.0, 0.0)
+DELTA_FUNCTION(ackleyTwo, PairTerms, 1.0, 0.0)
+DELTA_FUNCTION(eggHolder, PairTerms, 1.0, 0.0)
+DELTA_FUNCTION(rana, PairTerms, 1.0, 0.0)
+DELTA_FUNCTION(pathological, PairTerms, 1.0, 0.0)
+DELTA_FUNCTION(michalewicz, ElementTerms, -1.0, 0.0)
+DELTA_FUNCTION(masters, PairTerms, -1.0, 0.0)
+DELTA_FUNCTION(quartic, ElementTerms, 1.0, 0.0)
+DELTA_FUNCTION(levy, LevyTerms, 1.0, 0.0)
+DELTA_FUNCTION(step, ElementTerms, 1.0, 0.0)
+DELTA_FUNCTION(alpine, ElementTerms, 1.0, 0.0)
+
+#undef DELTA_FUNCTION
+
+//! The delta functions of the objective functions, in the order of the EquationPosition enum in src/Utilities.h
+static const DeltaFunction deltaFunctions[MAX_NUM_EQUATIONS] = {
+    &schwefelDelta,
+    &deJongDelta,
+    &rosenbrockDelta,
+    &rastgrinDelta,
+    NULL, ///Griewangk's product of cosines touches every coordinate
+    &sineEnvDelta,
+    &stretchVDelta,
+    &ackleyOneDelta,
+    &ackleyTwoDelta,
+    &eggHolderDelta,
+    &ranaDelta,
+    &pathologicalDelta,
+    &michalewiczDelta,
+    &mastersDelta,
+    &quarticDelta,
+    &levyDelta,
+    &stepDelta,
+    &alpineDelta
+};
+
+DeltaFunction deltaFunction(int equation){
+    return deltaFunctions[equation];
+}
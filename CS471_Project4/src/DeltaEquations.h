@@ -0,0 +1,88 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file DeltaEquations.h
+ * \brief This is where the incremental (delta) evaluation of the objective functions in src/Equations.h is defined.
+ *
+ *  Every objective function but Griewangk is a sum of terms of a single element (DeJong, Schwefel, Step, ...) or of
+ *  a pair of neighbouring elements (Rosenbrock, Rana, EggHolder, ...), scaled by a constant. When a move changes only
+ *  a few coordinates of a vector whose fitness is known, its delta function adds the change of the terms touching those
+ *  coordinates to that fitness, which costs a few terms per changed coordinate instead of all of them. The moves are
+ *  recorded in a MoveLog while the vector is built, and evaluateMove in src/Utilities.h decides when to use it.
+ */
+#ifndef TESTINGSUITE_DELTAEQUATIONS_H
+#define TESTINGSUITE_DELTAEQUATIONS_H
+
+#include "Arena.h"
+
+#define DELTA_DENSITY_DIVISOR 64 /*!< declare the constant for the fraction of the dimensions a move may change and still be evaluated by its delta*/
+#define DELTA_REFRESH_MOVES 64 /*!< declare the constant for the most deltas a fitness is built from before the vector is evaluated in full again*/
+
+/*!
+ * The coordinates a move changed in a vector and the values they had before it, in increasing order of coordinate.
+ * Once more than capacity coordinates changed the count is set to -1, meaning the move is dense and the vector is
+ * evaluated in full.
+ */
+typedef struct _MoveLog{
+    int* dims;
+    Real* previous;
+    int count;
+    int capacity;
+}MoveLog;
+
+/*!
+ * The signature of the delta functions, which calculate the fitness of a moved vector from the fitness it had before the
+ * move and the terms touching the coordinates in the log, holding at least one. The result differs from a full
+ * evaluation by rounding only.
+ */
+typedef double (*DeltaFunction)(const Real* vector, int numDim, const MoveLog* log, double baseFit);
+
+/// \fn void resetMoveLog(MoveLog* log)
+/// \brief Empties the log before the next move is recorded.
+///
+/// \param log - the log of the vector being moved
+static inline void resetMoveLog(MoveLog* log){
+    log->count = 0;
+}
+
+/// \fn void logMove(MoveLog* log, int dim, Real previous)
+/// \brief Records that a coordinate changed, which must be called in increasing order of coordinate.
+///
+/// \param log - the log of the vector being moved
+/// \param dim - the coordinate which changed
+/// \param previous - the value the coordinate had before the move
+static inline void logMove(MoveLog* log, int dim, Real previous){
+    if(log->count < 0)
+        return;
+    if(log->count == log->capacity){ ///too many coordinates changed for the delta to pay off
+        log->count = -1;
+        return;
+    }
+    log->dims[log->count] = dim;
+    log->previous[log->count] = previous;
+    log->count++;
+}
+
+/// \fn size_t moveLogBytes(int dimensions)
+/// \brief Calculates how much of an arena createMoveLog takes, used to size the arena of a run.
+///
+/// \param dimensions - the number of dimensions of the vectors being moved
+/// \return the number of bytes
+size_t moveLogBytes(int dimensions);
+/// \fn MoveLog createMoveLog(Arena* arena, int dimensions)
+/// \brief Allocates an empty log from the arena of a run, with room for a DELTA_DENSITY_DIVISOR'th of the dimensions.
+///
+/// \param arena - the arena of the run the log is allocated from
+/// \param dimensions - the number of dimensions of the vectors being moved
+/// \return the empty log
+MoveLog createMoveLog(Arena* arena, int dimensions);
+/// \fn DeltaFunction deltaFunction(int equation)
+/// \brief Returns the delta function of an objective function, which every one but Griewangk has as its product of
+/// cosines touches every coordinate.
+///
+/// \param equation - the EquationPosition enum value in src/Utilities.h of the function
+/// \return the delta function, or NULL if the function is always evaluated in full
+DeltaFunction deltaFunction(int equation);
+
+#endif //TESTINGSUITE_DELTAEQUATIONS_H
@@ -138,4 +138,32 @@ void* stepHandler(void* info);
 /// \return Threaded function so no return.
 void* alpineHandler(void* info);
 
+/*!
+ * The equation run by a thread started with pluginHandler, formulaHandler or variantHandler, which unlike the built in
+ * functions is only known once the objective plugins have been loaded and the objective formulas and variants read.
+ */
+typedef struct _EquationRun{
+    Info* data;
+    int equationPos;
+}EquationRun;
+
+/// \fn void* pluginHandler(void* run)
+/// \brief This is the method which sets up the function of an objective plugin in src/Plugins.h before passing it to runEquationsAsThreads()
+///
+/// \param run - The reference to the EquationRun holding the Info struct and the position of the function
+/// \return Threaded function so no return.
+void* pluginHandler(void* run);
+/// \fn void* formulaHandler(void* run)
+/// \brief This is the method which sets up an objective formula in src/Formulas.h before passing it to runEquationsAsThreads()
+///
+/// \param run - The reference to the EquationRun holding the Info struct and the position of the formula
+/// \return Threaded function so no return.
+void* formulaHandler(void* run);
+/// \fn void* variantHandler(void* run)
+/// \brief This is the method which sets up a variant in src/Variants.h before passing it to runEquationsAsThreads()
+///
+/// \param run - The reference to the EquationRun holding the Info struct and the position of the variant
+/// \return Threaded function so no return.
+void* variantHandler(void* run);
+
 #endif //TESTINGSUITE_EQUATIONHANDLERS_H
@@ -13,132 +13,178 @@
 #ifndef TESTINGSUITE_EQUATIONS_H
 #define TESTINGSUITE_EQUATIONS_H
 
+#include "Matrix.h"
+
 /// \fn double schwefelHost(double* vector, int numDim)
 /// \brief This is the method which  performs calculations for each vector in the matrix utilizing the Schwefel function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double schwefelHost(const double*, int);
+double schwefelHost(const Real*, int);
 /// \fn double deJongHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the DeJong Sphere function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double deJongHost(const double*, int);
+double deJongHost(const Real*, int);
 /// \fn double rosenbrockHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the Rosenbrock function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double rosenbrockHost(const double*, int);
+double rosenbrockHost(const Real*, int);
 /// \fn double rastgrinHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the Rastgrin function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double rastgrinHost(const double*, int);
+double rastgrinHost(const Real*, int);
 /// \fn double griewangkHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the Griewangk function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double griewangkHost(const double*, int);
+double griewangkHost(const Real*, int);
 /// \fn double sineEnvSineWaveHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the Sine Envelope function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double sineEnvSineWaveHost(const double*, int);
+double sineEnvSineWaveHost(const Real*, int);
 /// \fn double stretchVSineWaveHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the Stretch V Sine Wave function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double stretchVSineWaveHost(const double*, int);
+double stretchVSineWaveHost(const Real*, int);
 /// \fn double ackleyOneHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the Ackley One function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double ackleyOneHost(const double*, int);
+double ackleyOneHost(const Real*, int);
 /// \fn double ackleyTwoHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the Ackley Two function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double ackleyTwoHost(const double*, int);
+double ackleyTwoHost(const Real*, int);
 /// \fn double eggHolderHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the Egg Holder function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double eggHolderHost(const double*, int);
+double eggHolderHost(const Real*, int);
 /// \fn double ranaHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the Rana function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double ranaHost(const double*, int);
+double ranaHost(const Real*, int);
 /// \fn double pathologicalHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the provided Pathological function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double pathologicalHost(const double*, int);
+double pathologicalHost(const Real*, int);
 /// \fn double michalewiczHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the Michalewicz function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double michalewiczHost(const double*, int);
+double michalewiczHost(const Real*, int);
 /// \fn double mastersCosineWaveHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the Master's Cosine Wave function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double mastersCosineWaveHost(const double*, int);
+double mastersCosineWaveHost(const Real*, int);
 /// \fn double quarticHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the Quartic function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double quarticHost(const double*, int);
+double quarticHost(const Real*, int);
 /// \fn double levyHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the Levy function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double levyHost(const double*, int);
+double levyHost(const Real*, int);
 /// \fn double stepHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the provided Step function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double stepHost(const double*, int);
+double stepHost(const Real*, int);
 /// \fn double alpineHost(double* vector, int numDim)
 /// \brief This is the method which performs calculations for each vector in the matrix utilizing the Alpine function
 ///
 /// \param vector - The vector of values to use in this function calculation
 /// \param numDim - the number of dimensions in the vector for the function calculation
 /// \return The resulting value from the calculation
-double alpineHost(const double*, int);
+double alpineHost(const Real*, int);
+/// \fn double griewangkPart(const Real* vector, int numDim, int begin, int end, double* product)
+/// \brief This is the method which calculates the terms begin up to end of the Griewangk function, for evaluating a
+/// single vector in parts on several threads. The fitness is the sum of the parts less the product.
+///
+/// \param vector - The whole vector being evaluated
+/// \param numDim - the number of dimensions in the vector
+/// \param begin - the first term of the part
+/// \param end - the term after the last term of the part
+/// \param product - The product of the terms so far, which the cosines of the part are multiplied into
+/// \return The sum of the part, including the constant 1 in the first part
+double griewangkPart(const Real* vector, int numDim, int begin, int end, double* product);
+/// \fn double michalewiczPart(const Real* vector, int numDim, int begin, int end, double* product)
+/// \brief This is the method which calculates the terms begin up to end of the Michalewicz function, for evaluating a
+/// single vector in parts on several threads. The fitness is the sum of the parts.
+///
+/// \param vector - The whole vector being evaluated
+/// \param numDim - the number of dimensions in the vector
+/// \param begin - the first term of the part
+/// \param end - the term after the last term of the part
+/// \param product - Unused, as the function has no product
+/// \return The negated sum of the terms of the part
+double michalewiczPart(const Real* vector, int numDim, int begin, int end, double* product);
+/// \fn double quarticPart(const Real* vector, int numDim, int begin, int end, double* product)
+/// \brief This is the method which calculates the terms begin up to end of the Quartic function, for evaluating a single
+/// vector in parts on several threads. The fitness is the sum of the parts.
+///
+/// \param vector - The whole vector being evaluated
+/// \param numDim - the number of dimensions in the vector
+/// \param begin - the first term of the part
+/// \param end - the term after the last term of the part
+/// \param product - Unused, as the function has no product
+/// \return The sum of the terms of the part
+double quarticPart(const Real* vector, int numDim, int begin, int end, double* product);
+/// \fn double levyPart(const Real* vector, int numDim, int begin, int end, double* product)
+/// \brief This is the method which calculates the terms begin up to end of the numDim - 1 terms of the Levy function, for
+/// evaluating a single vector in parts on several threads. The fitness is the sum of the parts.
+///
+/// \param vector - The whole vector being evaluated
+/// \param numDim - the number of dimensions in the vector
+/// \param begin - the first term of the part
+/// \param end - the term after the last term of the part
+/// \param product - Unused, as the function has no product
+/// \return The sum of the terms of the part, including the term of the first element in the first part
+double levyPart(const Real* vector, int numDim, int begin, int end, double* product);
 
 
 #endif //TESTINGSUITE_EQUATIONS_H
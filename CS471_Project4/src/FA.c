@@ -15,31 +15,62 @@
 
 void* fireflyAlg(void* data){
     EquationInfo info = *(EquationInfo*)data;
+    pinThread(info.cpu); ///pin before the arena is touched so its pages are placed on the node of this CPU
     int iterations = info.iterations;
     struct timespec start, /*!< Declare the timespec struct storing the start time of the iterations*/
             end; /*!< Declare the timespec struct storing the end time of the iterations*/
     double totTMillSec; /*!< Declare the double storing the total runtime of all iterations in milliseconds*/
-    double** temp = allocateEmptyMatrix(info.numVectors, info.dimToTest);
-    FireflySwarm* fireflies = calloc(1, sizeof(FireflySwarm));
-    fireflies->population = createMatrix(info);
-    fireflies->fitness = calloc(info.numVectors, sizeof(double));
+    RandStream* rng = arenaAlloc(info.arena, 1, sizeof(RandStream)); /*!< Allocate the random number generator owned by this thread*/
+    seedRandStream(rng, info.cellSeed, info.randomMode);
+    info.rng = rng;
+    writeSeedManifest("FA", info); ///record the seed of this run so it can be replayed on its own
+    FireflySwarm* fireflies = arenaAlloc(info.arena, 1, sizeof(FireflySwarm));
+    fireflies->rng = rng;
+    fireflies->population = createRowPool(info.arena, info.numVectors, 2 * info.numVectors + 1, info.dimToTest); ///enough rows for the snapshot, every firefly replacing it and the scratch row
+    Matrix initial = poolMatrix(&fireflies->population, info.numVectors); /*!< The rows of the population slots, which are in order until the first iteration*/
+    createMatrix(info, &initial);
+    fireflies->fitness = arenaAlloc(info.arena, info.numVectors, sizeof(double));
+    fireflies->randBuf = arenaAlloc(info.arena, info.dimToTest, sizeof(double));
+    fireflies->pinnedFit = arenaAlloc(info.arena, info.numVectors, sizeof(double)); ///the fitness of every firefly at the start of an iteration
+    fireflies->candidates = arenaMatrix(info.arena, info.numVectors, info.dimToTest); ///every firefly a single firefly is attracted to in an iteration
+    fireflies->candidateFit = arenaAlloc(info.arena, info.numVectors, sizeof(double));
+    fireflies->candidatePos = arenaAlloc(info.arena, info.numVectors, sizeof(int));
+    fireflies->candidateCut = arenaAlloc(info.arena, info.numVectors, sizeof(int));
+    fireflies->cutWorst = info.bounded == BoundedOn; ///stop evaluating the candidates which cannot replace the worst firefly
+    fireflies->sequential = info.updateOrder == SequentialUpdate;
     fireflies->dimensions = info.dimToTest;
-    evaluatePop(fireflies->population, fireflies->fitness, info.numVectors, info.dimToTest, info.equationNum, &fireflies->bestPos, &fireflies->worstPos, &fireflies->bestFit, &fireflies->worstFit);
+    if((fireflies->cache = createFitnessCache(info.arena, info.fitnessCache, info.dimToTest))){ ///remember the candidates evaluated in full when the fitness cache line turned it on
+        fireflies->candidateHash = arenaAlloc(info.arena, info.numVectors, sizeof(uint64_t));
+        fireflies->cacheMisses = arenaAlloc(info.arena, info.numVectors, sizeof(int));
+        fireflies->missFit = arenaAlloc(info.arena, info.numVectors, sizeof(double));
+    }
+    Memetic* memetic = createMemetic(info); /*!< The refinement of the best firefly, NULL when it is off*/
+    evaluatePop(&initial, fireflies->fitness, &info.objective, &fireflies->bestPos, &fireflies->worstPos, &fireflies->bestFit, &fireflies->worstFit);
+    storePopulation(fireflies->cache, &initial, fireflies->fitness);
+    long heapCalls = heapAllocationCount(); /*!< The heap allocations made by this thread before the iterations*/
     for(int i = 0; i < iterations; i++){
         clock_gettime(CLOCK_MONOTONIC, &start); /*!< Set the start time using a monotonic clock, meaning it will ignore if the system clock changes*/
-        copyMatrix(fireflies->population, temp, info.numVectors, info.dimToTest);
-        fireflyLoop(fireflies, temp, info.numVectors, info.beta, info.gamma, info.alpha, info.equationNum, info.range);
+        setRandIteration(rng, i); ///random values drawn in this iteration are addressed by it
+        pinSlots(&fireflies->population); ///every firefly moves towards the population as it was at the start of the iteration
+        if(!fireflies->sequential)
+            copyArray(fireflies->fitness, fireflies->pinnedFit, info.numVectors); ///and with the synchronous update compares itself to the fitness it had then
+        fireflyLoop(fireflies, &fireflies->population, info.numVectors, info.beta, info.gamma, info.alpha, &info.objective, info.range);
+        if(refinementDue(memetic, i))
+            refineFireflies(fireflies, memetic, info.numVectors); ///polish the best firefly with a few quasi-Newton steps
         clock_gettime(CLOCK_MONOTONIC, &end);/*!< Store the end time*/
         totTMillSec = (double)((end.tv_sec - start.tv_sec) * MS_PER_SEC) +  ((end.tv_nsec - start.tv_nsec) / (double) NS_PER_MS); /*!< Calculate the total runtime by subtracting end time's seconds from the start time's seconds and converting to milliseconds and adding the end time's nanoseconds minus the start time's nanoseconds and converting to milliseconds*/
         ///write the best and worst to a file
         writeResultToFile(fireflies->bestFit, fireflies->worstFit, "FA", i, totTMillSec, info);
         if(info.currExperiment == info.printExperiment) {
             ///write the new population to a log file
-            writePopulationLogToFile(fireflies->population, "FA", i, info);
+            writePopulationLogToFile(&fireflies->population.rows, fireflies->population.slots, "FA", i, info);
         }
     }
-    freeMatrix(temp, info.numVectors);
-    freeFireflySwarm(fireflies, info.numVectors);
+    recordHeapAllocations(heapAllocationCount() - heapCalls); ///every buffer should have come from the arena before the first iteration
+    recordCutShort(fireflies->bounded, fireflies->cutShort);
+    recordCacheHits(fireflies->cache);
+    recordRefinements(memetic);
+    ///every buffer of FA is released when the arena is reset for the next experiment
 }
 
 
@@ -48,13 +79,13 @@ double lightIntensity(const double* fitness, int iPos, double gamma, double dist
     return fitness[iPos] * exp(-1 * gamma * distance);
 }
 
-void fireflyLoop(FireflySwarm* fireflies, double** temp, int popSize, double beta, double gamma, double alpha, int equation, double* range){
+void fireflyLoop(FireflySwarm* fireflies, const RowPool* temp, int popSize, double beta, double gamma, double alpha, const Objective* objective, double* range){
     for(int i = 0; i < popSize; i++){
-        moveFirefliesLoop(fireflies, temp, i, beta, gamma, alpha, equation, popSize, range);
+        moveFirefliesLoop(fireflies, temp, i, beta, gamma, alpha, objective, popSize, range);
     }
 }
 
-double calcDistanceSquared(const double* fireflyI, const double* fireflyJ, int dimensions){
+double calcDistanceSquared(const Real* fireflyI, const Real* fireflyJ, int dimensions){
     double distance = 0,
     disTerm = 0;
     for(int i = 0; i < dimensions; i++){
@@ -64,15 +95,15 @@ double calcDistanceSquared(const double* fireflyI, const double* fireflyJ, int d
     return distance;
 }
 
-double calcAttractiveness(double** temp, int iPos, int jPos, int currDim, double beta, double gamma, double distance){
-    return beta * exp(-1 * gamma * distance) * (temp[jPos][currDim] - temp[iPos][currDim]);
+double calcAttractiveness(const RowPool* temp, int iPos, int jPos, int currDim, double beta, double gamma, double distance){
+    return beta * exp(-1 * gamma * distance) * (pinnedRow(temp, jPos)[currDim] - pinnedRow(temp, iPos)[currDim]);
 }
 
-double* calcAttractedVector(double** temp, int iPos, int jPos, int dimensions, double beta, double alpha, double gamma, const double* range, double distance){
-    double* newVector = calloc(dimensions, sizeof(double));
+void calcAttractedVector(Real* newVector, const double* randoms, const RowPool* temp, int iPos, int jPos, int dimensions, double beta, double alpha, double gamma, const double* range, double distance){
     double firefly = 0;
+    const Real* fireflyI = pinnedRow(temp, iPos); /*!< The snapshot row of the firefly being moved*/
     for(int i = 0; i < dimensions; i++){
-        firefly = temp[iPos][i] + calcAttractiveness(temp, iPos, jPos, i, beta, gamma, distance) + (alpha * (genDblInRange(0, 1) - 0.5) * (range[RANGE_MAX_POS] - range[RANGE_MIN_POS]));
+        firefly = fireflyI[i] + calcAttractiveness(temp, iPos, jPos, i, beta, gamma, distance) + (alpha * randoms[i] * (range[RANGE_MAX_POS] - range[RANGE_MIN_POS]));
         if(firefly < range[RANGE_MIN_POS]){
             firefly = range[RANGE_MIN_POS];
             newVector[i] = firefly;
@@ -85,40 +116,115 @@ double* calcAttractedVector(double** temp, int iPos, int jPos, int dimensions, d
             newVector[i] = firefly;
         }
     }
-    return newVector;
 }
 
-void moveFirefliesLoop(FireflySwarm* fireflies, double** temp, int iPos, double beta, double gamma, double alpha, int equation, int popSize, double* range){
+/*!
+ * Accepts an evaluated candidate, copying it into the scratch row only when it replaces a firefly.
+ */
+static void acceptCandidate(FireflySwarm* fireflies, int candidate, int popSize){
+    double newFitness = fireflies->candidateFit[candidate]; /*!< The fitness of the candidate*/
+    if(newFitness < fireflies->bestFit || newFitness < fireflies->worstFit)
+        memcpy(poolScratch(&fireflies->population), matrixRow(&fireflies->candidates, candidate), fireflies->dimensions * sizeof(Real));
+    if(newFitness < fireflies->bestFit){
+        newBest(fireflies, newFitness, popSize);
+    }
+    else if(newFitness < fireflies->worstFit){
+        addVector(fireflies, newFitness, popSize);
+    }
+}
+
+void moveFirefliesLoop(FireflySwarm* fireflies, const RowPool* temp, int iPos, double beta, double gamma, double alpha, const Objective* objective, int popSize, double* range){
     double lightIntensityI = 0,
     distance = 0,
-    newFitness = 0;
-    double* newVector;
-    int dimensions = fireflies->dimensions;
+    bound; /*!< The fitness a candidate has to reach to replace a firefly*/
+    int dimensions = fireflies->dimensions,
+    numCandidates = 0; /*!< The number of fireflies iPos is attracted to*/
+    const double* compared = fireflies->sequential ? fireflies->fitness : fireflies->pinnedFit; /*!< The fitness the light intensities are calculated from*/
+    /*!
+     * Build a candidate for every firefly brighter than iPos, drawing the random movement of each in the same order as
+     * they are compared. With the sequential update every candidate is evaluated and accepted as soon as it is built,
+     * so the comparisons after it see the firefly it replaced.
+     */
     for(int j = 0; j < popSize; j++){
-        distance = calcDistanceSquared(temp[iPos], temp[j], dimensions);
-        lightIntensityI = lightIntensity(fireflies->fitness, iPos, gamma, distance);
-        if(lightIntensity(fireflies->fitness, j, gamma, distance) < lightIntensityI){
-            newVector = calcAttractedVector(temp, iPos, j, dimensions, beta, alpha, gamma, range, distance);
-            newFitness = evaluateFitness(newVector, dimensions, equation);
-            if(newFitness < fireflies->bestFit){
-                newBest(fireflies, newVector, newFitness, popSize);
+        distance = calcDistanceSquared(pinnedRow(temp, iPos), pinnedRow(temp, j), dimensions);
+        lightIntensityI = lightIntensity(compared, iPos, gamma, distance);
+        if(lightIntensity(compared, j, gamma, distance) < lightIntensityI){
+            fillDblAt(fireflies->rng, RandMovement, iPos, j, fireflies->randBuf, dimensions, -0.5, 0.5); ///generate the random movement for every dimension at once
+            calcAttractedVector(matrixRow(&fireflies->candidates, numCandidates), fireflies->randBuf, temp, iPos, j, dimensions, beta, alpha, gamma, range, distance);
+            fireflies->candidatePos[numCandidates++] = j;
+            if(fireflies->sequential){
+                evaluateCandidates(fireflies, 1, objective, fireflies->cutWorst ? fireflies->worstFit : INFINITY);
+                acceptCandidate(fireflies, 0, popSize);
+                numCandidates = 0;
             }
-            else if(newFitness < fireflies->worstFit){
-                addVector(fireflies, newVector, newFitness, popSize);
-            }
-            free(newVector);
         }
     }
+    /*!
+     * With the synchronous update every candidate of iPos is known up front, so they are evaluated in a single batch and
+     * then accepted in order.
+     */
+    if(numCandidates == 0)
+        return;
+    bound = fireflies->cutWorst ? fireflies->worstFit : INFINITY; ///the worst only improves while the candidates are accepted, so none cut short could have been
+    evaluateCandidates(fireflies, numCandidates, objective, bound);
+    for(int k = 0; k < numCandidates; k++)
+        acceptCandidate(fireflies, k, popSize);
 }
 
-void newBest(FireflySwarm* pop, double* newVector, double newResult, int popSize){
+void evaluateCandidates(FireflySwarm* fireflies, int numCandidates, const Objective* objective, double bound){
+    FitnessCache* cache = fireflies->cache; /*!< The cache of the run, NULL when it is off*/
+    int numMisses = 0, /*!< The number of candidates the cache does not hold*/
+    counted = canCutShort(objective, bound), /*!< Whether the evaluations could stop early, otherwise candidateCut is not written*/
+    candidate; /*!< The position of a candidate the cache did not hold*/
+    if(!cache){
+        if(counted)
+            fireflies->bounded += numCandidates;
+        fireflies->cutShort += evaluateBatchBounded(&fireflies->candidates, NULL, numCandidates, objective, bound, fireflies->candidateFit, fireflies->candidateCut);
+        return;
+    }
+    /*!
+     * Look up every candidate, gathering the rows of the ones the cache does not hold so they are evaluated in one batch.
+     */
+    for(int k = 0; k < numCandidates; k++){
+        const Real* row = matrixRow(&fireflies->candidates, k); /*!< The candidate being looked up*/
+        fireflies->candidateHash[k] = hashVector(row, fireflies->dimensions);
+        if(!lookupFitness(cache, row, fireflies->candidateHash[k], &fireflies->candidateFit[k]))
+            fireflies->cacheMisses[numMisses++] = k;
+    }
+    if(counted)
+        fireflies->bounded += numMisses;
+    fireflies->cutShort += evaluateBatchBounded(&fireflies->candidates, fireflies->cacheMisses, numMisses, objective, bound, fireflies->missFit, fireflies->candidateCut);
+    for(int m = 0; m < numMisses; m++){
+        candidate = fireflies->cacheMisses[m];
+        fireflies->candidateFit[candidate] = fireflies->missFit[m];
+        if(!counted || !fireflies->candidateCut[m]) ///a fitness cut short is only a bound, so it is never stored
+            storeFitness(cache, matrixRow(&fireflies->candidates, candidate), fireflies->candidateHash[candidate], fireflies->missFit[m]);
+    }
+}
+
+void newBest(FireflySwarm* pop, double newResult, int popSize){
     pop->bestFit = newResult;
     pop->bestPos = pop->worstPos;
-    addVector(pop, newVector, newResult, popSize);
+    addVector(pop, newResult, popSize);
 }
 
-void addVector(FireflySwarm* pop, double* newVector, double newResult, int popSize){
+void addVector(FireflySwarm* pop, double newResult, int popSize){
     pop->fitness[pop->worstPos] = newResult;
-    copyArray(newVector, pop->population[pop->worstPos], pop->dimensions);
+    acceptScratch(&pop->population, pop->worstPos); ///the worst slot takes the scratch row instead of a copy
     evalNewWorst(pop->fitness, popSize, newResult, &pop->worstPos, &pop->worstFit);
-}
\ No newline at end of file
+}
+
+void refineFireflies(FireflySwarm* pop, Memetic* memetic, int popSize){
+    double refined = refineSlot(memetic, &pop->population, pop->bestPos, pop->bestFit); /*!< The fitness of the best firefly afterwards*/
+    const Real* row; /*!< The refined firefly*/
+    if(!(refined < pop->bestFit))
+        return;
+    pop->bestFit = refined;
+    pop->fitness[pop->bestPos] = refined;
+    if(pop->bestPos == pop->worstPos) ///the whole population shared the fitness, so the worst is looked for again
+        evalNewWorst(pop->fitness, popSize, refined, &pop->worstPos, &pop->worstFit);
+    if(pop->cache){
+        row = poolRow(&pop->population, pop->bestPos);
+        storeFitness(pop->cache, row, hashVector(row, pop->dimensions), refined);
+    }
+}
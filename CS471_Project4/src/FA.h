@@ -14,6 +14,7 @@
 #define CS471_PROJECT4_FA_H
 
 #include "Utilities.h"
+#include "Memetic.h"
 
 /// \fn void* fireflyAlg(void* data)
 /// \brief Responsible for initializing the algorithm and all data related to the algorithm and calling related functions to start and record results fo the algorithm
@@ -30,30 +31,30 @@ void* fireflyAlg(void* data);
 /// \param distance - distance between fireflies
 /// \return The value of the light intensity inverse squarely proportional to the distance
 double lightIntensity(const double* fitness, int iPos, double gamma, double distance);
-/// \fn void fireflyLoop(FireflySwarm* fireflies, double** temp, int popSize, double beta, double gamma, double alpha, int equation, double* range)
+/// \fn void fireflyLoop(FireflySwarm* fireflies, const RowPool* temp, int popSize, double beta, double gamma, double alpha, const Objective* objective, double* range)
 /// \brief Loops through the population calling the move firefly loop function
 ///
 /// \param fireflies - struct being processed in the iteration
-/// \param temp - the temporary population which will not be updated
+/// \param temp - the row pool of the population, read through the snapshot pinned at the start of the iteration
 /// \param popSize - the size of the population
 /// \param beta - the attractiveness factor
 /// \param gamma - the light absorption rate
 /// \param alpha - the scaling factor on the range
-/// \param equation - equation number for the objective function call
+/// \param objective - the functions of the run, resolved once by resolveObjective
 /// \param range - range of values acceptable for the population
-void fireflyLoop(FireflySwarm* fireflies, double** temp, int popSize, double beta, double gamma, double alpha, int equation, double* range);
-/// \fn double calcDistanceSquared(const double* fireflyI, const double* fireflyJ, int dimensions)
+void fireflyLoop(FireflySwarm* fireflies, const RowPool* temp, int popSize, double beta, double gamma, double alpha, const Objective* objective, double* range);
+/// \fn double calcDistanceSquared(const Real* fireflyI, const Real* fireflyJ, int dimensions)
 /// \brief Squares the difference of each dimension between the two vectors and sums them. No square root is needed as it is the distance squared
 ///
 /// \param fireflyI - first firefly to be iterated
 /// \param fireflyJ - second firefly to be iterated
 /// \param dimensions - number of dimensions in the firefly
 /// \return A double value representing the distance squared between the two fireflies
-double calcDistanceSquared(const double* fireflyI, const double* fireflyJ, int dimensions);
-/// \fn double calcAttractiveness(double** temp, int iPos, int jPos, int currDim, double beta, double gamma, double distance)
+double calcDistanceSquared(const Real* fireflyI, const Real* fireflyJ, int dimensions);
+/// \fn double calcAttractiveness(const RowPool* temp, int iPos, int jPos, int currDim, double beta, double gamma, double distance)
 /// \brief Calculates the term representing the attractiveness and how far the new firefly will move toward the compared firefly
 ///
-/// \param temp - the temporary population being considered in the loop
+/// \param temp - the row pool of the population, read through the snapshot pinned at the start of the iteration
 /// \param iPos - the position of the current firefly in the population
 /// \param jPos - the position of the compared firefly in the population
 /// \param currDim - current dimension being processed
@@ -61,11 +62,13 @@ double calcDistanceSquared(const double* fireflyI, const double* fireflyJ, int d
 /// \param gamma - light absorption rate
 /// \param distance - distance between fireflies
 /// \return A double value representing the attractiveness of the firefly inverse square proportional to the distance
-double calcAttractiveness(double** temp, int iPos, int jPos, int currDim, double beta, double gamma, double distance);
-/// \fn double* calcAttractedVector(double** temp, int iPos, int jPos, int dimensions, double beta, double alpha, double gamma, const double* range, double distance)
+double calcAttractiveness(const RowPool* temp, int iPos, int jPos, int currDim, double beta, double gamma, double distance);
+/// \fn void calcAttractedVector(Real* newVector, const double* randoms, const RowPool* temp, int iPos, int jPos, int dimensions, double beta, double alpha, double gamma, const double* range, double distance)
 /// \brief Calculates a new vector based on the current value added to the attractiveness, added to some random movement in the range.
 ///
-/// \param temp - the temporary population being considered in the loop
+/// \param newVector - the buffer the newly developed firefly is stored to
+/// \param randoms - the pre-generated random scalars in [-0.5, 0.5) for every dimension
+/// \param temp - the row pool of the population, read through the snapshot pinned at the start of the iteration
 /// \param iPos - the position of the current firefly in the population
 /// \param jPos - the position of the compared firefly in the population
 /// \param dimensions - the number of dimensions in the firefly
@@ -74,36 +77,56 @@ double calcAttractiveness(double** temp, int iPos, int jPos, int currDim, double
 /// \param gamma - light absorption rate
 /// \param range - the range of acceptable values for the equation
 /// \param distance - distance between fireflies
-/// \return returns a newly developed firefly
-double* calcAttractedVector(double** temp, int iPos, int jPos, int dimensions, double beta, double alpha, double gamma, const double* range, double distance);
-/// \fn void moveFirefliesLoop(FireflySwarm* fireflies, double** temp, int iPos, double beta, double gamma, double alpha, int equation, int popSize, double* range)
+/// \return No return as it modifies newVector directly
+void calcAttractedVector(Real* newVector, const double* randoms, const RowPool* temp, int iPos, int jPos, int dimensions, double beta, double alpha, double gamma, const double* range, double distance);
+/// \fn void moveFirefliesLoop(FireflySwarm* fireflies, const RowPool* temp, int iPos, double beta, double gamma, double alpha, const Objective* objective, int popSize, double* range)
 /// \brief loops through the entire population and compares the light intensity of each firefly to see if a newly attracted firefly is to be created.
+/// With the sequential update every attracted firefly is evaluated as soon as it is built and may replace the worst
+/// firefly before the next comparison. With the synchronous update the intensities are compared with the fitness of the
+/// snapshot, so every attracted firefly is known up front and they are evaluated in a single batch before replacing the
+/// worst fireflies in order.
 ///
 /// \param fireflies - the struct being processed
-/// \param temp - the temporary population being considered in the loop
+/// \param temp - the row pool of the population, read through the snapshot pinned at the start of the iteration
 /// \param iPos - the position of the current firefly in the population
 /// \param beta - attractiveness factor
 /// \param gamma - light absorption rate
 /// \param alpha - the randomness factor for the final term
-/// \param equation - equation number for the objective function call
+/// \param objective - the functions of the run, resolved once by resolveObjective
 /// \param popSize - the population size of fireflies
 /// \param range - the range of acceptable values for the equation
-void moveFirefliesLoop(FireflySwarm* fireflies, double** temp, int iPos, double beta, double gamma, double alpha, int equation, int popSize, double* range);
-/// \fn void newBest(FireflySwarm* pop, double* newVector, double newResult, int popSize)
+void moveFirefliesLoop(FireflySwarm* fireflies, const RowPool* temp, int iPos, double beta, double gamma, double alpha, const Objective* objective, int popSize, double* range);
+/// \fn void evaluateCandidates(FireflySwarm* fireflies, int numCandidates, const Objective* objective, double bound)
+/// \brief Evaluates the candidates built by moveFirefliesLoop into candidateFit. With the fitness cache on, every
+/// candidate is looked up first and only the ones it does not hold are evaluated, then stored unless they were cut short.
+///
+/// \param fireflies - the struct being processed
+/// \param numCandidates - the number of candidates
+/// \param objective - the functions of the run, resolved once by resolveObjective
+/// \param bound - the fitness a candidate has to reach to replace a firefly
+void evaluateCandidates(FireflySwarm* fireflies, int numCandidates, const Objective* objective, double bound);
+/// \fn void newBest(FireflySwarm* pop, double newResult, int popSize)
 /// \brief updates the metadata regarding the best firefly in the population
 ///
-/// \param pop - the struct being processed
-/// \param newVector - the newly created firefly
+/// \param pop - the struct being processed, with the newly created firefly in the scratch row of its population
 /// \param newResult - the fitness of the newly created firefly
 /// \param popSize- the size of the firefly population
-void newBest(FireflySwarm* pop, double* newVector, double newResult, int popSize);
-/// \fn void addVector(FireflySwarm* pop, double* newVector, double newResult, int popSize)
-/// \brief updates the metadata regarding the worst firefly in the population
+void newBest(FireflySwarm* pop, double newResult, int popSize);
+/// \fn void addVector(FireflySwarm* pop, double newResult, int popSize)
+/// \brief replaces the worst firefly in the population with the newly created firefly by handing it the scratch row, and
+/// updates the metadata regarding the worst firefly in the population
 ///
-/// \param pop - the struct being processed
-/// \param newVector - the newly created firefly
+/// \param pop - the struct being processed, with the newly created firefly in the scratch row of its population
 /// \param newResult - the fitness of the newly created firefly
 /// \param popSize- the size of the firefly population
-void addVector(FireflySwarm* pop, double* newVector, double newResult, int popSize);
+void addVector(FireflySwarm* pop, double newResult, int popSize);
+/// \fn void refineFireflies(FireflySwarm* pop, Memetic* memetic, int popSize)
+/// \brief Refines the best firefly with src/Memetic.h, updating its fitness, the best fitness and the worst firefly
+/// when the refined vector is better, and storing it in the fitness cache when that is on.
+///
+/// \param pop - the struct being processed
+/// \param memetic - the refinement of the run
+/// \param popSize- the size of the firefly population
+void refineFireflies(FireflySwarm* pop, Memetic* memetic, int popSize);
 
 #endif //CS471_PROJECT4_FA_H
@@ -0,0 +1,129 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file FitnessCache.c
+ * \brief This is where all methods defined in src/FitnessCache.h are implemented.
+ *
+ */
+#include "FitnessCache.h"
+#include <string.h>
+
+#define FITNESS_HASH_PRIME 0x100000001B3ULL /*!< declare the constant for the 64-bit FNV prime every value is mixed in with*/
+
+
+static int cacheBuckets(int entries){
+    return (entries + FITNESS_CACHE_WAYS - 1) / FITNESS_CACHE_WAYS;
+}
+
+static uint64_t realBits(Real value){
+#ifdef SINGLE_PRECISION
+    uint32_t bits; /*!< The bits of the single precision value*/
+#else
+    uint64_t bits; /*!< The bits of the double precision value*/
+#endif
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+size_t fitnessCacheBytes(int entries, int dimensions){
+    if(entries <= 0)
+        return 0;
+    int slots = cacheBuckets(entries) * FITNESS_CACHE_WAYS; /*!< The entries rounded up to whole buckets*/
+    return arenaBlockBytes(1, sizeof(FitnessCache)) + arenaBlockBytes(slots, sizeof(uint64_t)) + arenaBlockBytes(slots, sizeof(double))
+           + arenaBlockBytes(slots, sizeof(uint32_t)) + arenaMatrixBytes(slots, dimensions);
+}
+
+FitnessCache* createFitnessCache(Arena* arena, int entries, int dimensions){
+    if(entries <= 0)
+        return NULL;
+    FitnessCache* cache = arenaAlloc(arena, 1, sizeof(FitnessCache)); /*!< The cache, zeroed so every entry starts out empty*/
+    int slots; /*!< The entries rounded up to whole buckets*/
+    cache->buckets = cacheBuckets(entries);
+    cache->dimensions = dimensions;
+    slots = cache->buckets * FITNESS_CACHE_WAYS;
+    cache->hashes = arenaAlloc(arena, slots, sizeof(uint64_t));
+    cache->fitness = arenaAlloc(arena, slots, sizeof(double));
+    cache->used = arenaAlloc(arena, slots, sizeof(uint32_t));
+    cache->vectors = arenaMatrix(arena, slots, dimensions);
+    return cache;
+}
+
+uint64_t hashVector(const Real* vector, int dimensions){
+    uint64_t lane0 = 0xCBF29CE484222325ULL, /*!< The hash of every fourth value, held in four registers so their multiplies overlap*/
+    lane1 = 0x9E3779B97F4A7C15ULL,
+    lane2 = 0xBF58476D1CE4E5B9ULL,
+    lane3 = 0x94D049BB133111EBULL,
+    lanes[FITNESS_HASH_LANES], /*!< The lanes, to be mixed together*/
+    hash = (uint64_t)dimensions; /*!< The lanes mixed together*/
+    int j = 0;
+    for(; j + FITNESS_HASH_LANES <= dimensions; j += FITNESS_HASH_LANES){
+        lane0 = (lane0 ^ realBits(vector[j])) * FITNESS_HASH_PRIME;
+        lane1 = (lane1 ^ realBits(vector[j + 1])) * FITNESS_HASH_PRIME;
+        lane2 = (lane2 ^ realBits(vector[j + 2])) * FITNESS_HASH_PRIME;
+        lane3 = (lane3 ^ realBits(vector[j + 3])) * FITNESS_HASH_PRIME;
+    }
+    for(; j < dimensions; j++)
+        lane0 = (lane0 ^ realBits(vector[j])) * FITNESS_HASH_PRIME;
+    lanes[0] = lane0;
+    lanes[1] = lane1;
+    lanes[2] = lane2;
+    lanes[3] = lane3;
+    /*!
+     * Mix the lanes together with the finalizer of splitmix64, so every bit of every lane reaches the high bits the
+     * bucket is picked with.
+     */
+    for(int l = 0; l < FITNESS_HASH_LANES; l++){
+        hash ^= lanes[l];
+        hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+        hash ^= hash >> 31;
+    }
+    return hash;
+}
+
+static int bucketStart(const FitnessCache* cache, uint64_t hash){
+    return (int)(((hash >> 32) * (uint64_t)cache->buckets) >> 32) * FITNESS_CACHE_WAYS; ///the high bits of the hash scaled to the number of buckets
+}
+
+static uint32_t tick(FitnessCache* cache){
+    if(++cache->clock == 0) ///0 marks an empty entry, so it is skipped when the clock wraps around
+        cache->clock = 1;
+    return cache->clock;
+}
+
+int lookupFitness(FitnessCache* cache, const Real* vector, uint64_t hash, double* fitness){
+    int first = bucketStart(cache, hash); /*!< The first entry of the bucket of the vector*/
+    cache->lookups++;
+    for(int w = first; w < first + FITNESS_CACHE_WAYS; w++){
+        if(cache->used[w] && cache->hashes[w] == hash && memcmp(matrixRow(&cache->vectors, w), vector, cache->dimensions * sizeof(Real)) == 0){
+            cache->used[w] = tick(cache);
+            *fitness = cache->fitness[w];
+            cache->hits++;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void storeFitness(FitnessCache* cache, const Real* vector, uint64_t hash, double fitness){
+    int first = bucketStart(cache, hash), /*!< The first entry of the bucket of the vector*/
+    victim = first; /*!< The entry the vector replaces, an empty one or the one used least recently*/
+    for(int w = first; w < first + FITNESS_CACHE_WAYS; w++){
+        if(cache->used[w] && cache->hashes[w] == hash && memcmp(matrixRow(&cache->vectors, w), vector, cache->dimensions * sizeof(Real)) == 0)
+            return; ///the vector is already held
+        if(cache->used[w] < cache->used[victim])
+            victim = w;
+    }
+    cache->hashes[victim] = hash;
+    cache->fitness[victim] = fitness;
+    cache->used[victim] = tick(cache);
+    memcpy(matrixRow(&cache->vectors, victim), vector, cache->dimensions * sizeof(Real));
+}
+
+void storePopulation(FitnessCache* cache, const Matrix* pop, const double* fitness){
+    if(!cache)
+        return;
+    for(int i = 0; i < pop->rows; i++)
+        storeFitness(cache, matrixRow(pop, i), hashVector(matrixRow(pop, i), pop->cols), fitness[i]);
+}
@@ -0,0 +1,89 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file FitnessCache.h
+ * \brief This is where the cache remembering the fitness of the vectors a single run evaluated is defined.
+ *
+ *  With a high HMCR and a low PAR the Harmonic Search often builds a new harmony equal to one already in its memory,
+ *  and fireflies clamped to the bounds of the range can land on the same vector. The optional 'Fitness Cache' line gives
+ *  every run a table of the vectors it evaluated in full and their fitness, allocated from the arena of the run so it is
+ *  owned by its thread and never locked. A vector is found by its hash and the stored copy is compared value for value,
+ *  so a hit always returns the fitness of the exact same vector and a repeated candidate costs a hash instead of an
+ *  evaluation. The table holds a fixed number of vectors in buckets of FITNESS_CACHE_WAYS, and a full bucket replaces
+ *  the vector used least recently.
+ */
+#ifndef TESTINGSUITE_FITNESSCACHE_H
+#define TESTINGSUITE_FITNESSCACHE_H
+
+#include "Arena.h"
+#include <stdint.h>
+
+#define FITNESS_CACHE_WAYS 4 /*!< declare the constant for the number of vectors held in every bucket of the cache*/
+#define FITNESS_HASH_LANES 4 /*!< declare the constant for the number of independent hashes a vector is read into, each in its own register*/
+#define MAX_FITNESS_CACHE_ENTRIES (1 << 24) /*!< declare the constant for the most vectors the cache of a run holds*/
+
+/*!
+ * The vectors a run evaluated in full, FITNESS_CACHE_WAYS per bucket. Entry i holds the hash, fitness and copy of a
+ * vector, and the clock value of its last use, which is 0 while the entry is empty.
+ */
+typedef struct _FitnessCache{
+    int buckets;
+    int dimensions;
+    uint64_t* hashes;
+    double* fitness;
+    uint32_t* used;
+    Matrix vectors;
+    uint32_t clock;
+    long lookups; /*!< The number of vectors looked up*/
+    long hits; /*!< The number of them which were found*/
+}FitnessCache;
+
+/// \fn size_t fitnessCacheBytes(int entries, int dimensions)
+/// \brief Calculates how much of an arena createFitnessCache takes, used to size the arena of a run.
+///
+/// \param entries - the number of vectors the cache holds, 0 when the cache is off
+/// \param dimensions - the number of dimensions of every vector
+/// \return the number of bytes, 0 when the cache is off
+size_t fitnessCacheBytes(int entries, int dimensions);
+/// \fn FitnessCache* createFitnessCache(Arena* arena, int entries, int dimensions)
+/// \brief Allocates an empty cache from the arena of a run, rounding entries up to whole buckets.
+///
+/// \param arena - the arena of the run
+/// \param entries - the number of vectors the cache holds, 0 when the cache is off
+/// \param dimensions - the number of dimensions of every vector
+/// \return the empty cache, or NULL when the cache is off
+FitnessCache* createFitnessCache(Arena* arena, int entries, int dimensions);
+/// \fn uint64_t hashVector(const Real* vector, int dimensions)
+/// \brief Hashes the bits of every value of a vector, so only vectors with exactly the same values share a hash.
+///
+/// \param vector - the vector
+/// \param dimensions - the number of dimensions of the vector
+/// \return the hash of the vector
+uint64_t hashVector(const Real* vector, int dimensions);
+/// \fn int lookupFitness(FitnessCache* cache, const Real* vector, uint64_t hash, double* fitness)
+/// \brief Looks a vector up by its hash, comparing it to the stored copy before its fitness is used.
+///
+/// \param cache - the cache of the run
+/// \param vector - the vector
+/// \param hash - the hash of the vector from hashVector
+/// \param fitness - stores the fitness of the vector when it is found
+/// \return 1 if the vector was found, 0 otherwise
+int lookupFitness(FitnessCache* cache, const Real* vector, uint64_t hash, double* fitness);
+/// \fn void storeFitness(FitnessCache* cache, const Real* vector, uint64_t hash, double fitness)
+/// \brief Stores a vector evaluated in full, replacing the vector of its bucket used least recently when it is full.
+///
+/// \param cache - the cache of the run
+/// \param vector - the vector
+/// \param hash - the hash of the vector from hashVector
+/// \param fitness - the fitness of the vector, which must not come from an evaluation cut short or a delta
+void storeFitness(FitnessCache* cache, const Real* vector, uint64_t hash, double fitness);
+/// \fn void storePopulation(FitnessCache* cache, const Matrix* pop, const double* fitness)
+/// \brief Stores every vector of an initial population evaluated with evaluatePop in src/Utilities.h.
+///
+/// \param cache - the cache of the run, or NULL when the cache is off
+/// \param pop - the population, one vector per row
+/// \param fitness - the fitness of every vector
+void storePopulation(FitnessCache* cache, const Matrix* pop, const double* fitness);
+
+#endif //TESTINGSUITE_FITNESSCACHE_H
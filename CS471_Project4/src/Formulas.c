@@ -0,0 +1,830 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Formulas.c
+ * \brief This is where the methods defined in src/Formulas.h are implemented.
+ *
+ *  A formula is parsed into a tree of nodes, folding every operation on constants as it goes and sharing every part it
+ *  repeats, and the tree is compiled into one program per sum or product plus the program combining them. Constant
+ *  integer powers become products and ^0.5 and ^0.25 square roots, so only the other powers reach pow. A temporary is
+ *  released after its last read, so a program only needs as many registers as the widest part of its expression.
+ *
+ *  The formulas are only compiled while the init file is read, before any threads are started, so the registry below
+ *  is never written while a run reads it.
+ */
+#include "Formulas.h"
+#include "Bytecode.h"
+#include <ctype.h>
+
+#define FORMULA_MAX_NODES 512 /*!< declare the constant for the most nodes in the tree of a formula*/
+#define FORMULA_MAX_INTEGER_POWER 64 /*!< declare the constant for the largest constant integer power compiled to products*/
+#define FORMULA_MAX_NAME 8 /*!< declare the constant for the longest name of a function or constant in a formula*/
+
+/*!
+ * A compiled formula.
+ */
+typedef struct _Formula{
+    FormulaProgram terms[FORMULA_MAX_SUMS]; /*!< The term of every sum and product*/
+    int numTerms;
+    FormulaProgram combine; /*!< The program combining the sums and products into the fitness*/
+    unsigned char termRegisters[FORMULA_MAX_SUMS]; /*!< The register of combine holding every sum or product*/
+    double lower;
+    double upper;
+}Formula;
+
+/*!
+ * The kinds of node in the tree of a formula.
+ */
+enum NodeKind{
+    ConstantNode,
+    InputNode,
+    UnaryNode,
+    BinaryNode,
+    SumNode,
+    ProductNode
+};
+
+/*!
+ * A node of the tree of a formula.
+ */
+typedef struct _FormulaNode{
+    int kind;
+    int code; /*!< The FormulaCode of an operation, or the FormulaInput of an input*/
+    double value; /*!< The value of a constant*/
+    int left; /*!< The left operand, or the term of a sum or product*/
+    int right; /*!< The right operand*/
+    int pairs; /*!< Whether the term of a sum or product reads x[i+1]*/
+}FormulaNode;
+
+/*!
+ * The state of the parser of one formula.
+ */
+typedef struct _FormulaParser{
+    const char* text;
+    int pos;
+    const char* error; /*!< The first error found, NULL while there is none*/
+    char message[64]; /*!< The text of errors naming a character*/
+    int inTerm; /*!< Whether the term of a sum or product is being read*/
+    int pairs; /*!< Whether the term being read has read x[i+1]*/
+    FormulaNode nodes[FORMULA_MAX_NODES];
+    int numNodes;
+}FormulaParser;
+
+/*!
+ * The state of the compiler of one program.
+ */
+typedef struct _FormulaCompiler{
+    FormulaProgram* program;
+    const FormulaParser* parser;
+    Formula* formula;
+    unsigned int used; /*!< The registers holding a constant or a temporary still to be read, one bit each*/
+    unsigned int kept; /*!< The registers never released, holding a constant or a sum or product*/
+    unsigned int written; /*!< The registers written by an operation so far*/
+    int registers[FORMULA_MAX_NODES]; /*!< The register holding every node compiled so far, -1 before*/
+    int uses[FORMULA_MAX_NODES]; /*!< The reads of every node not yet compiled*/
+    const char* error; /*!< The first error found, NULL while there is none*/
+}FormulaCompiler;
+
+static void runScalar(const FormulaProgram* program, double (*registers)[FORMULA_BLOCK], int count, double* accumulator);
+
+static Formula formulas[MAX_NUM_FORMULAS]; /*!< Every formula compiled*/
+static char* formulaNames[MAX_NUM_FORMULAS]; /*!< The name every formula was registered under*/
+static int numFormulas = 0; /*!< The number of formulas compiled*/
+static FormulaRunner formulaRunner = &runScalar; /*!< The runner of the installed instruction set*/
+
+/*!
+ * Runs a program one lane at a time with formulaScalarOp, the runner of the scalar level.
+ */
+static void runScalar(const FormulaProgram* program, double (*registers)[FORMULA_BLOCK], int count, double* accumulator){
+    for(int o = 0; o < program->numOps; o++){
+        const FormulaOp* op = &program->ops[o]; /*!< The operation being run*/
+        for(int k = 0; k < count; k++)
+            registers[op->dest][k] = formulaScalarOp(op->code, registers[op->left][k], registers[op->right][k]);
+    }
+    if(!accumulator)
+        return;
+    for(int k = 0; k < count; k++)
+        accumulator[k] = program->product ? accumulator[k] * registers[program->result][k] : accumulator[k] + registers[program->result][k];
+}
+
+/*!
+ * Records the first error of a formula and returns -1 for the node being read.
+ */
+static int parseError(FormulaParser* parser, const char* error){
+    if(!parser->error)
+        parser->error = error;
+    return -1;
+}
+
+/*!
+ * Adds a node, or returns the node already read with the same operation on the same operands, so every part repeated
+ * in a formula is only computed once.
+ */
+static int addNode(FormulaParser* parser, int kind, int code, double value, int left, int right){
+    for(int n = 0; n < parser->numNodes; n++){
+        const FormulaNode* other = &parser->nodes[n]; /*!< A node already read*/
+        if(other->kind == kind && other->code == code && other->left == left && other->right == right &&
+                memcmp(&other->value, &value, sizeof(double)) == 0)
+            return n;
+    }
+    if(parser->numNodes == FORMULA_MAX_NODES)
+        return parseError(parser, "the formula is too long");
+    FormulaNode* node = &parser->nodes[parser->numNodes]; /*!< The node added*/
+    node->kind = kind;
+    node->code = code;
+    node->value = value;
+    node->left = left;
+    node->right = right;
+    node->pairs = 0;
+    return parser->numNodes++;
+}
+
+static int constantNode(FormulaParser* parser, double value){
+    return addNode(parser, ConstantNode, 0, value, -1, -1);
+}
+
+/*!
+ * Adds an operation with one operand, folding it into a constant when the operand is one.
+ */
+static int unaryNode(FormulaParser* parser, int code, int operand){
+    if(operand < 0)
+        return -1;
+    if(parser->nodes[operand].kind == ConstantNode)
+        return constantNode(parser, formulaScalarOp(code, parser->nodes[operand].value, 0.0));
+    return addNode(parser, UnaryNode, code, 0.0, operand, -1);
+}
+
+/*!
+ * Adds an operation with two operands, folding it into a constant when both are, and the powers 1 and 0 away.
+ */
+static int binaryNode(FormulaParser* parser, int code, int left, int right){
+    if(left < 0 || right < 0)
+        return -1;
+    if(parser->nodes[left].kind == ConstantNode && parser->nodes[right].kind == ConstantNode)
+        return constantNode(parser, formulaScalarOp(code, parser->nodes[left].value, parser->nodes[right].value));
+    if(code == FormulaPow && parser->nodes[right].kind == ConstantNode && parser->nodes[right].value == 1.0)
+        return left;
+    if(code == FormulaPow && parser->nodes[right].kind == ConstantNode && parser->nodes[right].value == 0.0)
+        return constantNode(parser, 1.0);
+    return addNode(parser, BinaryNode, code, 0.0, left, right);
+}
+
+static void skipSpaces(FormulaParser* parser){
+    while(isspace((unsigned char)parser->text[parser->pos]))
+        parser->pos++;
+}
+
+/*!
+ * Reads the character c if it is next, returning whether it was.
+ */
+static int accept(FormulaParser* parser, char c){
+    skipSpaces(parser);
+    if(parser->text[parser->pos] != c)
+        return 0;
+    parser->pos++;
+    return 1;
+}
+
+/*!
+ * Reads the character c, recording an error if it is not next.
+ */
+static int expect(FormulaParser* parser, char c){
+    if(accept(parser, c))
+        return 1;
+    if(!parser->error){
+        sprintf(parser->message, "expected '%c'", c);
+        parser->error = parser->message;
+    }
+    return 0;
+}
+
+static int parseExpression(FormulaParser* parser);
+static int parseUnary(FormulaParser* parser);
+
+/*!
+ * Reads x[i] or x[i+1], the x having been read.
+ */
+static int parseElement(FormulaParser* parser){
+    int next = 0; /*!< Whether x[i+1] is read*/
+    if(!parser->inTerm)
+        return parseError(parser, "x can only be read inside a sum or product");
+    if(!expect(parser, '[') || !expect(parser, 'i'))
+        return -1;
+    if(accept(parser, '+')){
+        if(!expect(parser, '1'))
+            return -1;
+        next = 1;
+    }
+    if(!expect(parser, ']'))
+        return -1;
+    parser->pairs |= next;
+    return addNode(parser, InputNode, next ? NextRegister : ElementRegister, 0.0, -1, -1);
+}
+
+/*!
+ * Reads the term of a sum or product, the name having been read.
+ */
+static int parseTerm(FormulaParser* parser, int kind){
+    int term, /*!< The term being summed or multiplied*/
+    node; /*!< The sum or product*/
+    if(parser->inTerm)
+        return parseError(parser, "sums and products cannot be nested");
+    if(!expect(parser, '('))
+        return -1;
+    parser->inTerm = 1;
+    parser->pairs = 0;
+    term = parseExpression(parser);
+    parser->inTerm = 0;
+    if(term < 0 || !expect(parser, ')'))
+        return -1;
+    if((node = addNode(parser, kind, 0, 0.0, term, -1)) >= 0)
+        parser->nodes[node].pairs = parser->pairs;
+    return node;
+}
+
+/*!
+ * Reads a function of one argument, the name having been read.
+ */
+static int parseCall(FormulaParser* parser, int code){
+    int argument; /*!< The argument of the function*/
+    if(!expect(parser, '('))
+        return -1;
+    argument = parseExpression(parser);
+    if(argument < 0 || !expect(parser, ')'))
+        return -1;
+    return unaryNode(parser, code, argument);
+}
+
+/*!
+ * Reads a name, and the sum, product, call or element it starts.
+ */
+static int parseName(FormulaParser* parser){
+    static const char* functions[] = {"sin", "cos", "exp", "log", "sqrt", "abs"}; /*!< The functions of one argument*/
+    static const int codes[] = {FormulaSin, FormulaCos, FormulaExp, FormulaLog, FormulaSqrt, FormulaAbs}; /*!< The code of every function*/
+    char name[FORMULA_MAX_NAME + 1]; /*!< The name read*/
+    int length = 0; /*!< The length of the name*/
+    while(isalpha((unsigned char)parser->text[parser->pos])){
+        if(length == FORMULA_MAX_NAME)
+            return parseError(parser, "unknown name");
+        name[length++] = parser->text[parser->pos++];
+    }
+    name[length] = '\0';
+    if(strcmp(name, "x") == 0)
+        return parseElement(parser);
+    if(strcmp(name, "i") == 0)
+        return parser->inTerm ? addNode(parser, InputNode, IndexRegister, 0.0, -1, -1) : parseError(parser, "i can only be read inside a sum or product");
+    if(strcmp(name, "n") == 0)
+        return addNode(parser, InputNode, SizeRegister, 0.0, -1, -1);
+    if(strcmp(name, "pi") == 0)
+        return constantNode(parser, M_PI);
+    if(strcmp(name, "e") == 0)
+        return constantNode(parser, exp(1.0));
+    if(strcmp(name, "sum") == 0)
+        return parseTerm(parser, SumNode);
+    if(strcmp(name, "prod") == 0)
+        return parseTerm(parser, ProductNode);
+    if(strcmp(name, "pow") == 0){
+        int base, exponent; /*!< The arguments of the power*/
+        if(!expect(parser, '(') || (base = parseExpression(parser)) < 0 || !expect(parser, ',') ||
+                (exponent = parseExpression(parser)) < 0 || !expect(parser, ')'))
+            return -1;
+        return binaryNode(parser, FormulaPow, base, exponent);
+    }
+    for(int f = 0; f < (int)(sizeof(codes) / sizeof(codes[0])); f++){
+        if(strcmp(name, functions[f]) == 0)
+            return parseCall(parser, codes[f]);
+    }
+    return parseError(parser, "unknown name");
+}
+
+/*!
+ * Reads a number, a name or an expression in parentheses.
+ */
+static int parsePrimary(FormulaParser* parser){
+    skipSpaces(parser);
+    char c = parser->text[parser->pos]; /*!< The first character*/
+    if(isdigit((unsigned char)c) || c == '.'){
+        char* end; /*!< The character after the number*/
+        double value = strtod(parser->text + parser->pos, &end); /*!< The number*/
+        if(end == parser->text + parser->pos)
+            return parseError(parser, "expected a number");
+        parser->pos = (int)(end - parser->text);
+        return constantNode(parser, value);
+    }
+    if(isalpha((unsigned char)c))
+        return parseName(parser);
+    if(accept(parser, '(')){
+        int node = parseExpression(parser); /*!< The expression in the parentheses*/
+        if(node < 0 || !expect(parser, ')'))
+            return -1;
+        return node;
+    }
+    return parseError(parser, "expected a number, a name or '('");
+}
+
+/*!
+ * Reads a power, which binds tighter than a sign on its left and groups to the right.
+ */
+static int parsePower(FormulaParser* parser){
+    int base = parsePrimary(parser); /*!< The base of the power*/
+    if(base < 0 || !accept(parser, '^'))
+        return base;
+    return binaryNode(parser, FormulaPow, base, parseUnary(parser));
+}
+
+static int parseUnary(FormulaParser* parser){
+    if(accept(parser, '-'))
+        return unaryNode(parser, FormulaNeg, parseUnary(parser));
+    if(accept(parser, '+'))
+        return parseUnary(parser);
+    return parsePower(parser);
+}
+
+/*!
+ * Reads a product or quotient of signed powers.
+ */
+static int parseFactors(FormulaParser* parser){
+    int node = parseUnary(parser); /*!< The expression read so far*/
+    while(node >= 0){
+        if(accept(parser, '*'))
+            node = binaryNode(parser, FormulaMul, node, parseUnary(parser));
+        else if(accept(parser, '/'))
+            node = binaryNode(parser, FormulaDiv, node, parseUnary(parser));
+        else
+            break;
+    }
+    return node;
+}
+
+static int parseExpression(FormulaParser* parser){
+    int node = parseFactors(parser); /*!< The expression read so far*/
+    while(node >= 0){
+        if(accept(parser, '+'))
+            node = binaryNode(parser, FormulaAdd, node, parseFactors(parser));
+        else if(accept(parser, '-'))
+            node = binaryNode(parser, FormulaSub, node, parseFactors(parser));
+        else
+            break;
+    }
+    return node;
+}
+
+/*!
+ * Records the first error of a program and returns -1 for the register being compiled.
+ */
+static int compileError(FormulaCompiler* compiler, const char* error){
+    if(!compiler->error)
+        compiler->error = error;
+    return -1;
+}
+
+/*!
+ * Counts the reads of every node of a program, the nodes shared by several parts of it being counted once per read but
+ * only walked once. The term of a sum or product belongs to its own program and is not walked.
+ */
+static void countUses(FormulaCompiler* compiler, int index){
+    const FormulaNode* node = &compiler->parser->nodes[index]; /*!< The node being counted*/
+    if(compiler->uses[index]++ > 0 || node->kind == SumNode || node->kind == ProductNode)
+        return;
+    if(node->left >= 0)
+        countUses(compiler, node->left);
+    if(node->right >= 0)
+        countUses(compiler, node->right);
+}
+
+/*!
+ * Sets up the compiler of the program rooted at root. The root is counted as read once more, by the driver, so the
+ * register holding the result is never released.
+ */
+static void startCompiler(FormulaCompiler* compiler, FormulaProgram* program, const FormulaParser* parser, Formula* formula, int root){
+    compiler->program = program;
+    compiler->parser = parser;
+    compiler->formula = formula;
+    compiler->used = 0;
+    compiler->kept = 0;
+    compiler->written = 0;
+    compiler->error = NULL;
+    for(int n = 0; n < parser->numNodes; n++){
+        compiler->registers[n] = -1;
+        compiler->uses[n] = 0;
+    }
+    countUses(compiler, root);
+}
+
+static int allocateRegister(FormulaCompiler* compiler){
+    for(int r = FirstFreeRegister; r < FORMULA_MAX_REGISTERS; r++){
+        if(!(compiler->used & (1u << r))){
+            compiler->used |= 1u << r;
+            return r;
+        }
+    }
+    return compileError(compiler, "the formula needs too many registers");
+}
+
+/*!
+ * Allocates a register filled before the program runs, for a constant or a sum or product. It is taken from the top
+ * of the registers, and never one an operation has already written, which would overwrite it before it is read.
+ */
+static int allocatePreloaded(FormulaCompiler* compiler){
+    for(int r = FORMULA_MAX_REGISTERS - 1; r >= FirstFreeRegister; r--){
+        if(!((compiler->used | compiler->written) & (1u << r))){
+            compiler->used |= 1u << r;
+            compiler->kept |= 1u << r;
+            return r;
+        }
+    }
+    return compileError(compiler, "the formula needs too many registers");
+}
+
+/*!
+ * Frees a temporary, leaving the inputs, constants and sums alone.
+ */
+static void releaseRegister(FormulaCompiler* compiler, int r){
+    if(r >= FirstFreeRegister && !(compiler->kept & (1u << r)))
+        compiler->used &= ~(1u << r);
+}
+
+/*!
+ * Marks one read of a node as done, freeing its register after the last one.
+ */
+static void consume(FormulaCompiler* compiler, int index){
+    if(--compiler->uses[index] == 0)
+        releaseRegister(compiler, compiler->registers[index]);
+}
+
+/*!
+ * Returns the register holding a constant, adding it to the program the first time it is used.
+ */
+static int constantRegister(FormulaCompiler* compiler, double value){
+    FormulaProgram* program = compiler->program; /*!< The program being compiled*/
+    int r; /*!< The register of the constant*/
+    for(int c = 0; c < program->numConstants; c++){
+        if(memcmp(&program->constants[c], &value, sizeof(double)) == 0)
+            return program->constantRegisters[c];
+    }
+    if((r = allocatePreloaded(compiler)) < 0)
+        return -1;
+    program->constants[program->numConstants] = value;
+    program->constantRegisters[program->numConstants++] = (unsigned char)r;
+    return r;
+}
+
+/*!
+ * Appends an operation writing dest, returning dest.
+ */
+static int emitOp(FormulaCompiler* compiler, int code, int dest, int left, int right){
+    FormulaProgram* program = compiler->program; /*!< The program being compiled*/
+    if(dest < 0 || left < 0 || right < 0)
+        return -1;
+    if(program->numOps == FORMULA_MAX_OPS)
+        return compileError(compiler, "the formula has too many operations");
+    program->ops[program->numOps].code = (unsigned char)code;
+    program->ops[program->numOps].dest = (unsigned char)dest;
+    program->ops[program->numOps].left = (unsigned char)left;
+    program->ops[program->numOps].right = (unsigned char)right;
+    program->numOps++;
+    compiler->written |= 1u << dest;
+    return dest;
+}
+
+/*!
+ * Appends an operation reading a temporary which is not read again, whose result may reuse its register as every lane
+ * is read before it is written.
+ */
+static int emitTemporary(FormulaCompiler* compiler, int code, int left, int right){
+    if(left < 0 || right < 0)
+        return -1;
+    releaseRegister(compiler, left);
+    releaseRegister(compiler, right);
+    return emitOp(compiler, code, allocateRegister(compiler), left, right);
+}
+
+/*!
+ * Appends an operation reading the registers of two nodes, or one with a right node of -1. The reads are marked done
+ * first, so the result may reuse the register of an operand read for the last time.
+ */
+static int emitNodes(FormulaCompiler* compiler, int code, int leftNode, int left, int rightNode, int right){
+    if(left < 0 || right < 0)
+        return -1;
+    consume(compiler, leftNode);
+    if(rightNode >= 0)
+        consume(compiler, rightNode);
+    return emitOp(compiler, code, allocateRegister(compiler), left, right);
+}
+
+/*!
+ * Compiles base^power for a positive integer power by squaring, leaving base unreleased.
+ */
+static int integerPower(FormulaCompiler* compiler, int base, int power){
+    int half, /*!< base^(power/2)*/
+    square; /*!< base^(power - power % 2)*/
+    if(power == 1 || base < 0)
+        return base;
+    half = integerPower(compiler, base, power / 2);
+    if(half != base)
+        releaseRegister(compiler, half);
+    square = emitOp(compiler, FormulaMul, allocateRegister(compiler), half, half);
+    if(power % 2 == 0 || square < 0)
+        return square;
+    releaseRegister(compiler, square); ///only the square is a temporary, the base may still be read after the power
+    return emitOp(compiler, FormulaMul, allocateRegister(compiler), square, base);
+}
+
+/*!
+ * Compiles a power of a node with a constant exponent other than 0 and 1, as products or square roots where it can.
+ */
+static int compilePower(FormulaCompiler* compiler, int baseNode, int base, double exponent){
+    int power; /*!< The register of base^|exponent|*/
+    if(base < 0)
+        return -1;
+    if(exponent == 0.5 || exponent == 0.25){
+        power = emitNodes(compiler, FormulaSqrt, baseNode, base, -1, base);
+        return exponent == 0.5 ? power : emitTemporary(compiler, FormulaSqrt, power, power);
+    }
+    if(exponent != floor(exponent) || fabs(exponent) > FORMULA_MAX_INTEGER_POWER)
+        return emitNodes(compiler, FormulaPow, baseNode, base, -1, constantRegister(compiler, exponent));
+    power = integerPower(compiler, base, (int)fabs(exponent));
+    consume(compiler, baseNode);
+    if(exponent < 0.0 && power == base) ///base^-1 reads the base itself, which consume has released if nothing reads it again
+        return emitOp(compiler, FormulaDiv, allocateRegister(compiler), constantRegister(compiler, 1.0), power);
+    if(exponent < 0.0)
+        return emitTemporary(compiler, FormulaDiv, constantRegister(compiler, 1.0), power);
+    return power;
+}
+
+static int compileNode(FormulaCompiler* compiler, int index);
+
+/*!
+ * Compiles the term of a sum or product into its own program, returning the register of the combining program that
+ * holds its result.
+ */
+static int compileTerm(FormulaCompiler* compiler, const FormulaNode* node){
+    FormulaCompiler termCompiler; /*!< The compiler of the program of the term*/
+    Formula* formula = compiler->formula; /*!< The formula being compiled*/
+    FormulaProgram* term = &formula->terms[formula->numTerms]; /*!< The program of the term*/
+    int r; /*!< The register holding the result*/
+    if(formula->numTerms == FORMULA_MAX_SUMS)
+        return compileError(compiler, "the formula has too many sums and products");
+    startCompiler(&termCompiler, term, compiler->parser, formula, node->left);
+    term->pairs = node->pairs;
+    term->product = node->kind == ProductNode;
+    if((term->result = compileNode(&termCompiler, node->left)) < 0)
+        return compileError(compiler, termCompiler.error);
+    if((r = allocatePreloaded(compiler)) < 0)
+        return -1;
+    formula->termRegisters[formula->numTerms++] = (unsigned char)r;
+    return r;
+}
+
+/*!
+ * Compiles a node the first time it is read, and returns the register already holding it every time after.
+ */
+static int compileNode(FormulaCompiler* compiler, int index){
+    const FormulaNode* node = &compiler->parser->nodes[index]; /*!< The node being compiled*/
+    const FormulaNode* exponent = node->right >= 0 ? &compiler->parser->nodes[node->right] : NULL; /*!< The right operand*/
+    int left, right, /*!< The registers of the operands*/
+    r; /*!< The register holding the node*/
+    if(compiler->registers[index] >= 0)
+        return compiler->registers[index];
+    switch(node->kind){
+        case ConstantNode:
+            r = constantRegister(compiler, node->value);
+            break;
+        case InputNode:
+            r = node->code;
+            break;
+        case UnaryNode:
+            left = compileNode(compiler, node->left);
+            r = emitNodes(compiler, node->code, node->left, left, -1, left);
+            break;
+        case BinaryNode:
+            left = compileNode(compiler, node->left);
+            if(node->code == FormulaPow && exponent->kind == ConstantNode){
+                r = compilePower(compiler, node->left, left, exponent->value);
+                break;
+            }
+            right = compileNode(compiler, node->right);
+            r = emitNodes(compiler, node->code, node->left, left, node->right, right);
+            break;
+        default:
+            r = compileTerm(compiler, node);
+    }
+    compiler->registers[index] = r;
+    return r;
+}
+
+/*!
+ * Fills the registers a program reads without writing, n and its constants, for the first lanes lanes.
+ */
+static void loadConstants(const FormulaProgram* program, double (*registers)[FORMULA_BLOCK], int lanes, int numDim){
+    for(int k = 0; k < lanes; k++)
+        registers[SizeRegister][k] = numDim;
+    for(int c = 0; c < program->numConstants; c++){
+        for(int k = 0; k < lanes; k++)
+            registers[program->constantRegisters[c]][k] = program->constants[c];
+    }
+}
+
+/*!
+ * The number of lanes covering count lanes in whole groups of FORMULA_LANE_GROUP, which every runner may read.
+ */
+static int laneGroups(int count){
+    return (count + FORMULA_LANE_GROUP - 1) / FORMULA_LANE_GROUP * FORMULA_LANE_GROUP;
+}
+
+/*!
+ * Evaluates a single vector, one lane per term. Every sum or product runs over the vector a block at a time, keeping a
+ * running total per lane which is only folded together once the vector is done.
+ */
+static double evaluateFormula(const Formula* formula, const Real* vector, int numDim){
+    double registers[FORMULA_MAX_REGISTERS][FORMULA_BLOCK], /*!< The registers of the programs*/
+    partial[FORMULA_BLOCK], /*!< The running total of every lane*/
+    totals[FORMULA_MAX_SUMS]; /*!< The result of every sum or product*/
+    for(int s = 0; s < formula->numTerms; s++){
+        const FormulaProgram* term = &formula->terms[s]; /*!< The program of the term*/
+        int count = term->pairs ? numDim - 1 : numDim, /*!< The number of terms*/
+        lanes = laneGroups(count < FORMULA_BLOCK ? count : FORMULA_BLOCK); /*!< The lanes filled*/
+        loadConstants(term, registers, lanes, numDim);
+        for(int k = 0; k < lanes; k++)
+            partial[k] = term->product ? 1.0 : 0.0;
+        /*!
+         * Load the elements of every block, padding the lanes past the last one with zeros, and run the term over it.
+         */
+        for(int start = 0; start < count; start += FORMULA_BLOCK){
+            int block = count - start < FORMULA_BLOCK ? count - start : FORMULA_BLOCK; /*!< The terms in this block*/
+            for(int k = 0; k < block; k++){
+                registers[ElementRegister][k] = vector[start + k];
+                registers[IndexRegister][k] = start + k;
+            }
+            if(term->pairs){
+                for(int k = 0; k < block; k++)
+                    registers[NextRegister][k] = vector[start + k + 1];
+            }
+            for(int k = block; k < lanes; k++){
+                registers[ElementRegister][k] = 0.0;
+                registers[NextRegister][k] = 0.0;
+                registers[IndexRegister][k] = start + k;
+            }
+            formulaRunner(term, registers, block, partial);
+        }
+        totals[s] = term->product ? 1.0 : 0.0;
+        for(int k = 0; k < lanes; k++)
+            totals[s] = term->product ? totals[s] * partial[k] : totals[s] + partial[k];
+    }
+    loadConstants(&formula->combine, registers, FORMULA_LANE_GROUP, numDim);
+    for(int s = 0; s < formula->numTerms; s++){
+        for(int k = 0; k < FORMULA_LANE_GROUP; k++)
+            registers[formula->termRegisters[s]][k] = totals[s];
+    }
+    formulaRunner(&formula->combine, registers, 1, NULL);
+    return registers[formula->combine.result][0];
+}
+
+/*!
+ * Evaluates count vectors stored one row per element with the signature of EquationBatch, one lane per vector. Every
+ * block of vectors runs the term of a sum or product once per element, with every lane keeping the total of its vector.
+ */
+static void evaluateFormulaBatch(const Formula* formula, const Real* columns, int stride, int count, int numDim, double* fitness){
+    double registers[FORMULA_MAX_REGISTERS][FORMULA_BLOCK], /*!< The registers of the programs*/
+    partials[FORMULA_MAX_SUMS][FORMULA_BLOCK]; /*!< The total of every sum or product of every vector of the block*/
+    for(int v = 0; v < count; v += FORMULA_BLOCK){
+        int block = count - v < FORMULA_BLOCK ? count - v : FORMULA_BLOCK, /*!< The vectors in this block*/
+        lanes = laneGroups(block); /*!< The lanes filled*/
+        for(int s = 0; s < formula->numTerms; s++){
+            const FormulaProgram* term = &formula->terms[s]; /*!< The program of the term*/
+            int terms = term->pairs ? numDim - 1 : numDim; /*!< The number of terms*/
+            loadConstants(term, registers, lanes, numDim);
+            for(int k = 0; k < lanes; k++){
+                partials[s][k] = term->product ? 1.0 : 0.0;
+                registers[ElementRegister][k] = 0.0;
+                registers[NextRegister][k] = 0.0;
+            }
+            /*!
+             * Load element j of every vector of the block, and the element following it for the pairs, and run the term.
+             */
+            for(int j = 0; j < terms; j++){
+                const Real* row = columns + (size_t)j * stride + v; /*!< Element j of the first vector of the block*/
+                for(int k = 0; k < block; k++)
+                    registers[ElementRegister][k] = row[k];
+                if(term->pairs){
+                    for(int k = 0; k < block; k++)
+                        registers[NextRegister][k] = row[stride + k];
+                }
+                for(int k = 0; k < lanes; k++)
+                    registers[IndexRegister][k] = j;
+                formulaRunner(term, registers, block, partials[s]);
+            }
+        }
+        loadConstants(&formula->combine, registers, lanes, numDim);
+        for(int s = 0; s < formula->numTerms; s++){
+            for(int k = 0; k < lanes; k++)
+                registers[formula->termRegisters[s]][k] = partials[s][k];
+        }
+        formulaRunner(&formula->combine, registers, block, NULL);
+        for(int k = 0; k < block; k++)
+            fitness[v + k] = registers[formula->combine.result][k];
+    }
+}
+
+/*!
+ * Defines the EquationFunction and EquationBatch of the formula in a slot of the registry. They take no context, so
+ * every slot has its own pair, each forwarding to the formula stored in its slot.
+ */
+#define FORMULA_SLOT(slot) \
+static double formulaEvaluate##slot(const Real* vector, int numDim){ \
+    return evaluateFormula(&formulas[slot], vector, numDim); \
+} \
+static void formulaBatch##slot(const Real* columns, int stride, int count, int numDim, double* fitness){ \
+    evaluateFormulaBatch(&formulas[slot], columns, stride, count, numDim, fitness); \
+}
+
+FORMULA_SLOT(0)
+FORMULA_SLOT(1)
+FORMULA_SLOT(2)
+FORMULA_SLOT(3)
+FORMULA_SLOT(4)
+FORMULA_SLOT(5)
+FORMULA_SLOT(6)
+FORMULA_SLOT(7)
+
+#undef FORMULA_SLOT
+
+//! The functions of every slot of the registry evaluating a single vector, in slot order
+static const EquationFunction slotEvaluates[MAX_NUM_FORMULAS] = {
+    &formulaEvaluate0, &formulaEvaluate1, &formulaEvaluate2, &formulaEvaluate3,
+    &formulaEvaluate4, &formulaEvaluate5, &formulaEvaluate6, &formulaEvaluate7
+};
+
+//! The batch functions of every slot of the registry, in slot order
+static const EquationBatch slotBatches[MAX_NUM_FORMULAS] = {
+    &formulaBatch0, &formulaBatch1, &formulaBatch2, &formulaBatch3,
+    &formulaBatch4, &formulaBatch5, &formulaBatch6, &formulaBatch7
+};
+
+int compileFormula(const char* name, double lower, double upper, const char* text){
+    static FormulaParser parser; /*!< The parser, kept off the stack as it holds every node of the formula*/
+    static FormulaCompiler compiler; /*!< The compiler of the program combining the sums and products*/
+    Formula* formula = &formulas[numFormulas]; /*!< The formula being compiled*/
+    int root; /*!< The node of the whole formula*/
+    if(numFormulas == MAX_NUM_FORMULAS){
+        printf("Too many objective formulas were given. Please give at most %d and try again.\n", MAX_NUM_FORMULAS);
+        return -1;
+    }
+    if(!(lower < upper)){
+        printf("The objective formula %s needs a lower bound below its upper bound. Please check the input file and try again.\n", name);
+        return -1;
+    }
+    /*!
+     * Parse the whole formula, and if it could not be read or anything follows it tell the user where and return failure.
+     */
+    memset(&parser, 0, sizeof(parser));
+    parser.text = text;
+    root = parseExpression(&parser);
+    skipSpaces(&parser);
+    if(root >= 0 && parser.text[parser.pos] != '\0')
+        root = parseError(&parser, "unexpected character");
+    if(root < 0){
+        printf("The objective formula %s could not be read at character %d: %s. Please check the input file and try again.\n", name, parser.pos + 1, parser.error);
+        return -1;
+    }
+    memset(formula, 0, sizeof(Formula));
+    startCompiler(&compiler, &formula->combine, &parser, formula, root);
+    if((formula->combine.result = compileNode(&compiler, root)) < 0){
+        printf("The objective formula %s could not be compiled: %s. Please check the input file and try again.\n", name, compiler.error);
+        return -1;
+    }
+    formula->lower = lower;
+    formula->upper = upper;
+    formulaNames[numFormulas] = malloc(strlen(name) + 1);
+    strcpy(formulaNames[numFormulas], name);
+    return FIRST_FORMULA_EQUATION + numFormulas++;
+}
+
+char* formulaName(int equation){
+    return formulaNames[equation - FIRST_FORMULA_EQUATION];
+}
+
+void formulaRange(int equation, double* range){
+    range[RANGE_MIN_POS] = formulas[equation - FIRST_FORMULA_EQUATION].lower;
+    range[RANGE_MAX_POS] = formulas[equation - FIRST_FORMULA_EQUATION].upper;
+}
+
+Objective formulaObjective(int equation, int dimensions){
+    int slot = equation - FIRST_FORMULA_EQUATION; /*!< The slot of the formula in the registry*/
+    Objective objective; /*!< Declare the functions of the run to be returned*/
+    objective.equation = equation;
+    objective.dimensions = dimensions;
+    objective.function = slotEvaluates[slot];
+    objective.anySize = objective.function;
+    objective.batch = slotBatches[slot];
+    objective.rows = NULL;
+    objective.delta = NULL;
+    objective.gradient = NULL; ///refined with finite differences by src/Memetic.h
+    return objective;
+}
+
+void installFormulaRunner(const void* runner){
+    if(runner)
+        formulaRunner = runner;
+}
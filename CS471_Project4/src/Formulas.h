@@ -0,0 +1,62 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Formulas.h
+ * \brief This is where the objective functions written as formulas in the init file are compiled and registered.
+ *
+ *  Every formula named in the optional 'Objective Formulas' line of the init file is parsed once while the init file is
+ *  read and compiled to the register bytecode of src/Bytecode.h, one program for the term of every sum or product and
+ *  one combining them. A formula takes the next position from FIRST_FORMULA_EQUATION on, and formulaObjective hands
+ *  resolveObjective in src/Utilities.h a function and a batch function for it like the kernels of the built in ones, so
+ *  it runs in every algorithm unchanged.
+ *
+ *  A formula is an expression of numbers, pi, e, n (the number of dimensions), + - * / ^, parentheses and the functions
+ *  sin, cos, exp, log, sqrt, abs and pow(a, b), around any number of sum(...) and prod(...). Inside a sum or product,
+ *  which cannot be nested, x[i], x[i+1] and i (starting at 0) are the terms, so e.g. Rastrigin is
+ *  10*n + sum(x[i]^2 - 10*cos(2*pi*x[i])). A term reading x[i+1] runs over the n - 1 neighbouring pairs, any other over
+ *  all n elements.
+ */
+#ifndef TESTINGSUITE_FORMULAS_H
+#define TESTINGSUITE_FORMULAS_H
+
+#include "Utilities.h"
+
+/// \fn int compileFormula(const char* name, double lower, double upper, const char* text)
+/// \brief Parses a formula, compiles it to bytecode and registers it under name, after the plugin slots and the
+/// formulas compiled before it.
+///
+/// \param name - the name of the function, used in the output and the names of the result files
+/// \param lower - the lowest value of every coordinate
+/// \param upper - the highest value of every coordinate
+/// \param text - the formula
+/// \return the EquationPosition of the function, or -1 if it could not be compiled, having told the user why
+int compileFormula(const char* name, double lower, double upper, const char* text);
+/// \fn char* formulaName(int equation)
+/// \brief Returns the name a formula was registered under.
+///
+/// \param equation - the position of the formula, at least FIRST_FORMULA_EQUATION
+/// \return the name of the formula
+char* formulaName(int equation);
+/// \fn void formulaRange(int equation, double* range)
+/// \brief Stores the bounds a formula was registered with into a range.
+///
+/// \param equation - the position of the formula, at least FIRST_FORMULA_EQUATION
+/// \param range - the range, RANGE_SIZE values
+void formulaRange(int equation, double* range);
+/// \fn Objective formulaObjective(int equation, int dimensions)
+/// \brief Looks up the functions evaluating a formula at the size of one run, called by resolveObjective for every
+/// position from FIRST_FORMULA_EQUATION on.
+///
+/// \param equation - the position of the formula, at least FIRST_FORMULA_EQUATION
+/// \param dimensions - the number of dimensions of every vector of the run
+/// \return the functions of the run
+Objective formulaObjective(int equation, int dimensions);
+/// \fn void installFormulaRunner(const void* runner)
+/// \brief Runs every formula with the runner of an instruction set from formulaKernel in src/SimdEquations.h, called by
+/// installEquationKernels before any threads are started.
+///
+/// \param runner - a function with the signature of FormulaRunner in src/Bytecode.h, or NULL to keep the scalar runner
+void installFormulaRunner(const void* runner);
+
+#endif //TESTINGSUITE_FORMULAS_H
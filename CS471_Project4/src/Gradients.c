@@ -0,0 +1,299 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Gradients.c
+ * \brief This is where the methods defined in src/Gradients.h are implemented.
+ *
+ *  Every term below returns the value of a term written exactly as the term summed by the functions in src/Equations.c,
+ *  and stores the partial derivatives of the term with respect to its element and next element. The terms are added
+ *  with addCompensated of src/Summation.h in the same order as the references, so the fitness matches them bit for bit.
+ */
+#include "Gradients.h"
+#include "Utilities.h"
+#include "Summation.h"
+#include "CpuFeatures.h"
+
+/*!
+ * A single term of a sum, given the element, the next element for pair terms, and the index of the term, which stores
+ * the partial derivatives of the term with respect to the element and the next element.
+ */
+typedef double (*GradientTerm)(double element, double nextElem, int index, double* dElement, double* dNext);
+
+/*!
+ * The derivative of sqrt(fabs(value)), taken as 0 at 0 where it is unbounded.
+ */
+static double rootSlope(double value){
+    if(value == 0.0)
+        return 0.0;
+    return (value > 0.0 ? 0.5 : -0.5) / sqrt(fabs(value));
+}
+
+/*!
+ * The sign of a value, taken as 0 at 0.
+ */
+static double signOf(double value){
+    return value > 0.0 ? 1.0 : (value < 0.0 ? -1.0 : 0.0);
+}
+
+static double schwefelTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)nextElem; (void)index; (void)dNext;
+    double root = sqrt(fabs(element)); /*!< sqrt(|element|), whose derivative times the element is root / 2*/
+    *dElement = -sin(root) - cos(root) * root / 2.0;
+    return (-1.0 * element) * sin(sqrt(fabs(element)));
+}
+static double deJongTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)nextElem; (void)index; (void)dNext;
+    *dElement = 2.0 * element;
+    return pow(element, 2.0);
+}
+static double rosenbrockTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)index;
+    double valley = pow(element, 2.0) - nextElem; /*!< The distance of the next element from the square of the element*/
+    *dElement = 400.0 * element * valley - 2.0 * (1.0 - element);
+    *dNext = -200.0 * valley;
+    return (100.0 * pow(pow(element, 2.0) - nextElem, 2.0)) + pow((1.0 - element), 2.0);
+}
+static double rastgrinTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)nextElem; (void)index; (void)dNext;
+    *dElement = 2.0 * element + 20.0 * M_PI * sin(2.0 * M_PI * element);
+    return pow(element, 2.0) - (10.0 * cos(2.0 * M_PI * element));
+}
+static double sineEnvTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)index;
+    double radius = pow(element, 2.0) + pow(nextElem, 2.0), /*!< The squared distance of the pair from the origin*/
+    wave = pow(radius - 0.5, 2.0), /*!< The argument of the sine*/
+    damping = 1.0 + 0.001 * radius, /*!< The square root of the denominator*/
+    slope = 2.0 * (radius - 0.5) * cos(wave) / pow(damping, 2.0) - 0.002 * sin(wave) / pow(damping, 3.0); /*!< The derivative of the term by the radius*/
+    *dElement = slope * 2.0 * element;
+    *dNext = slope * 2.0 * nextElem;
+    return 0.5 + (sin(pow( pow(element, 2.0) +  pow(nextElem, 2.0) - 0.5,2.0))/pow(1.0 + 0.001*(pow(element, 2.0) +  pow(nextElem, 2.0)), 2.0));
+}
+static double stretchVTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)index;
+    double radius = pow(element, 2.0) + pow(nextElem, 2.0), /*!< The squared distance of the pair from the origin*/
+    stretch = 50.0 * pow(radius, 0.1), /*!< The root of the argument of the sine*/
+    slope = 0.0; /*!< The derivative of the term by the radius, unbounded at the origin*/
+    if(radius > 0.0)
+        slope = 0.25 * pow(radius, -0.75) * sin(pow(stretch, 2.0)) + 10.0 * stretch * pow(radius, -0.65) * cos(pow(stretch, 2.0));
+    *dElement = slope * 2.0 * element;
+    *dNext = slope * 2.0 * nextElem;
+    return pow(pow(element, 2.0) +  pow(nextElem, 2.0), 0.25) * sin(pow(50.0 * pow(pow(element, 2.0) +  pow(nextElem, 2.0), 0.1),2.0)) + 1.0;
+}
+static double ackleyOneTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)index;
+    double distance = sqrt(pow(element, 2.0) + pow(nextElem, 2.0)), /*!< The distance of the pair from the origin*/
+    scale = distance > 0.0 ? (1.0/exp(0.2)) / distance : 0.0; /*!< The derivative of the distance term over the coordinate*/
+    *dElement = scale * element - 6.0 * sin(2.0 * element);
+    *dNext = scale * nextElem + 6.0 * cos(2.0 * nextElem);
+    return ((1.0/exp(0.2))*sqrt(pow(element, 2.0) +  pow(nextElem, 2.0))) +  3.0 * (cos(2.0 * element) + sin(2.0 * nextElem));
+}
+static double ackleyTwoTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)index;
+    double distance = sqrt((pow(element, 2.0) + pow(nextElem, 2.0)) / 2.0), /*!< The root mean square of the pair*/
+    scale = distance > 0.0 ? 2.0 / (exp(0.2 * distance) * distance) : 0.0, /*!< The derivative of the exponential of the distance over the coordinate*/
+    cosines = exp(0.5*(cos(2.0 * M_PI * element) + cos(2.0 * M_PI * nextElem))); /*!< The exponential of the cosines*/
+    *dElement = scale * element + M_PI * sin(2.0 * M_PI * element) * cosines;
+    *dNext = scale * nextElem + M_PI * sin(2.0 * M_PI * nextElem) * cosines;
+    return 20.0 + exp(1.0) - (20.0/exp(0.2 * sqrt((pow(element, 2.0) +  pow(nextElem, 2.0)) / 2.0))) - exp(0.5*(cos(2.0 * M_PI * element) + cos(2.0 * M_PI * nextElem)));
+}
+static double eggHolderTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)index;
+    double first = element - nextElem - 47, /*!< The argument of the first root*/
+    second = nextElem + 47 + (element / 2.0), /*!< The argument of the second root*/
+    firstSlope = cos(sqrt(fabs(first))) * rootSlope(first), /*!< The derivative of the first sine by its argument*/
+    secondSlope = cos(sqrt(fabs(second))) * rootSlope(second); /*!< The derivative of the second sine by its argument*/
+    *dElement = -sin(sqrt(fabs(first))) - element * firstSlope - (nextElem + 47) * secondSlope * 0.5;
+    *dNext = element * firstSlope - sin(sqrt(fabs(second))) - (nextElem + 47) * secondSlope;
+    return (-1.0 * element * sin(sqrt(fabs(element - nextElem - 47)))) - ((nextElem + 47) * sin(sqrt(fabs(nextElem + 47 + (element / 2.0)))));
+}
+static double ranaTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)index;
+    double difference = nextElem - element + 1.0, /*!< The argument of the first root*/
+    total = nextElem + element + 1.0, /*!< The argument of the second root*/
+    sinA = sin(sqrt(fabs(difference))), cosA = cos(sqrt(fabs(difference))),
+    sinB = sin(sqrt(fabs(total))), cosB = cos(sqrt(fabs(total))),
+    slopeA = element * cosA * cosB - (nextElem + 1.0) * sinA * sinB, /*!< The derivative of the term by the first root*/
+    slopeB = -element * sinA * sinB + (nextElem + 1.0) * cosA * cosB; /*!< The derivative of the term by the second root*/
+    *dElement = sinA * cosB - slopeA * rootSlope(difference) + slopeB * rootSlope(total);
+    *dNext = cosA * sinB + slopeA * rootSlope(difference) + slopeB * rootSlope(total);
+    return (element * sin(sqrt(fabs(nextElem - element + 1.0))) * cos(sqrt(fabs(nextElem + element + 1.0))))
+           + ((nextElem + 1.0) * cos(sqrt(fabs(nextElem - element + 1.0))) * sin(sqrt(fabs(nextElem + element + 1.0))));
+}
+static double pathologicalTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)index;
+    double wave = 100.0 * pow(element, 2.0) + pow(nextElem, 2.0), /*!< The argument of the sine*/
+    numerator = sin(wave) - 0.5,
+    spread = pow(element - nextElem, 2.0), /*!< The squared difference of the pair*/
+    denominator = 1.0 + 0.001 * pow(spread, 2.0),
+    spreadSlope = 0.004 * spread * (element - nextElem); /*!< The derivative of the denominator by the element*/
+    *dElement = (cos(wave) * 200.0 * element * denominator - numerator * spreadSlope) / pow(denominator, 2.0);
+    *dNext = (cos(wave) * 2.0 * nextElem * denominator + numerator * spreadSlope) / pow(denominator, 2.0);
+    return 0.5 + ((sin(pow(sqrt((100.0 * pow(element, 2.0)) + pow(nextElem, 2.0)),2.0)) - 0.5)
+                  /(1.0 + (0.001 * pow(pow(element, 2.0) - (2.0 * element * nextElem) + pow(nextElem, 2.0), 2.0))));
+}
+static double michalewiczTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)nextElem; (void)dNext;
+    double angle = ((index+1) * pow(element, 2.0)) / M_PI, /*!< The argument of the steep sine*/
+    steep = sin(angle);
+    *dElement = cos(element) * pow(steep, 20.0) + sin(element) * 20.0 * pow(steep, 19.0) * cos(angle) * 2.0 * (index+1) * element / M_PI;
+    return sin(element) * pow(sin(((index+1) * pow(element, 2.0)) / M_PI), 20.0);
+}
+static double mastersTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)index;
+    double form = pow(element, 2.0) + pow(nextElem, 2.0) + (0.5 * nextElem * element), /*!< The quadratic form of the pair*/
+    decay = exp((-1.0 / 8.0) * form),
+    slope = -decay * cos(pow(form, 0.25)) / 8.0; /*!< The derivative of the term by the form*/
+    if(form > 0.0)
+        slope -= decay * sin(pow(form, 0.25)) * 0.25 * pow(form, -0.75);
+    *dElement = slope * (2.0 * element + 0.5 * nextElem);
+    *dNext = slope * (2.0 * nextElem + 0.5 * element);
+    return exp((-1.0 / 8.0) *(pow(element, 2.0) + pow(nextElem, 2.0) + (0.5 * nextElem * element)))
+           * cos(pow(pow(element, 2.0) + pow(nextElem, 2.0) + (0.5 * nextElem * element), 0.25));
+}
+static double quarticTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)nextElem; (void)dNext;
+    *dElement = 4.0 * (index + 1.0) * pow(element, 3.0);
+    return (index + 1.0) * pow(element, 4.0);
+}
+static double stepTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)nextElem; (void)index; (void)dNext;
+    *dElement = 2.0 * (fabs(element) + 0.5) * signOf(element);
+    return pow(fabs(element) + 0.5, 2.0);
+}
+static double alpineTerm(double element, double nextElem, int index, double* dElement, double* dNext){
+    (void)nextElem; (void)index; (void)dNext;
+    double inner = (element * sin(element)) + (0.1 * element); /*!< The value inside the absolute value*/
+    *dElement = signOf(inner) * (sin(element) + element * cos(element) + 0.1);
+    return fabs(inner);
+}
+
+/*!
+ * Calculates the fitness as constantPerDim * numDim + (scale + scalePerDim * numDim) * the sum of the terms, and adds
+ * the derivatives of every term scaled the same way into the gradient. Every function below inlines it with its own
+ * term, so the term is inlined into the loop instead of called through a pointer.
+ */
+static ALWAYS_INLINE double gradientSum(int pairs, GradientTerm term, double constantPerDim, double scale, double scalePerDim,
+                                        const Real* vector, int numDim, double* gradient){
+    int numTerms = pairs ? numDim - 1 : numDim; /*!< The number of terms in the sum*/
+    double factor = scale + scalePerDim * numDim, /*!< The scale of the sum*/
+    dElement, /*!< The derivative of the current term by its element*/
+    dNext = 0.0; /*!< The derivative of the current term by its next element*/
+    CompensatedSum sum = {0.0, 0.0}; /*!< The compensated sum of the terms*/
+    for(int j = 0; j < numDim; j++)
+        gradient[j] = 0.0;
+    /*!
+     * Loop through the terms, adding each to the sum and its derivatives to the coordinates it uses.
+     */
+    for(int t = 0; t < numTerms; t++){
+        addCompensated(&sum, term(vector[t], pairs ? vector[t + 1] : 0.0, t, &dElement, &dNext));
+        gradient[t] += factor * dElement;
+        if(pairs)
+            gradient[t + 1] += factor * dNext;
+    }
+    return constantPerDim * numDim + factor * compensatedTotal(&sum);
+}
+
+/*!
+ * Defines the gradient function of an objective function from the shape of its sum, its term, its constant and its scale.
+ */
+#define GRADIENT_FUNCTION(name, pairs, constantPerDim, scale, scalePerDim) \
+static double name##Gradient(const Real* vector, int numDim, double* gradient){ \
+    return gradientSum(pairs, name##Term, constantPerDim, scale, scalePerDim, vector, numDim, gradient); \
+}
+
+GRADIENT_FUNCTION(schwefel, 0, 418.9829, -1.0, 0.0)
+GRADIENT_FUNCTION(deJong, 0, 0.0, 1.0, 0.0)
+GRADIENT_FUNCTION(rosenbrock, 1, 0.0, 1.0, 0.0)
+GRADIENT_FUNCTION(rastgrin, 0, 0.0, 0.0, 10.0)
+GRADIENT_FUNCTION(sineEnv, 1, 0.0, -1.0, 0.0)
+GRADIENT_FUNCTION(stretchV, 1, 0.0, 1.0, 0.0)
+GRADIENT_FUNCTION(ackleyOne, 1, 0.0, 1.0, 0.0)
+GRADIENT_FUNCTION(ackleyTwo, 1, 0.0, 1.0, 0.0)
+GRADIENT_FUNCTION(eggHolder, 1, 0.0, 1.0, 0.0)
+GRADIENT_FUNCTION(rana, 1, 0.0, 1.0, 0.0)
+GRADIENT_FUNCTION(pathological, 1, 0.0, 1.0, 0.0)
+GRADIENT_FUNCTION(michalewicz, 0, 0.0, -1.0, 0.0)
+GRADIENT_FUNCTION(masters, 1, 0.0, -1.0, 0.0)
+GRADIENT_FUNCTION(quartic, 0, 0.0, 1.0, 0.0)
+GRADIENT_FUNCTION(step, 0, 0.0, 1.0, 0.0)
+GRADIENT_FUNCTION(alpine, 0, 0.0, 1.0, 0.0)
+
+#undef GRADIENT_FUNCTION
+
+/*!
+ * Griewangk multiplies its cosines, so the derivative of the product by a coordinate is the product of every other
+ * cosine. The products of the cosines before every coordinate are kept in the gradient on the way forward and combined
+ * with the products of the cosines after it on the way back, which needs no division by a cosine which may be 0.
+ */
+static double griewangkGradient(const Real* vector, int numDim, double* gradient){
+    double multValue = 0.0, /*!< The product of the cosines, multiplied in the order of griewangkHost*/
+    before = 1.0, /*!< The product of the cosines before the current coordinate*/
+    after = 1.0, /*!< The product of the cosines after the current coordinate*/
+    element;
+    CompensatedSum sum = {0.0, 0.0}; /*!< The compensated sum of the terms*/
+    for(int j = 0; j < numDim; j++){
+        element = vector[j];
+        addCompensated(&sum, pow(element, 2.0) / 4000.0);
+        if(j == 0)
+            multValue = cos(element / sqrt(j+1.0));
+        else
+            multValue *= cos(element / sqrt(j+1.0));
+        gradient[j] = before;
+        before *= cos(element / sqrt(j+1.0));
+    }
+    for(int j = numDim - 1; j >= 0; j--){
+        element = vector[j];
+        gradient[j] = element / 2000.0 + sin(element / sqrt(j+1.0)) / sqrt(j+1.0) * gradient[j] * after;
+        after *= cos(element / sqrt(j+1.0));
+    }
+    return 1.0 + compensatedTotal(&sum) - multValue;
+}
+
+/*!
+ * Levy adds the term of Wn once for every other element, so the last coordinate collects numDim - 1 copies of its
+ * derivative, and the first coordinate collects the derivative of the W0 term outside of the sum.
+ */
+static double levyGradient(const Real* vector, int numDim, double* gradient){
+    double levyFirstConst = 1.0 + ((vector[0] - 1.0) /4.0), /*!< W0 of the vector*/
+    levyLastConst = 1.0 + ((vector[numDim - 1] - 1.0) /4.0), /*!< Wn of the vector*/
+    lastTerm = pow(levyLastConst - 1.0, 2.0) * (1.0 + pow(sin(2.0 * M_PI * levyLastConst), 2.0)), /*!< The part of every term from Wn*/
+    wi; /*!< Wi of the current element*/
+    CompensatedSum sum = {0.0, 0.0}; /*!< The compensated sum of the terms*/
+    for(int j = 0; j < numDim - 1; j++){
+        wi = 1.0 + ((vector[j] - 1.0)/4.0);
+        addCompensated(&sum, (pow(wi - 1.0, 2.0) * (1.0 + 10.0 * pow(sin((M_PI * wi) + 1.0), 2.0))) + lastTerm);
+        gradient[j] = 0.25 * (2.0 * (wi - 1.0) * (1.0 + 10.0 * pow(sin((M_PI * wi) + 1.0), 2.0))
+                              + 10.0 * M_PI * pow(wi - 1.0, 2.0) * sin(2.0 * ((M_PI * wi) + 1.0)));
+    }
+    gradient[numDim - 1] = (numDim - 1) * 0.25 * (2.0 * (levyLastConst - 1.0) * (1.0 + pow(sin(2.0 * M_PI * levyLastConst), 2.0))
+                                                + 2.0 * M_PI * pow(levyLastConst - 1.0, 2.0) * sin(4.0 * M_PI * levyLastConst));
+    gradient[0] += 0.25 * M_PI * sin(2.0 * M_PI * levyFirstConst);
+    return pow(sin(M_PI * levyFirstConst), 2.0) + compensatedTotal(&sum);
+}
+
+//! The gradient functions of the objective functions, in the order of the EquationPosition enum in src/Utilities.h
+static const EquationGradient gradientFunctions[NUM_BUILTIN_EQUATIONS] = {
+    &schwefelGradient,
+    &deJongGradient,
+    &rosenbrockGradient,
+    &rastgrinGradient,
+    &griewangkGradient,
+    &sineEnvGradient,
+    &stretchVGradient,
+    &ackleyOneGradient,
+    &ackleyTwoGradient,
+    &eggHolderGradient,
+    &ranaGradient,
+    &pathologicalGradient,
+    &michalewiczGradient,
+    &mastersGradient,
+    &quarticGradient,
+    &levyGradient,
+    &stepGradient,
+    &alpineGradient
+};
+
+EquationGradient gradientFunction(int equation){
+    return gradientFunctions[equation];
+}
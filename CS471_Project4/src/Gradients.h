@@ -0,0 +1,34 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Gradients.h
+ * \brief This is where the analytic gradients of the objective functions in src/Equations.h are defined.
+ *
+ *  Every gradient function returns the fitness of a vector and stores its gradient in the same pass over the vector,
+ *  working out the partial derivatives of every term from the values the term is calculated from. The fitness is
+ *  calculated exactly as the scalar reference of src/Equations.h calculates it, so it is the same to the last bit.
+ *
+ *  The functions are differentiable almost everywhere. Where a term is not, at the kink of an absolute value or where
+ *  the derivative of a root is unbounded, the derivative of that piece is taken as 0, which is a subgradient of the
+ *  kinks of Step and Alpine and leaves the others to the line search of src/Memetic.h.
+ */
+#ifndef TESTINGSUITE_GRADIENTS_H
+#define TESTINGSUITE_GRADIENTS_H
+
+#include "Matrix.h"
+
+/*!
+ * The signature of the gradient functions, which return the fitness of a vector and store the partial derivative of
+ * the fitness with respect to every coordinate into gradient, numDim values.
+ */
+typedef double (*EquationGradient)(const Real* vector, int numDim, double* gradient);
+
+/// \fn EquationGradient gradientFunction(int equation)
+/// \brief Returns the gradient function of a built in objective function.
+///
+/// \param equation - the EquationPosition enum value in src/Utilities.h of the function
+/// \return the gradient function
+EquationGradient gradientFunction(int equation);
+
+#endif //TESTINGSUITE_GRADIENTS_H
@@ -16,36 +16,78 @@
 
 void* harmonicTest(void* data){
     EquationInfo info = *(EquationInfo*)data;
-    HPop* hpop = calloc(1, sizeof(HPop));
-    hpop->population = createMatrix(info);
-    allocateHPop(hpop, info.numVectors);
+    pinThread(info.cpu); ///pin before the arena is touched so its pages are placed on the node of this CPU
+    RandStream* rng = arenaAlloc(info.arena, 1, sizeof(RandStream)); /*!< Allocate the random number generator owned by this thread*/
+    seedRandStream(rng, info.cellSeed, info.randomMode);
+    info.rng = rng;
+    writeSeedManifest("H", info); ///record the seed of this run so it can be replayed on its own
+    HPop* hpop = arenaAlloc(info.arena, 1, sizeof(HPop));
+    hpop->rng = rng;
+    hpop->population = createRowPool(info.arena, info.numVectors, info.numVectors + 1, info.dimToTest); ///a row for every harmony and the scratch row the new harmony is built in
+    Matrix initial = poolMatrix(&hpop->population, info.numVectors); /*!< The rows of the population slots, which are in order until the first iteration*/
+    createMatrix(info, &initial);
+    allocateHPop(hpop, info.arena, info.numVectors, info.dimToTest);
+    hpop->move = createMoveLogs(info, 1); ///log where the new harmonic differs from the best harmony so it is evaluated by its delta
+    hpop->cache = createFitnessCache(info.arena, info.fitnessCache, info.dimToTest); ///remember the harmonies evaluated in full when the fitness cache line turned it on
+    Memetic* memetic = createMemetic(info); /*!< The refinement of the best harmony, NULL when it is off*/
     int iterations = info.iterations;
     double newResult = 0;
     struct timespec start, /*!< Declare the timespec struct storing the start time of the iterations*/
             end; /*!< Declare the timespec struct storing the end time of the iterations*/
     double totTMillSec; /*!< Declare the double storing the total runtime of all iterations in milliseconds*/
-    double** temp = allocateEmptyMatrix(info.numVectors, info.dimToTest);
-    evaluatePop(hpop->population, hpop->fitness, info.numVectors, info.dimToTest, info.equationNum, &hpop->bestPos, &hpop->worstPos, &hpop->bestFit, &hpop->worstFit);
+    evaluatePop(&initial, hpop->fitness, &info.objective, &hpop->bestPos, &hpop->worstPos, &hpop->bestFit, &hpop->worstFit);
+    storePopulation(hpop->cache, &initial, hpop->fitness);
+    long heapCalls = heapAllocationCount(); /*!< The heap allocations made by this thread before the iterations*/
     for(int i = 0; i < iterations; i++){
         clock_gettime(CLOCK_MONOTONIC, &start); /*!< Set the start time using a monotonic clock, meaning it will ignore if the system clock changes*/
+        setRandIteration(rng, i); ///random values drawn in this iteration are addressed by it
         harmonicIteration(hpop, info.dimToTest, info.numVectors, info.HMCR, info.PAR, info.bandwidth, info.range);
-        newResult = evaluateFitness(hpop->newHarmonic, info.dimToTest, info.equationNum);
+        if(hpop->move && moveIsSparse(hpop->move, hpop->moveAge[hpop->bestPos])) ///the new harmonic mostly repeats the values of a converged memory, so it is evaluated from the best harmony
+            newResult = evaluateMove(hpop->newHarmonic, &info.objective, hpop->move, hpop->bestFit, hpop->moveAge[hpop->bestPos], &hpop->newAge);
+        else
+            newResult = boundedHarmonic(hpop, info);
         if(newResult < hpop->bestFit){
             updateBest(hpop, newResult, info);
         }else if(newResult <= hpop->worstFit){
             newVector(hpop, newResult, info);
         }
-        free(hpop->newHarmonic);
+        if(refinementDue(memetic, i))
+            refineHarmonies(hpop, memetic, info); ///polish the best harmony with a few quasi-Newton steps
         clock_gettime(CLOCK_MONOTONIC, &end);/*!< Store the end time*/
         totTMillSec = (double)((end.tv_sec - start.tv_sec) * MS_PER_SEC) +  ((end.tv_nsec - start.tv_nsec) / (double) NS_PER_MS); /*!< Calculate the total runtime by subtracting end time's seconds from the start time's seconds and converting to milliseconds and adding the end time's nanoseconds minus the start time's nanoseconds and converting to milliseconds*/
         ///write the best and worst to a file
         writeResultToFile(hpop->bestFit, hpop->worstFit, "H", i, totTMillSec, info);
         if(info.currExperiment == info.printExperiment) {
             ///write the new population to a log file
-            writePopulationLogToFile(hpop->population, "H", i, info);
+            writePopulationLogToFile(&hpop->population.rows, hpop->population.slots, "H", i, info);
         }
     }
-    freeHPop(hpop, info.numVectors);
+    recordHeapAllocations(heapAllocationCount() - heapCalls); ///every buffer should have come from the arena before the first iteration
+    recordCutShort(hpop->bounded, hpop->cutShort);
+    recordCacheHits(hpop->cache);
+    recordRefinements(memetic);
+    ///every buffer of H is released when the arena is reset for the next experiment
+}
+
+double boundedHarmonic(HPop* pop, EquationInfo info){
+    double bound = info.bounded == BoundedOn ? pop->worstFit : INFINITY; /*!< The fitness the new harmonic has to reach to be kept*/
+    double result; /*!< The fitness of the new harmonic*/
+    uint64_t hash = 0; /*!< The hash of the new harmonic when the cache is on*/
+    int cutShort, /*!< Whether the evaluation stopped early*/
+    counted; /*!< Whether the evaluation could stop early*/
+    pop->newAge = 0; ///evaluated in full, unless it was cut short and is not kept
+    if(pop->cache){
+        hash = hashVector(pop->newHarmonic, info.dimToTest);
+        if(lookupFitness(pop->cache, pop->newHarmonic, hash, &result)) ///the same harmony was evaluated in full before
+            return result;
+    }
+    counted = canCutShort(&info.objective, bound);
+    result = evaluateBounded(pop->newHarmonic, &info.objective, bound, &cutShort);
+    pop->bounded += counted;
+    pop->cutShort += cutShort;
+    if(pop->cache && !cutShort) ///a fitness cut short is only a bound, so it is never stored
+        storeFitness(pop->cache, pop->newHarmonic, hash, result);
+    return result;
 }
 
 void updateBest(HPop* pop, double newResult, EquationInfo info){
@@ -56,12 +98,12 @@ void updateBest(HPop* pop, double newResult, EquationInfo info){
 
 void newVector(HPop* pop, double newResult, EquationInfo info){
     pop->fitness[pop->worstPos] = newResult;
-    copyArray(pop->newHarmonic, pop->population[pop->worstPos], info.dimToTest);
+    pop->moveAge[pop->worstPos] = pop->newAge;
+    acceptScratch(&pop->population, pop->worstPos); ///the worst slot takes the scratch row holding the new harmonic instead of a copy
     evalNewWorst(pop->fitness, info.numVectors, newResult, &pop->worstPos, &pop->worstFit);
 }
 
-void pitchAdjustment(double* harmonic,int position, double bandwidth, const double* range){
-    double rand = genDblInRange(-1,1);
+void pitchAdjustment(double rand, Real* harmonic,int position, double bandwidth, const double* range){
     double temp = harmonic[position];
 
     temp += rand * bandwidth;
@@ -79,17 +121,46 @@ void pitchAdjustment(double* harmonic,int position, double bandwidth, const doub
 }
 
 void harmonicIteration(HPop* hpop, int NI, int HMS, double HMCR, double PAR, double bandwidth, const double* range){
-    double* newHarmonic = calloc(NI, sizeof(double));
+    Real* newHarmonic = poolScratch(&hpop->population); /*!< The new harmonic is built in the scratch row of the population*/
+    const Real* best = poolRow(&hpop->population, hpop->bestPos); /*!< The best harmony, which the changes of the new harmonic are logged against*/
+    double* considerRand = hpop->randBuf, /*!< The random scalars deciding whether to consider the harmony memory*/
+    *pitchRand = hpop->randBuf + NI, /*!< The random scalars deciding whether to adjust the pitch*/
+    *valueRand = hpop->randBuf + 2 * NI; /*!< The random scalars used for the adjustment or the new random value*/
+    /*!
+     * Generate all of the random values needed for this iteration in bulk before building the new harmonic.
+     */
+    fillDblAt(hpop->rng, RandHarmony, 0, 0, hpop->randBuf, HARMONIC_RANDS_PER_DIM * NI, 0, 1);
+    fillNonNegIntAt(hpop->rng, RandHarmonyIndex, 0, 0, hpop->randIdx, NI, HMS);
+    if(hpop->move)
+        resetMoveLog(hpop->move);
 
     for(int i = 0; i < NI; i++){
-        if(genDblInRange(0, 1) < HMCR){
-            newHarmonic[i] = hpop->population[genNonNegInt(HMS)][i];
-            if(genDblInRange(0, 1) < PAR){
-                pitchAdjustment(newHarmonic, i, bandwidth, range);
+        if(considerRand[i] < HMCR){
+            newHarmonic[i] = poolRow(&hpop->population, hpop->randIdx[i])[i];
+            if(pitchRand[i] < PAR){
+                pitchAdjustment(2.0 * valueRand[i] - 1.0, newHarmonic, i, bandwidth, range);
             }
         }else{
-            newHarmonic[i] = genDblInRange(range[RANGE_MIN_POS],range[RANGE_MAX_POS]);
+            newHarmonic[i] = range[RANGE_MIN_POS] + (range[RANGE_MAX_POS] - range[RANGE_MIN_POS]) * valueRand[i];
         }
+        if(hpop->move && newHarmonic[i] != best[i])
+            logMove(hpop->move, i, best[i]);
     }
     hpop->newHarmonic = newHarmonic;
-}
\ No newline at end of file
+}
+
+void refineHarmonies(HPop* pop, Memetic* memetic, EquationInfo info){
+    double refined = refineSlot(memetic, &pop->population, pop->bestPos, pop->bestFit); /*!< The fitness of the best harmony afterwards*/
+    const Real* row; /*!< The refined harmony*/
+    if(!(refined < pop->bestFit))
+        return;
+    pop->bestFit = refined;
+    pop->fitness[pop->bestPos] = refined;
+    pop->moveAge[pop->bestPos] = 0; ///the refined harmony was evaluated in full
+    if(pop->bestPos == pop->worstPos) ///the whole memory shared the fitness, so the worst is looked for again
+        evalNewWorst(pop->fitness, info.numVectors, refined, &pop->worstPos, &pop->worstFit);
+    if(pop->cache){
+        row = poolRow(&pop->population, pop->bestPos);
+        storeFitness(pop->cache, row, hashVector(row, info.dimToTest), refined);
+    }
+}
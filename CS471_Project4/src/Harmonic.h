@@ -14,6 +14,7 @@
 #define TESTINGSUITE_HARMONIC_H
 
 #include "Utilities.h"
+#include "Memetic.h"
 
 /// \fn void* harmonicTest(void* data)
 /// \brief Responsible for initializing the algorithm and all data related to the algorithm and calling related functions to start and record results fo the algorithm
@@ -21,14 +22,23 @@
 /// \param data - void pointer to be converted to an EquationInfo struct
 /// \return Nothing as it is a threaded function
 void* harmonicTest(void* data);
-/// \fn void pitchAdjustment(double* harmonic,int position, double bandwidth, const double* range)
+/// \fn void pitchAdjustment(double rand, Real* harmonic,int position, double bandwidth, const double* range)
 /// \brief adjusts the pitch of the current harmonic based on a random number, the current value and the bandwidth
 ///
+/// \param rand - the pre-generated random scalar in [-1, 1) for the adjustment
 /// \param harmonic - the harmonic to be adjusted
 /// \param position - the dimension within the harmonic being adjusted
 /// \param bandwidth - the bandwidth for the tuning
 /// \param range - the range of acceptable values in the search space
-void pitchAdjustment(double* harmonic,int position, double bandwidth, const double* range);
+void pitchAdjustment(double rand, Real* harmonic,int position, double bandwidth, const double* range);
+/// \fn double boundedHarmonic(HPop* pop, EquationInfo info)
+/// \brief Evaluates the new harmonic with evaluateBounded, stopping early once it cannot beat the worst harmony when the
+/// bounded evaluation is on, and counts the evaluations which could and did stop early.
+///
+/// \param pop - the struct holding the new harmonic
+/// \param info - The EquationInfo struct storing equation specific information
+/// \return the fitness of the new harmonic, or a fitness above the worst when it was cut short
+double boundedHarmonic(HPop* pop, EquationInfo info);
 /// \fn void updateBest(HPop* pop, double newResult, EquationInfo info)
 /// \brief updates the metadata pertaining to the best fitness within the struct
 ///
@@ -37,7 +47,7 @@ void pitchAdjustment(double* harmonic,int position, double bandwidth, const doub
 /// \param info - The EquationInfo struct storing equation specific information
 void updateBest(HPop* pop, double newResult, EquationInfo info);
 /// \fn void newVector(HPop* pop, double newResult, EquationInfo info)
-/// \brief adds the vector to the population at the worst fitness position
+/// \brief adds the vector to the population at the worst fitness position by handing that slot the scratch row holding it
 ///
 /// \param pop - the struct being processed
 /// \param newResult - the newly calculated fitness value
@@ -45,6 +55,9 @@ void updateBest(HPop* pop, double newResult, EquationInfo info);
 void newVector(HPop* pop, double newResult, EquationInfo info);
 /// \fn void harmonicIteration(HPop* hpop, int NI, int HMS, double HMCR, double PAR, double bandwidth, const double* range)
 /// \brief This iterates through the number of dimensions and grabs random values from the range or population and occasionally adjusts the value at each dimension.
+/// All of the random values for the iteration are generated in bulk before the loop, and the new harmonic is built in
+/// the scratch row of the population. When the harmonies are evaluated by their delta, the dimensions where the new
+/// harmonic differs from the best harmony are logged in hpop->move.
 ///
 /// \param hpop - the struct being processed
 /// \param NI - The number of dimensions in the Harmonics
@@ -54,5 +67,13 @@ void newVector(HPop* pop, double newResult, EquationInfo info);
 /// \param bandwidth - the bandwidth for the tuning
 /// \param range - the range of acceptable values in the search space
 void harmonicIteration(HPop* hpop, int NI, int HMS, double HMCR, double PAR, double bandwidth, const double* range);
+/// \fn void refineHarmonies(HPop* pop, Memetic* memetic, EquationInfo info)
+/// \brief Refines the best harmony with src/Memetic.h, updating its fitness, the best fitness and the worst harmony when
+/// the refined vector is better. Its fitness is then a full evaluation, and it is stored in the fitness cache when that is on.
+///
+/// \param pop - the struct being processed
+/// \param memetic - the refinement of the run
+/// \param info - The EquationInfo struct storing equation specific information
+void refineHarmonies(HPop* pop, Memetic* memetic, EquationInfo info);
 
 #endif //TESTINGSUITE_HARMONIC_H
@@ -6,12 +6,15 @@
  * \file HostCalls.h
  * \brief This is where all the references to the objective function call methods are stored to avoid duplication.
  *
+ *  The array starts out holding the scalar functions of src/Equations.h, and installEquationKernels in src/Utilities.h
+ *  replaces them with the vectorized kernels of src/SimdEquations.h at start up, along with their batch kernels.
  */
 
 #ifndef TESTINGSUITE_HOSTCALLS_H
 #define TESTINGSUITE_HOSTCALLS_H
 
 #include "Equations.h"
+#include "SimdEquations.h"
 
 //! An array of pointers to the equation methods to be used by threads in runEquationsAsThreads()
 /*!
@@ -39,4 +42,38 @@ const void* equationHostCalls[] ={
         &alpineHost /*!< Reference to the alpineHost method defined in src/Equations.h*/
 };
 
+//! An array of pointers to the batch kernels of the equation methods used by evaluateBatch() and evaluateColumns()
+/*!
+ * Every entry starts out empty, which evaluates the vectors of a batch one at a time through equationHostCalls, and
+ * installEquationKernels fills it with the batch kernels of the same instruction set as equationHostCalls.
+ */
+const void* equationBatchCalls[MAX_NUM_EQUATIONS];
+
+//! An array of pointers to the methods evaluating a part of a vector of the equations whose terms use their index
+/*!
+ * evaluateSplit in src/Utilities.h evaluates a very long vector in parts, and the functions whose terms depend on their
+ * index in the vector, or which multiply their terms, cannot be run on a part through equationHostCalls. Their entries
+ * start out holding the scalar parts of src/Equations.h, and installEquationKernels replaces them with the vectorized
+ * parts of the same instruction set as equationHostCalls. The other entries are empty.
+ */
+const void* equationPartCalls[MAX_NUM_EQUATIONS] = {
+        NULL, NULL, NULL, NULL,
+        &griewangkPart, /*!< Reference to the griewangkPart method defined in src/Equations.h*/
+        NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+        &michalewiczPart, /*!< Reference to the michalewiczPart method defined in src/Equations.h*/
+        NULL,
+        &quarticPart, /*!< Reference to the quarticPart method defined in src/Equations.h*/
+        &levyPart /*!< Reference to the levyPart method defined in src/Equations.h*/
+};
+
+//! The kernels of the equation methods written for the sizes in FIXED_DIMENSIONS of src/SimdEquations.h
+/*!
+ * Every entry starts out empty, leaving every size to equationHostCalls, and installEquationKernels fills it with the
+ * fixed size kernels of the same instruction set as equationHostCalls.
+ */
+const void* equationFixedCalls[MAX_NUM_EQUATIONS][FIXED_DIMENSION_COUNT];
+
+//! The batch kernels of the equation methods written for the sizes in FIXED_DIMENSIONS of src/SimdEquations.h
+const void* equationFixedBatchCalls[MAX_NUM_EQUATIONS][FIXED_DIMENSION_COUNT];
+
 #endif //TESTINGSUITE_HOSTCALLS_H
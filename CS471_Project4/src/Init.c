@@ -11,6 +11,10 @@
  */
 #include "Utilities.h"
 #include "Init.h"
+#include "Plugins.h"
+#include "Formulas.h"
+#include "Variants.h"
+#include <limits.h>
 
 /*!
  * Enum used for the state of the flags for lines which are being read
@@ -139,16 +143,16 @@ int processEquations(char* arg, Info* progInfo){
     }
     int numEq = progInfo->numEquations;/*!< Store the number of equations locally*/
     /*!
-     * if the number of equations defined is larger than the MAX_NUM_EQUATIONS defined in src/Utilities.h tell
-     * the user and return failure. Otherwise allocate the arrays to stor optimum values and ranges for each equation
-     * and return success.
+     * if the number of equations defined is larger than the NUM_BUILTIN_EQUATIONS defined in src/Utilities.h tell
+     * the user and return failure. Otherwise allocate the arrays to stor optimum values and ranges for each equation,
+     * the objective plugins included, and return success.
      */
-    if(numEq > MAX_NUM_EQUATIONS){
-        printf("Requested too many equations. Please make sure the value is between 1 and %d.\n", MAX_NUM_EQUATIONS);
+    if(numEq > NUM_BUILTIN_EQUATIONS){
+        printf("Requested too many equations. Please make sure the value is between 1 and %d.\n", NUM_BUILTIN_EQUATIONS);
         return -1;
     }
-    progInfo->ranges = calloc(numEq, sizeof(double*));
-    for(int i = 0; i < numEq; i++){
+    progInfo->ranges = calloc(MAX_NUM_EQUATIONS, sizeof(double*));
+    for(int i = 0; i < MAX_NUM_EQUATIONS; i++){
         progInfo->ranges[i] = calloc(RANGE_SIZE, sizeof(double));
     }
     return 0;
@@ -355,6 +359,461 @@ int processBandwidth(char *arg, Info *progInfo){
     return 0;
 }
 
+int processRandomGenerator(char *arg, Info *progInfo){
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    /*!
+     * If the value is 'Stream' draw random values in order from each thread's generator, if it is 'Counter' compute
+     * them from their address. Otherwise tell the user and return failure.
+     */
+    if(strcmp(arg, "Stream") == 0){
+        progInfo->randomMode = StreamGenerator;
+    }
+    else if(strcmp(arg, "Counter") == 0){
+        progInfo->randomMode = CounterGenerator;
+    }
+    else{
+        printf("The random generator must be either 'Stream' or 'Counter'. Please check the input file and try again.\n");
+        return -1;
+    }
+    return 0;
+}
+
+int processSeed(char *arg, Info *progInfo){
+    char* end; /*!< This is used to house the terminating character of the integer parsing*/
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    /*!
+     * Attempt to convert the value in the given string arg to an unsigned 64 bit integer and if anything but digits were
+     * given tell the user and return failure. Otherwise mark the seed as provided and return success.
+     */
+    progInfo->seed = strtoull(arg, &end, 10);
+    if(end == arg || *end != '\0' || arg[0] == '-'){
+        printf("Need to have a non-negative integer for the seed value. Please check the input file and try again.\n");
+        return -1;
+    }
+    progInfo->seedProvided = 1;
+    return 0;
+}
+
+int processInitializer(char *arg, Info *progInfo){
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    /*!
+     * Match the value against the name of every initializer and if none match tell the user and return failure.
+     */
+    if(strcmp(arg, "Uniform") == 0){
+        progInfo->initializer = UniformInit;
+    }
+    else if(strcmp(arg, "Sobol") == 0){
+        progInfo->initializer = SobolInit;
+    }
+    else if(strcmp(arg, "Halton") == 0){
+        progInfo->initializer = HaltonInit;
+    }
+    else if(strcmp(arg, "LatinHypercube") == 0){
+        progInfo->initializer = LatinHypercubeInit;
+    }
+    else{
+        printf("The initializer must be 'Uniform', 'Sobol', 'Halton' or 'LatinHypercube'. Please check the input file and try again.\n");
+        return -1;
+    }
+    return 0;
+}
+
+int processLayout(char *arg, Info *progInfo){
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    /*!
+     * Match the value against the name of every layout and if none match tell the user and return failure.
+     */
+    if(strcmp(arg, "Auto") == 0){
+        progInfo->layout = AutoLayout;
+    }
+    else if(strcmp(arg, "RowMajor") == 0){
+        progInfo->layout = RowMajorLayout;
+    }
+    else if(strcmp(arg, "DimensionMajor") == 0){
+        progInfo->layout = DimMajorLayout;
+    }
+    else{
+        printf("The population layout must be 'Auto', 'RowMajor' or 'DimensionMajor'. Please check the input file and try again.\n");
+        return -1;
+    }
+    return 0;
+}
+
+int processUpdateOrder(char *arg, Info *progInfo){
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    /*!
+     * Match the value against the name of every update order and if none match tell the user and return failure.
+     */
+    if(strcmp(arg, "Sequential") == 0){
+        progInfo->updateOrder = SequentialUpdate;
+    }
+    else if(strcmp(arg, "Synchronous") == 0){
+        progInfo->updateOrder = SynchronousUpdate;
+    }
+    else{
+        printf("The update order must be 'Sequential' or 'Synchronous'. Please check the input file and try again.\n");
+        return -1;
+    }
+    return 0;
+}
+
+int processAffinity(char *arg, Info *progInfo){
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    /*!
+     * Match the value against 'On' and 'Off' and if neither match tell the user and return failure.
+     */
+    if(strcmp(arg, "On") == 0){
+        progInfo->pinThreads = 1;
+    }
+    else if(strcmp(arg, "Off") == 0){
+        progInfo->pinThreads = 0;
+    }
+    else{
+        printf("The thread affinity must be 'On' or 'Off'. Please check the input file and try again.\n");
+        return -1;
+    }
+    return 0;
+}
+
+int processHugePages(char *arg, Info *progInfo){
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    /*!
+     * Match the value against the name of every huge page mode and if none match tell the user and return failure.
+     */
+    if(strcmp(arg, "Off") == 0){
+        progInfo->hugePages = NoHugePages;
+    }
+    else if(strcmp(arg, "Transparent") == 0){
+        progInfo->hugePages = TransparentHugePages;
+    }
+    else if(strcmp(arg, "Reserved") == 0){
+        progInfo->hugePages = ReservedHugePages;
+    }
+    else{
+        printf("The huge pages must be 'Off', 'Transparent' or 'Reserved'. Please check the input file and try again.\n");
+        return -1;
+    }
+    return 0;
+}
+
+int processMemoryCap(char *arg, Info *progInfo){
+    char* end; /*!< This is used to house the terminating character of the integer parsing*/
+    unsigned long long megabytes; /*!< The cap in megabytes*/
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    /*!
+     * 'Off' removes the cap and 'Auto' caps at the physical memory of the machine. Otherwise attempt to convert the value
+     * to a positive number of megabytes and if anything but digits were given tell the user and return failure.
+     */
+    if(strcmp(arg, "Off") == 0){
+        progInfo->memoryCap = 0;
+        return 0;
+    }
+    if(strcmp(arg, "Auto") == 0){
+        progInfo->memoryCap = physicalMemoryBytes();
+        return 0;
+    }
+    megabytes = strtoull(arg, &end, 10);
+    if(end == arg || *end != '\0' || arg[0] == '-' || megabytes == 0){
+        printf("The memory cap must be 'Off', 'Auto' or a positive number of megabytes. Please check the input file and try again.\n");
+        return -1;
+    }
+    progInfo->memoryCap = (size_t)megabytes * BYTES_PER_MB;
+    return 0;
+}
+
+int processKernels(char *arg, Info *progInfo){
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    /*!
+     * Match the value against the name of every kernel selection and if none match tell the user and return failure.
+     */
+    if(strcmp(arg, "Auto") == 0){
+        progInfo->kernels = AutoKernels;
+    }
+    else if(strcmp(arg, "Scalar") == 0){
+        progInfo->kernels = ScalarKernels;
+    }
+    else if(strcmp(arg, "SSE2") == 0){
+        progInfo->kernels = SSE2Kernels;
+    }
+    else if(strcmp(arg, "AVX2") == 0){
+        progInfo->kernels = AVX2Kernels;
+    }
+    else if(strcmp(arg, "AVX512") == 0){
+        progInfo->kernels = AVX512Kernels;
+    }
+    else{
+        printf("The objective kernels must be 'Auto', 'Scalar', 'SSE2', 'AVX2' or 'AVX512'. Please check the input file and try again.\n");
+        return -1;
+    }
+    return 0;
+}
+
+int processBatchThreads(char *arg, Info *progInfo){
+    char* end; /*!< This is used to house the terminating character of the integer parsing*/
+    long threads; /*!< The number of threads sharing every batch*/
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    /*!
+     * 'Auto' shares every batch between all of the CPUs. Otherwise attempt to convert the value to a positive number of
+     * threads and if anything but digits were given tell the user and return failure.
+     */
+    if(strcmp(arg, "Auto") == 0){
+        progInfo->batchThreads = cpuCount();
+        return 0;
+    }
+    threads = strtol(arg, &end, 10);
+    if(end == arg || *end != '\0' || threads <= 0){
+        printf("The batch threads must be 'Auto' or a positive number of threads. Please check the input file and try again.\n");
+        return -1;
+    }
+    progInfo->batchThreads = (int)threads;
+    return 0;
+}
+
+int processDelta(char *arg, Info *progInfo){
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    /*!
+     * Match the value against 'On' and 'Off' and if neither match tell the user and return failure.
+     */
+    if(strcmp(arg, "On") == 0){
+        progInfo->delta = DeltaOn;
+    }
+    else if(strcmp(arg, "Off") == 0){
+        progInfo->delta = DeltaOff;
+    }
+    else{
+        printf("The delta evaluation must be 'On' or 'Off'. Please check the input file and try again.\n");
+        return -1;
+    }
+    return 0;
+}
+
+int processBounded(char *arg, Info *progInfo){
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    /*!
+     * Match the value against 'On' and 'Off' and if neither match tell the user and return failure.
+     */
+    if(strcmp(arg, "On") == 0){
+        progInfo->bounded = BoundedOn;
+    }
+    else if(strcmp(arg, "Off") == 0){
+        progInfo->bounded = BoundedOff;
+    }
+    else{
+        printf("The bounded evaluation must be 'On' or 'Off'. Please check the input file and try again.\n");
+        return -1;
+    }
+    return 0;
+}
+
+int processFitnessCache(char *arg, Info *progInfo){
+    char* end; /*!< This is used to house the terminating character of the integer parsing*/
+    long entries; /*!< The number of vectors the cache of every run holds*/
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    /*!
+     * 'Off' leaves every run without a cache. Otherwise attempt to convert the value to a positive number of vectors and
+     * if anything but digits were given tell the user and return failure.
+     */
+    if(strcmp(arg, "Off") == 0){
+        progInfo->fitnessCache = 0;
+        return 0;
+    }
+    entries = strtol(arg, &end, 10);
+    if(end == arg || *end != '\0' || entries <= 0 || entries > MAX_FITNESS_CACHE_ENTRIES){
+        printf("The fitness cache must be 'Off' or a number of vectors from 1 to %d. Please check the input file and try again.\n", MAX_FITNESS_CACHE_ENTRIES);
+        return -1;
+    }
+    progInfo->fitnessCache = (int)entries;
+    return 0;
+}
+
+int processMemetic(char *arg, Info *progInfo){
+    char* end; /*!< This is used to house the terminating character of the integer parsing*/
+    long period; /*!< The number of iterations between refinements*/
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    /*!
+     * 'Off' leaves the best vector of every run unrefined. Otherwise attempt to convert the value to a positive number of
+     * iterations and if anything but digits were given tell the user and return failure.
+     */
+    if(strcmp(arg, "Off") == 0){
+        progInfo->memetic = 0;
+        return 0;
+    }
+    period = strtol(arg, &end, 10);
+    if(end == arg || *end != '\0' || period <= 0 || period > INT_MAX){
+        printf("The memetic refinement must be 'Off' or a positive number of iterations between refinements. Please check the input file and try again.\n");
+        return -1;
+    }
+    progInfo->memetic = (int)period;
+    return 0;
+}
+
+int processPlugins(char *arg, Info *progInfo){
+    char* pairs[MAX_NUM_PLUGINS + 1]; /*!< The unparsed name and path of every plugin, with room to notice one too many*/
+    int count = 0; /*!< The number of plugins named*/
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    char* token = strtok(arg, ","); /*!< Split the plugins on ','*/
+    while(token && count <= MAX_NUM_PLUGINS){
+        pairs[count++] = token;
+        token = strtok(NULL, ",");
+    }
+    if(count > MAX_NUM_PLUGINS){
+        printf("Too many objective plugins were named. Please name at most %d and try again.\n", MAX_NUM_PLUGINS);
+        return -1;
+    }
+    /*!
+     * Split every plugin into its name and path on ';' and load it, and if either is missing or it could not be loaded
+     * tell the user and return failure.
+     */
+    for(int i = 0; i < count; i++){
+        char* name = strtok(pairs[i], ";"), /*!< The name the function is registered under*/
+        *path = strtok(NULL, ";"); /*!< The path of the shared library*/
+        if(!name || !path || strtok(NULL, ";")){
+            printf("Every objective plugin needs a name and the path of its library separated by ';'. Please check the input file and try again.\n");
+            return -1;
+        }
+        if(loadPlugin(name, path) < 0)
+            return -1;
+        progInfo->numPlugins++;
+    }
+    return 0;
+}
+
+int checkPlugins(Info *progInfo){
+    /*!
+     * Store the bounds of every plugin as its range, after the built in functions, and if a dimension to be tested is
+     * outside of the limits of a plugin tell the user and return failure.
+     */
+    for(int i = 0; i < progInfo->numPlugins; i++){
+        int equation = NUM_BUILTIN_EQUATIONS + i; /*!< The position of the function of the plugin*/
+        const ObjectivePlugin* plugin = pluginAt(equation); /*!< The description the plugin exported*/
+        progInfo->ranges[equation][RANGE_MIN_POS] = plugin->lower;
+        progInfo->ranges[equation][RANGE_MAX_POS] = plugin->upper;
+        for(int j = 0; j < progInfo->numDimensions; j++){
+            int dimensions = progInfo->dimsToTest[j]; /*!< The dimension being checked*/
+            if(dimensions < plugin->minDimensions || (plugin->maxDimensions && dimensions > plugin->maxDimensions)){
+                printf("The objective plugin %s is not defined for %d dimensions. Please check the input file and try again.\n", pluginName(equation), dimensions);
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+int processFormulas(char *arg, Info *progInfo){
+    char* formulas[MAX_NUM_FORMULAS + 1]; /*!< The unparsed name, bounds and text of every formula, with room to notice one too many*/
+    int count = 0; /*!< The number of formulas given*/
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    char* token = strtok(arg, "|"); /*!< Split the formulas on '|', as the formulas themselves use ','*/
+    while(token && count <= MAX_NUM_FORMULAS){
+        formulas[count++] = token;
+        token = strtok(NULL, "|");
+    }
+    if(count > MAX_NUM_FORMULAS){
+        printf("Too many objective formulas were given. Please give at most %d and try again.\n", MAX_NUM_FORMULAS);
+        return -1;
+    }
+    /*!
+     * Split every formula into its name, bounds and text on ';' and compile it, and if any part is missing or it could
+     * not be compiled tell the user and return failure.
+     */
+    for(int i = 0; i < count; i++){
+        char* name = strtok(formulas[i], ";"), /*!< The name the function is registered under*/
+        *lower = strtok(NULL, ";"), /*!< The lowest value of every coordinate*/
+        *upper = strtok(NULL, ";"), /*!< The highest value of every coordinate*/
+        *text = strtok(NULL, ";"), /*!< The formula*/
+        *end = NULL; /*!< This is used to house the terminating character of the double parsing*/
+        double low = lower ? strtod(lower, &end) : 0.0, /*!< The parsed lower bound*/
+        high = 0.0; /*!< The parsed upper bound*/
+        if(upper && end && *end == '\0')
+            high = strtod(upper, &end);
+        if(!text || strtok(NULL, ";") || !end || *end != '\0'){
+            printf("Every objective formula needs a name, a lower bound, an upper bound and the formula separated by ';'. Please check the input file and try again.\n");
+            return -1;
+        }
+        if(compileFormula(name, low, high, text) < 0)
+            return -1;
+        progInfo->numFormulas++;
+    }
+    return 0;
+}
+
+int processVariants(char *arg, Info *progInfo){
+    char* variants[MAX_NUM_VARIANTS + 1]; /*!< The unparsed name, kind, functions and bounds of every variant, with room to notice one too many*/
+    int count = 0; /*!< The number of variants given*/
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    char* token = strtok(arg, "|"); /*!< Split the variants on '|', as the functions of a variant are separated by ','*/
+    while(token && count <= MAX_NUM_VARIANTS){
+        variants[count++] = token;
+        token = strtok(NULL, "|");
+    }
+    if(count > MAX_NUM_VARIANTS){
+        printf("Too many objective variants were given. Please give at most %d and try again.\n", MAX_NUM_VARIANTS);
+        return -1;
+    }
+    /*!
+     * Split every variant into its name, kind, functions and bounds on ';', the functions on ',', and register it, and if
+     * any part is missing or is not a number or it could not be registered tell the user and return failure.
+     */
+    for(int i = 0; i < count; i++){
+        char* name = strtok(variants[i], ";"), /*!< The name the function is registered under*/
+        *kind = strtok(NULL, ";"), /*!< Shifted, Rotated, Hybrid or Composition*/
+        *functions = strtok(NULL, ";"), /*!< The built in functions the variant is built from*/
+        *lower = strtok(NULL, ";"), /*!< The lowest value of every coordinate*/
+        *upper = strtok(NULL, ";"), /*!< The highest value of every coordinate*/
+        *end = NULL; /*!< This is used to house the terminating character of the number parsing*/
+        int bases[VARIANT_MAX_FUNCTIONS + 1], /*!< The parsed functions, with room to notice one too many*/
+        numBases = 0; /*!< The number of functions given*/
+        double low = lower ? strtod(lower, &end) : 0.0, /*!< The parsed lower bound*/
+        high = 0.0; /*!< The parsed upper bound*/
+        if(upper && end && *end == '\0')
+            high = strtod(upper, &end);
+        if(!upper || strtok(NULL, ";") || !end || *end != '\0'){
+            printf("Every objective variant needs a name, a kind, its functions, a lower bound and an upper bound separated by ';'. Please check the input file and try again.\n");
+            return -1;
+        }
+        for(char* base = strtok(functions, ","); base && numBases <= VARIANT_MAX_FUNCTIONS; base = strtok(NULL, ",")){
+            bases[numBases++] = (int)strtol(base, &end, 10);
+            if(end == base || *end != '\0'){
+                printf("The functions of the objective variant %s must be equation numbers separated by ','. Please check the input file and try again.\n", name);
+                return -1;
+            }
+        }
+        if(registerVariant(name, kind, bases, numBases, low, high) < 0)
+            return -1;
+        progInfo->numVariants++;
+    }
+    return 0;
+}
+
+int processReplay(char *arg, Info *progInfo){
+    char* end; /*!< This is used to house the terminating character of the integer parsing*/
+    int values[3], /*!< The equation number, dimension index and experiment of the run to replay*/
+    count = 0; /*!< The number of values read so far*/
+    arg[strcspn(arg, "\r\n")] = '\0'; ///remove the line ending from the value
+    char* token = strtok(arg, ","); /*!< Split the values on ','*/
+    /*!
+     * Convert each value separated by ',' and if it is not a non-negative integer or there are more than three values tell
+     * the user and return failure.
+     */
+    while(token){
+        if(count == 3 || (values[count] = (int)strtol(token, &end, 10)) < 0 || end == token){
+            printf("The replay line needs the equation number, dimension index and experiment from the seed manifest separated by ','. Please check the input file and try again.\n");
+            return -1;
+        }
+        count++;
+        token = strtok(NULL, ",");
+    }
+    if(count != 3){
+        printf("The replay line needs the equation number, dimension index and experiment from the seed manifest separated by ','. Please check the input file and try again.\n");
+        return -1;
+    }
+    progInfo->replay = 1;
+    progInfo->replayEquation = values[0];
+    progInfo->replayDimIndex = values[1];
+    progInfo->replayExperiment = values[2];
+    return 0;
+}
+
 int init(char* filename, Info* progInfo){
     FILE *inputFile = fopen(filename, "r");
     if(!inputFile){
@@ -378,6 +837,24 @@ int init(char* filename, Info* progInfo){
     PARFlag = NotRead, /*!< Initialize the flag representing the pitch adjustment line having been read to NotRead*/
     HMCRFlag = NotRead, /*!< Initialize the flag representing the HMCR line having been read to NotRead*/
     bandwidthFlag = NotRead, /*!< Initialize the flag representing the bandwidth line having been read to NotRead*/
+    randomFlag = NotRead, /*!< Initialize the flag representing the optional random generator line having been read to NotRead*/
+    seedFlag = NotRead, /*!< Initialize the flag representing the optional seed line having been read to NotRead*/
+    replayFlag = NotRead, /*!< Initialize the flag representing the optional replay line having been read to NotRead*/
+    initializerFlag = NotRead, /*!< Initialize the flag representing the optional initializer line having been read to NotRead*/
+    layoutFlag = NotRead, /*!< Initialize the flag representing the optional population layout line having been read to NotRead*/
+    updateOrderFlag = NotRead, /*!< Initialize the flag representing the optional update order line having been read to NotRead*/
+    affinityFlag = NotRead, /*!< Initialize the flag representing the optional thread affinity line having been read to NotRead*/
+    hugePageFlag = NotRead, /*!< Initialize the flag representing the optional huge pages line having been read to NotRead*/
+    memoryCapFlag = NotRead, /*!< Initialize the flag representing the optional memory cap line having been read to NotRead*/
+    kernelFlag = NotRead, /*!< Initialize the flag representing the optional objective kernels line having been read to NotRead*/
+    batchThreadsFlag = NotRead, /*!< Initialize the flag representing the optional batch threads line having been read to NotRead*/
+    deltaFlag = NotRead, /*!< Initialize the flag representing the optional delta evaluation line having been read to NotRead*/
+    boundedFlag = NotRead, /*!< Initialize the flag representing the optional bounded evaluation line having been read to NotRead*/
+    cacheFlag = NotRead, /*!< Initialize the flag representing the optional fitness cache line having been read to NotRead*/
+    memeticFlag = NotRead, /*!< Initialize the flag representing the optional memetic refinement line having been read to NotRead*/
+    pluginFlag = NotRead, /*!< Initialize the flag representing the optional objective plugins line having been read to NotRead*/
+    formulaFlag = NotRead, /*!< Initialize the flag representing the optional objective formulas line having been read to NotRead*/
+    variantFlag = NotRead, /*!< Initialize the flag representing the optional objective variants line having been read to NotRead*/
     testDimStr = 0, /*!< Initialize a variable tracking the result of comparing to the expected dimensions line flag*/
     rangeStr = 0; /*!< Initialize a variable tracking the result of comparing to the expected ranges line flag*/
     char* arg; /*!< Stores the tokenized string from the line read in*/
@@ -577,6 +1054,222 @@ int init(char* filename, Info* progInfo){
                 bandwidthFlag = Read;
                 break;
             }
+            /*!
+             * If we are reading the random generator line, processRandomGenerator and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(randomFlag == Reading){
+                if(processRandomGenerator(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                randomFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the seed line, processSeed and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(seedFlag == Reading){
+                if(processSeed(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                seedFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the replay line, processReplay and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(replayFlag == Reading){
+                if(processReplay(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                replayFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the initializer line, processInitializer and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(initializerFlag == Reading){
+                if(processInitializer(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                initializerFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the population layout line, processLayout and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(layoutFlag == Reading){
+                if(processLayout(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                layoutFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the update order line, processUpdateOrder and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(updateOrderFlag == Reading){
+                if(processUpdateOrder(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                updateOrderFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the thread affinity line, processAffinity and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(affinityFlag == Reading){
+                if(processAffinity(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                affinityFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the huge pages line, processHugePages and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(hugePageFlag == Reading){
+                if(processHugePages(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                hugePageFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the memory cap line, processMemoryCap and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(memoryCapFlag == Reading){
+                if(processMemoryCap(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                memoryCapFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the objective kernels line, processKernels and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(kernelFlag == Reading){
+                if(processKernels(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                kernelFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the batch threads line, processBatchThreads and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(batchThreadsFlag == Reading){
+                if(processBatchThreads(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                batchThreadsFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the delta evaluation line, processDelta and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(deltaFlag == Reading){
+                if(processDelta(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                deltaFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the bounded evaluation line, processBounded and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(boundedFlag == Reading){
+                if(processBounded(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                boundedFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the fitness cache line, processFitnessCache and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(cacheFlag == Reading){
+                if(processFitnessCache(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                cacheFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the memetic refinement line, processMemetic and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(memeticFlag == Reading){
+                if(processMemetic(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                memeticFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the objective plugins line, processPlugins and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(pluginFlag == Reading){
+                if(processPlugins(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                pluginFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the objective formulas line, processFormulas and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(formulaFlag == Reading){
+                if(processFormulas(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                formulaFlag = Read;
+                break;
+            }
+            /*!
+             * If we are reading the objective variants line, processVariants and if it failed close the file and return -1.
+             * Otherwise set the flag to Read and break the loop effectively moving to the next line being read.
+             */
+            if(variantFlag == Reading){
+                if(processVariants(arg, progInfo) < 0) {
+                    fclose(inputFile);
+                    return -1;
+                }
+                variantFlag = Read;
+                break;
+            }
             /*!
              * This point is reached if the program is not currently reading any of the specified lines and is looking
              * to see if it is reading one of the expected lines.
@@ -745,6 +1438,168 @@ int init(char* filename, Info* progInfo){
                 arg = strtok(NULL, "=");
                 continue;
             }
+            /*!
+              * If we haven't read the optional random generator line already and it equals the signifier for the random
+              * generator line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Random Generator") == 0 && randomFlag == NotRead){
+                randomFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional seed line already and it equals the signifier for the seed line,
+              * set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Seed") == 0 && seedFlag == NotRead){
+                seedFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional replay line already and it equals the signifier for the replay line,
+              * set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Replay") == 0 && replayFlag == NotRead){
+                replayFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional initializer line already and it equals the signifier for the initializer
+              * line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Initializer") == 0 && initializerFlag == NotRead){
+                initializerFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional population layout line already and it equals the signifier for the
+              * population layout line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Population Layout") == 0 && layoutFlag == NotRead){
+                layoutFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional update order line already and it equals the signifier for the
+              * update order line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Update Order") == 0 && updateOrderFlag == NotRead){
+                updateOrderFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional thread affinity line already and it equals the signifier for the
+              * thread affinity line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Thread Affinity") == 0 && affinityFlag == NotRead){
+                affinityFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional huge pages line already and it equals the signifier for the
+              * huge pages line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Huge Pages") == 0 && hugePageFlag == NotRead){
+                hugePageFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional memory cap line already and it equals the signifier for the
+              * memory cap line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Memory Cap") == 0 && memoryCapFlag == NotRead){
+                memoryCapFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional objective kernels line already and it equals the signifier for the
+              * objective kernels line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Objective Kernels") == 0 && kernelFlag == NotRead){
+                kernelFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional batch threads line already and it equals the signifier for the
+              * batch threads line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Batch Threads") == 0 && batchThreadsFlag == NotRead){
+                batchThreadsFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional delta evaluation line already and it equals the signifier for the
+              * delta evaluation line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Delta Evaluation") == 0 && deltaFlag == NotRead){
+                deltaFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional bounded evaluation line already and it equals the signifier for the
+              * bounded evaluation line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Bounded Evaluation") == 0 && boundedFlag == NotRead){
+                boundedFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional fitness cache line already and it equals the signifier for the
+              * fitness cache line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Fitness Cache") == 0 && cacheFlag == NotRead){
+                cacheFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional memetic refinement line already and it equals the signifier for the
+              * memetic refinement line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Memetic Refinement") == 0 && memeticFlag == NotRead){
+                memeticFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional objective plugins line already and it equals the signifier for the
+              * objective plugins line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Objective Plugins") == 0 && pluginFlag == NotRead){
+                pluginFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional objective formulas line already and it equals the signifier for the
+              * objective formulas line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Objective Formulas") == 0 && formulaFlag == NotRead){
+                formulaFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
+            /*!
+              * If we haven't read the optional objective variants line already and it equals the signifier for the
+              * objective variants line, set the flag to Reading, tokenize on '=' to get the value and continue the arg while loop.
+              */
+            if(strcmp(arg, "Objective Variants") == 0 && variantFlag == NotRead){
+                variantFlag = Reading;
+                arg = strtok(NULL, "=");
+                continue;
+            }
             /*!
              * This point is reached if none of the proper tags were found, exiting the arg while loop and
              * effectively moving to the next line.
@@ -764,6 +1619,50 @@ int init(char* filename, Info* progInfo){
         fclose(inputFile);
         return -1;
     }
+    /*!
+     * A vector of SPLIT_VECTOR_DIMENSIONS or more is evaluated in parts, so unless the batch threads line said otherwise
+     * those parts are shared between every CPU.
+     */
+    if(batchThreadsFlag != Read){
+        for(int i = 0; i < progInfo->numDimensions; i++){
+            if(progInfo->dimsToTest[i] >= SPLIT_VECTOR_DIMENSIONS)
+                progInfo->batchThreads = cpuCount();
+        }
+    }
+    /*!
+     * Every plugin is run within its own bounds, and can only be run if it is defined for every dimension to be tested,
+     * so if it is not close the file and return failure.
+     */
+    if(checkPlugins(progInfo) < 0){
+        fclose(inputFile);
+        return -1;
+    }
+    /*!
+     * Every formula is run within the bounds given with it, stored as its range after the plugin slots.
+     */
+    for(int i = 0; i < progInfo->numFormulas; i++)
+        formulaRange(FIRST_FORMULA_EQUATION + i, progInfo->ranges[FIRST_FORMULA_EQUATION + i]);
+    /*!
+     * Every variant is run within the bounds given with it, and is built for every dimension to be tested, so if it
+     * cannot be close the file and return failure.
+     */
+    for(int i = 0; i < progInfo->numVariants; i++)
+        variantRange(FIRST_VARIANT_EQUATION + i, progInfo->ranges[FIRST_VARIANT_EQUATION + i]);
+    if(buildVariants(progInfo->dimsToTest, progInfo->numDimensions) < 0){
+        fclose(inputFile);
+        return -1;
+    }
+    /*!
+     * A replay can only reproduce a run with the same master seed, so if the replay line was given without the seed line
+     * or it names a run outside of the equations, dimensions and experiments provided tell the user and close the file
+     * then return failure.
+     */
+    if(replayFlag == Read && (seedFlag != Read || !equationInRun(progInfo, progInfo->replayEquation) ||
+            progInfo->replayDimIndex >= progInfo->numDimensions || progInfo->replayExperiment >= progInfo->numExperiments)){
+        printf("The replay line must name a run within the equations, dimensions and experiments provided and needs the seed line it was run with. Please check the input file and try again.\n");
+        fclose(inputFile);
+        return -1;
+    }
     fclose(inputFile);
     progInfo->testSelection = checkTestType();
     return 0;
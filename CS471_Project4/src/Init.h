@@ -148,6 +148,168 @@ int processPAR(char *arg, Info *progInfo);
 /// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
 /// \return 0 for success, -1 on failure;
 int processBandwidth(char *arg, Info *progInfo);
+/// \fn int processRandomGenerator(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional random generator line, either 'Stream' or 'Counter'.
+///
+/// Failure: A value which is neither 'Stream' nor 'Counter'
+/// \param arg - The portion of the line containing the value to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processRandomGenerator(char *arg, Info *progInfo);
+/// \fn int processSeed(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional master seed line. Every run derives its own seed from this value.
+///
+/// Failure: A value which does not convert to a non-negative integer
+/// \param arg - The portion of the line containing the value to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processSeed(char *arg, Info *progInfo);
+/// \fn int processInitializer(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional initializer line, either 'Uniform', 'Sobol', 'Halton' or 'LatinHypercube'.
+///
+/// Failure: A value which is not one of the initializers
+/// \param arg - The portion of the line containing the value to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processInitializer(char *arg, Info *progInfo);
+/// \fn int processLayout(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional population layout line, either 'Auto', 'RowMajor' or 'DimensionMajor'.
+///
+/// Failure: A value which is not one of the layouts
+/// \param arg - The portion of the line containing the value to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processLayout(char *arg, Info *progInfo);
+/// \fn int processUpdateOrder(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional update order line, either 'Sequential' or 'Synchronous'.
+///
+/// Failure: A value which is not one of the update orders
+/// \param arg - The portion of the line containing the value to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processUpdateOrder(char *arg, Info *progInfo);
+/// \fn int processAffinity(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional thread affinity line, either 'On' or 'Off'.
+///
+/// Failure: A value which is not 'On' or 'Off'
+/// \param arg - The portion of the line containing the value to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processAffinity(char *arg, Info *progInfo);
+/// \fn int processHugePages(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional huge pages line, either 'Off', 'Transparent' or 'Reserved'.
+///
+/// Failure: A value which is not one of the huge page modes
+/// \param arg - The portion of the line containing the value to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processHugePages(char *arg, Info *progInfo);
+/// \fn int processMemoryCap(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional memory cap line, either 'Off', 'Auto' or a number of megabytes.
+///
+/// Failure: A value which is not 'Off', 'Auto' or a positive integer
+/// \param arg - The portion of the line containing the value to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processMemoryCap(char *arg, Info *progInfo);
+/// \fn int processKernels(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional objective kernels line, either 'Auto', 'Scalar', 'SSE2', 'AVX2' or 'AVX512'.
+///
+/// Failure: A value which is not one of the kernel selections
+/// \param arg - The portion of the line containing the value to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processKernels(char *arg, Info *progInfo);
+/// \fn int processBatchThreads(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional batch threads line, either 'Auto' or a number of threads.
+///
+/// Failure: A value which is not 'Auto' or a positive integer
+/// \param arg - The portion of the line containing the value to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processBatchThreads(char *arg, Info *progInfo);
+/// \fn int processDelta(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional delta evaluation line, either 'On' or 'Off'.
+///
+/// Failure: A value which is not 'On' or 'Off'
+/// \param arg - The portion of the line containing the value to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processDelta(char *arg, Info *progInfo);
+/// \fn int processBounded(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional bounded evaluation line, either 'On' or 'Off'.
+///
+/// Failure: A value which is not 'On' or 'Off'
+/// \param arg - The portion of the line containing the value to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processBounded(char *arg, Info *progInfo);
+/// \fn int processFitnessCache(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional fitness cache line, either 'Off' or the number of vectors the
+/// cache of every run holds.
+///
+/// Failure: A value which is not 'Off' or an integer from 1 to MAX_FITNESS_CACHE_ENTRIES
+/// \param arg - The portion of the line containing the value to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processFitnessCache(char *arg, Info *progInfo);
+/// \fn int processMemetic(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional memetic refinement line, either 'Off' or the number of
+/// iterations between the refinements of the best vector of every run by src/Memetic.h.
+///
+/// Failure: A value which is not 'Off' or a positive integer
+/// \param arg - The portion of the line containing the value to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processMemetic(char *arg, Info *progInfo);
+/// \fn int processPlugins(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional objective plugins line, the name and library path of every
+/// plugin separated by ';', with the plugins separated by ','. Every plugin is loaded with loadPlugin in src/Plugins.h.
+///
+/// Failure: a plugin without a name or path, too many plugins, or a plugin which could not be loaded
+/// \param arg - The portion of the line containing the values to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processPlugins(char *arg, Info *progInfo);
+/// \fn int checkPlugins(Info* progInfo)
+/// \brief This is the method which stores the bounds of every loaded plugin as its range, once the whole init file has
+/// been read.
+///
+/// Failure: a dimension to be tested outside of the dimensionality limits of a plugin
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int checkPlugins(Info *progInfo);
+/// \fn int processFormulas(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional objective formulas line, the name, lower bound, upper bound and
+/// formula of every function separated by ';', with the functions separated by '|'. Every formula is compiled with
+/// compileFormula in src/Formulas.h.
+///
+/// Failure: a formula missing a part or with bounds which are not numbers, too many formulas, or a formula which could
+/// not be compiled
+/// \param arg - The portion of the line containing the values to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processFormulas(char *arg, Info *progInfo);
+/// \fn int processVariants(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional objective variants line, the name, kind, functions, lower bound
+/// and upper bound of every variant separated by ';', with the functions separated by ',' and the variants by '|'. Every
+/// variant is registered with registerVariant in src/Variants.h.
+///
+/// Failure: a variant missing a part or with functions or bounds which are not numbers, too many variants, or a variant
+/// which could not be registered
+/// \param arg - The portion of the line containing the values to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processVariants(char *arg, Info *progInfo);
+/// \fn int processReplay(char* arg, Info* progInfo)
+/// \brief This is the method which processes the optional replay line, the equation number, dimension index and experiment
+/// of a single run from the seed manifest separated by ','.
+///
+/// Failure: not exactly three non-negative integers provided
+/// \param arg - The portion of the line containing the values to store
+/// \param progInfo - The reference to the Info struct for this series of tests defined in src/Utilities.h
+/// \return 0 for success, -1 on failure;
+int processReplay(char *arg, Info *progInfo);
 
 /// \fn int checkTestType()
 /// \brief This is the method which takes user input to define the type of tests to run; either Genetic Algorithm or Differential Evolution.
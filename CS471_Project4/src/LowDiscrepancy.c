@@ -0,0 +1,236 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file LowDiscrepancy.c
+ * \brief This is where all methods defined in src/LowDiscrepancy.h are implemented.
+ *
+ *  The Sobol direction numbers are built from the recurrence of Bratley and Fox over primitive polynomials, which are
+ *  found at run time in increasing degree so any number of dimensions is supported. The free initial direction numbers
+ *  of every dimension are odd values from a fixed hash, so the unshifted sequence is the same for every run.
+ */
+#include "LowDiscrepancy.h"
+#include "MersenneMatrix.h"
+#include <float.h>
+
+static uint64_t ldsMix(uint64_t z){
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+static uint32_t polyMulMod(uint32_t a, uint32_t b, uint32_t poly, int degree){
+    uint32_t result = 0; /*!< The product over GF(2) reduced by poly*/
+    /*!
+     * Shift and add over GF(2), reducing a whenever its degree reaches the degree of poly.
+     */
+    while(b){
+        if(b & 1U)
+            result ^= a;
+        b >>= 1;
+        a <<= 1;
+        if(a & (1U << degree))
+            a ^= poly;
+    }
+    return result;
+}
+
+static uint32_t polyPowX(uint32_t exponent, uint32_t poly, int degree){
+    uint32_t result = 1, /*!< x^0*/
+    base = degree == 1 ? 2U ^ poly : 2U; /*!< x reduced by poly*/
+    /*!
+     * Square and multiply over the bits of the exponent.
+     */
+    while(exponent){
+        if(exponent & 1U)
+            result = polyMulMod(result, base, poly, degree);
+        base = polyMulMod(base, base, poly, degree);
+        exponent >>= 1;
+    }
+    return result;
+}
+
+static int isPrimitive(uint32_t poly, int degree){
+    uint32_t order = (1U << degree) - 1, /*!< The order x must have for poly to be primitive*/
+    rest = order; /*!< The part of the order not yet factored*/
+    if(polyPowX(order, poly, degree) != 1)
+        return 0;
+    /*!
+     * x has order 2^degree - 1 only if no proper divisor order / q, for a prime factor q, is already a period.
+     */
+    for(uint32_t q = 2; q * q <= rest; q++){
+        if(rest % q == 0){
+            if(polyPowX(order / q, poly, degree) == 1)
+                return 0;
+            while(rest % q == 0)
+                rest /= q;
+        }
+    }
+    if(rest > 1 && polyPowX(order / rest, poly, degree) == 1)
+        return 0;
+    return 1;
+}
+
+static void sobolDirections(uint32_t* directions, int dim){
+    int found = 0, /*!< The number of primitive polynomials found so far*/
+    degree = 1; /*!< The degree of the polynomials being searched*/
+    uint32_t* polys = calloc(dim, sizeof(uint32_t)); /*!< The primitive polynomial of every dimension after the first*/
+    int* degrees = calloc(dim, sizeof(int)); /*!< The degree of every polynomial in polys*/
+    /*!
+     * Collect the primitive polynomials in increasing degree until there is one for every dimension after the first.
+     */
+    while(found < dim - 1 && degree < SOBOL_BITS){
+        for(uint32_t a = 0; a < (1U << (degree - 1)) && found < dim - 1; a++){
+            uint32_t poly = (1U << degree) | (a << 1) | 1U; /*!< Polynomials always have the leading and constant terms*/
+            if(isPrimitive(poly, degree)){
+                polys[found] = poly;
+                degrees[found++] = degree;
+            }
+        }
+        degree++;
+    }
+    /*!
+     * The first dimension is the van der Corput sequence in base 2.
+     */
+    for(int k = 0; k < SOBOL_BITS; k++)
+        directions[k] = 1U << (SOBOL_BITS - 1 - k);
+    /*!
+     * Every other dimension takes odd initial values m_k < 2^(k+1) for the first s values, then follows the recurrence
+     * m_k = 2a_1 m_(k-1) ^ 4a_2 m_(k-2) ^ ... ^ 2^s m_(k-s) ^ m_(k-s) of its polynomial of degree s.
+     */
+    for(int j = 1; j < dim; j++){
+        uint64_t m[SOBOL_BITS]; /*!< The direction numbers of this dimension before they are shifted into place*/
+        uint32_t poly = polys[j - 1];
+        int s = degrees[j - 1];
+        for(int k = 0; k < SOBOL_BITS; k++){
+            if(k < s){
+                m[k] = ((ldsMix(((uint64_t)j << 32) | (uint64_t)k) % (1ULL << k)) << 1) | 1ULL;
+            }else{
+                m[k] = m[k - s] ^ (m[k - s] << s);
+                for(int i = 1; i < s; i++){
+                    if((poly >> (s - i)) & 1U)
+                        m[k] ^= m[k - i] << i;
+                }
+            }
+            directions[j * SOBOL_BITS + k] = (uint32_t)(m[k] << (SOBOL_BITS - 1 - k));
+        }
+    }
+    free(polys);
+    free(degrees);
+}
+
+static void drawPermutation(RandStream* rng, int purpose, int index, int* perm, double* uniforms, int size){
+    /*!
+     * Fill the uniforms for this index in a single bulk call then shuffle the identity with Fisher-Yates.
+     */
+    fillDblAt(rng, purpose, index, LDS_PERM_PARTNER, uniforms, size, 0, 1);
+    for(int k = 0; k < size; k++)
+        perm[k] = k;
+    for(int k = size - 1; k > 0; k--){
+        int r = (int)(uniforms[k] * (k + 1)); /*!< The position to swap with in [0, k]*/
+        if(r > k)
+            r = k;
+        int t = perm[k];
+        perm[k] = perm[r];
+        perm[r] = t;
+    }
+}
+
+void fillLowDiscrepancy(int initializer, RandStream* rng, int purpose, Matrix* matrix, double min, double max){
+    if(initializer == SobolInit)
+        fillSobol(rng, purpose, matrix, min, max);
+    else if(initializer == HaltonInit)
+        fillHalton(rng, purpose, matrix, min, max);
+    else if(initializer == LatinHypercubeInit)
+        fillLatinHypercube(rng, purpose, matrix, min, max);
+}
+
+void fillSobol(RandStream* rng, int purpose, Matrix* matrix, double min, double max){
+    int numVec = matrix->rows, /*!< The number of points to generate*/
+    dim = matrix->cols; /*!< The number of dimensions of every point*/
+    uint32_t* directions = calloc((size_t)dim * SOBOL_BITS, sizeof(uint32_t)), /*!< The direction numbers of every dimension*/
+    *point = calloc(dim, sizeof(uint32_t)), /*!< The current point of the sequence*/
+    *shift = calloc(dim, sizeof(uint32_t)); /*!< The random digital shift of every dimension*/
+    double* uniforms = calloc(dim, sizeof(double)); /*!< The uniform values the shifts are made from*/
+    double scale = (max - min) / 4294967296.0; /*!< Maps a 32 bit point onto the range*/
+    sobolDirections(directions, dim);
+    fillDblAt(rng, purpose, 0, LDS_SHIFT_PARTNER, uniforms, dim, 0, 1);
+    for(int j = 0; j < dim; j++)
+        shift[j] = (uint32_t)(uniforms[j] * 4294967296.0);
+    /*!
+     * Walk the sequence in Gray code order, so every point only differs from the previous one by a single direction
+     * number, the one at the lowest set bit of the index.
+     */
+    for(int i = 0; i < numVec; i++){
+        if(i > 0){
+            int c = 0; /*!< The position of the lowest set bit of i*/
+            while(!((i >> c) & 1))
+                c++;
+            for(int j = 0; j < dim; j++)
+                point[j] ^= directions[j * SOBOL_BITS + c];
+        }
+        for(int j = 0; j < dim; j++)
+            matrixRow(matrix, i)[j] = min + (double)(point[j] ^ shift[j]) * scale;
+    }
+    free(directions);
+    free(point);
+    free(shift);
+    free(uniforms);
+}
+
+void fillHalton(RandStream* rng, int purpose, Matrix* matrix, double min, double max){
+    int numVec = matrix->rows, /*!< The number of points to generate*/
+    dim = matrix->cols; /*!< The number of dimensions of every point*/
+    double range = max - min; /*!< The width of the range being filled*/
+    int base = 1; /*!< The prime base of the current dimension*/
+    /*!
+     * Every dimension uses the next prime as its base and scrambles every digit with its own random permutation. All
+     * digits down to the precision of a double are summed, so a permutation moving 0 still applies to the trailing zeros.
+     */
+    for(int j = 0; j < dim; j++){
+        int prime = 0;
+        while(!prime){
+            base++;
+            prime = 1;
+            for(int q = 2; q * q <= base && prime; q++)
+                prime = base % q != 0;
+        }
+        int* perm = calloc(base, sizeof(int)); /*!< The digit permutation of this dimension*/
+        double* uniforms = calloc(base, sizeof(double)); /*!< The uniform values the permutation is made from*/
+        drawPermutation(rng, purpose, j, perm, uniforms, base);
+        for(int i = 0; i < numVec; i++){
+            double value = 0, /*!< The radical inverse of i*/
+            weight = 1.0 / base; /*!< The weight of the current digit*/
+            int n = i; /*!< The digits of i not yet used*/
+            while(weight > DBL_EPSILON){
+                value += perm[n % base] * weight;
+                n /= base;
+                weight /= base;
+            }
+            matrixRow(matrix, i)[j] = min + value * range;
+        }
+        free(perm);
+        free(uniforms);
+    }
+}
+
+void fillLatinHypercube(RandStream* rng, int purpose, Matrix* matrix, double min, double max){
+    int numVec = matrix->rows, /*!< The number of points to generate*/
+    dim = matrix->cols; /*!< The number of dimensions of every point*/
+    double width = (max - min) / numVec; /*!< The width of a single stratum*/
+    int* perm = calloc(numVec, sizeof(int)); /*!< The stratum of every row in the current dimension*/
+    double* uniforms = calloc(numVec, sizeof(double)), /*!< The uniform values the permutation is made from*/
+    *jitter = calloc(numVec, sizeof(double)); /*!< The position of every value inside its stratum*/
+    /*!
+     * Give every dimension its own random assignment of rows to strata and place each value uniformly inside its stratum.
+     */
+    for(int j = 0; j < dim; j++){
+        drawPermutation(rng, purpose, j, perm, uniforms, numVec);
+        fillDblAt(rng, purpose, j, LDS_JITTER_PARTNER, jitter, numVec, 0, 1);
+        for(int i = 0; i < numVec; i++)
+            matrixRow(matrix, i)[j] = min + (perm[i] + jitter[i]) * width;
+    }
+    free(perm);
+    free(uniforms);
+    free(jitter);
+}
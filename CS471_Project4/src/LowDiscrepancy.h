@@ -0,0 +1,63 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file LowDiscrepancy.h
+ * \brief This is where the low discrepancy initializers for the initial populations and velocities are defined.
+ *
+ *  Instead of drawing every value independently, these fill a whole matrix at once so its rows cover the search space
+ *  evenly: a Sobol sequence, a scrambled Halton sequence, or a Latin hypercube. Each is randomized with the random
+ *  stream of the run, so different experiments still start from different populations. Selected with the optional
+ *  'Initializer' line of the init file and called from createMatrix and createVelocities in src/MersenneMatrix.c.
+ */
+#ifndef TESTINGSUITE_LOWDISCREPANCY_H
+#define TESTINGSUITE_LOWDISCREPANCY_H
+
+#include "Utilities.h"
+
+#define SOBOL_BITS 32 /*!< declare the constant for the number of bits in every Sobol direction number and point*/
+#define LDS_PERM_PARTNER 1 /*!< declare the constant for the partner used to address the digit or stratum permutation draws*/
+#define LDS_JITTER_PARTNER 2 /*!< declare the constant for the partner used to address the Latin hypercube jitter draws*/
+#define LDS_SHIFT_PARTNER 3 /*!< declare the constant for the partner used to address the Sobol digital shift draws*/
+
+/// \fn void fillLowDiscrepancy(int initializer, RandStream* rng, int purpose, Matrix* matrix, double min, double max)
+/// \brief Fills every row of a matrix with the points of the selected low discrepancy initializer in the range [min, max).
+///
+/// \param initializer - the Initializer enum value selecting the sequence, UniformInit is not handled here
+/// \param rng - the RandStream of the run used to randomize the sequence
+/// \param purpose - the RandPurpose enum value the randomization is drawn for
+/// \param matrix - the matrix to fill, every row is a point
+/// \param min - the inclusive lower bound of the values
+/// \param max - the exclusive upper bound of the values
+void fillLowDiscrepancy(int initializer, RandStream* rng, int purpose, Matrix* matrix, double min, double max);
+/// \fn void fillSobol(RandStream* rng, int purpose, Matrix* matrix, double min, double max)
+/// \brief Fills every row of the matrix with the next point of a Sobol sequence with a random digital shift.
+///
+/// \param rng - the RandStream of the run used to draw the digital shift
+/// \param purpose - the RandPurpose enum value the shift is drawn for
+/// \param matrix - the matrix to fill, every row is a point
+/// \param min - the inclusive lower bound of the values
+/// \param max - the exclusive upper bound of the values
+void fillSobol(RandStream* rng, int purpose, Matrix* matrix, double min, double max);
+/// \fn void fillHalton(RandStream* rng, int purpose, Matrix* matrix, double min, double max)
+/// \brief Fills every row of the matrix with the next point of a Halton sequence with a random digit
+/// permutation for every dimension.
+///
+/// \param rng - the RandStream of the run used to draw the digit permutations
+/// \param purpose - the RandPurpose enum value the permutations are drawn for
+/// \param matrix - the matrix to fill, every row is a point
+/// \param min - the inclusive lower bound of the values
+/// \param max - the exclusive upper bound of the values
+void fillHalton(RandStream* rng, int purpose, Matrix* matrix, double min, double max);
+/// \fn void fillLatinHypercube(RandStream* rng, int purpose, Matrix* matrix, double min, double max)
+/// \brief Fills the matrix with a Latin hypercube sample. The range is split into one equal stratum per row, and every
+/// dimension has exactly one value in each stratum.
+///
+/// \param rng - the RandStream of the run used to draw the stratum permutations and the jitter inside them
+/// \param purpose - the RandPurpose enum value the sample is drawn for
+/// \param matrix - the matrix to fill, every row is a point
+/// \param min - the inclusive lower bound of the values
+/// \param max - the exclusive upper bound of the values
+void fillLatinHypercube(RandStream* rng, int purpose, Matrix* matrix, double min, double max);
+
+#endif //TESTINGSUITE_LOWDISCREPANCY_H
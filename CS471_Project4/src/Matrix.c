@@ -0,0 +1,91 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Matrix.c
+ * \brief This is where all methods defined in src/Matrix.h are implemented.
+ *
+ */
+#include "Matrix.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef WIN32
+#include <malloc.h>
+#define THREAD_LOCAL __declspec(thread)
+#else
+#define THREAD_LOCAL _Thread_local
+#endif
+
+static THREAD_LOCAL long heapAllocations = 0; /*!< The number of allocations made by this thread*/
+
+void* alignedCalloc(size_t count, size_t size){
+    size_t bytes = count * size; /*!< The total number of bytes requested*/
+    void* ptr = NULL; /*!< The aligned memory to be returned*/
+    countHeapAllocation();
+    if(bytes == 0)
+        bytes = MATRIX_ALIGNMENT; ///always hand back a valid pointer that can be freed
+#ifdef WIN32
+    ptr = _aligned_malloc(bytes, MATRIX_ALIGNMENT); ///allocate the aligned memory WIN32
+#else
+    if(posix_memalign(&ptr, MATRIX_ALIGNMENT, bytes) != 0) ///allocate the aligned memory POSIX
+        ptr = NULL;
+#endif
+    if(ptr)
+        memset(ptr, 0, bytes);
+    return ptr;
+}
+
+void countHeapAllocation(void){
+    heapAllocations++;
+}
+
+long heapAllocationCount(void){
+    return heapAllocations;
+}
+
+void alignedFree(void* ptr){
+#ifdef WIN32
+    _aligned_free(ptr); ///free the aligned memory WIN32
+#else
+    free(ptr); ///free the aligned memory POSIX
+#endif
+}
+
+int matrixStride(int cols){
+    return (cols + MATRIX_ALIGN_VALUES - 1) / MATRIX_ALIGN_VALUES * MATRIX_ALIGN_VALUES;
+}
+
+Matrix allocateEmptyMatrix(int rows, int cols){
+    Matrix matrix; /*!< Declare the matrix to be returned*/
+    matrix.rows = rows;
+    matrix.cols = cols;
+    matrix.stride = matrixStride(cols);
+    matrix.data = alignedCalloc((size_t)rows * matrix.stride, sizeof(Real)); ///allocate every row in a single block, padding included
+    if(!matrix.data){ ///if the memory could not be allocated tell the user and exit failure
+        fprintf(stderr, "There was an issue allocating a %d x %d matrix.\n", rows, cols);
+        exit(EXIT_FAILURE);
+    }
+    return matrix;
+}
+
+void copyMatrix(const Matrix* in, Matrix* out){
+    memcpy(out->data, in->data, (size_t)in->rows * in->stride * sizeof(Real)); ///rows and padding are contiguous so the whole matrix is a single copy
+}
+
+void transposeMatrix(const Matrix* in, Matrix* out){
+    /*!
+     * Iterate through the rows of the matrix being transposed and store every value to the same column of the output.
+     */
+    for(int i = 0; i < in->rows; i++){
+        const Real* row = matrixRow(in, i); /*!< The row being transposed*/
+        for(int j = 0; j < in->cols; j++){
+            matrixRow(out, j)[i] = row[j];
+        }
+    }
+}
+
+void releaseMatrix(Matrix* matrix){
+    alignedFree(matrix->data);
+    matrix->data = NULL;
+}
@@ -0,0 +1,105 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Matrix.h
+ * \brief This is where the contiguous matrix type used for every population, velocity and personal best matrix is defined.
+ *
+ *  A Matrix is stored in a single allocation aligned to MATRIX_ALIGNMENT bytes. Every row starts at a multiple of the
+ *  stride, which is the number of columns padded up to a whole number of cache lines, so every row is aligned as well
+ *  and a whole matrix can be copied with a single memcpy.
+ *
+ *  The values are stored as Real, which is double unless the program is built with SINGLE_PRECISION defined. Single
+ *  precision halves the memory traffic of large populations, while the objective functions still accumulate in double.
+ */
+#ifndef TESTINGSUITE_MATRIX_H
+#define TESTINGSUITE_MATRIX_H
+
+#include <stddef.h>
+
+#ifdef SINGLE_PRECISION
+typedef float Real; /*!< The type every population, velocity and personal best value is stored as*/
+#else
+typedef double Real; /*!< The type every population, velocity and personal best value is stored as*/
+#endif
+
+#define MATRIX_ALIGNMENT 64 /*!< declare the constant for the alignment in bytes of every matrix and every row*/
+#define MATRIX_ALIGN_VALUES (MATRIX_ALIGNMENT / (int)sizeof(Real)) /*!< declare the constant for the number of values in one alignment block*/
+
+/*!
+ * A rows x cols matrix of Real values in a single aligned allocation, where row i starts at data + i * stride.
+ */
+typedef struct _Matrix{
+    Real* data;
+    int rows;
+    int cols;
+    int stride;
+}Matrix;
+
+/// \fn Real* matrixRow(const Matrix* matrix, int row)
+/// \brief Returns the start of a row of the matrix.
+///
+/// \param matrix - the matrix holding the row
+/// \param row - the position of the row
+/// \return a pointer to the first value of the row, aligned to MATRIX_ALIGNMENT bytes
+static inline Real* matrixRow(const Matrix* matrix, int row){
+    return matrix->data + (size_t)row * matrix->stride;
+}
+
+/// \fn void* alignedCalloc(size_t count, size_t size)
+/// \brief Allocates zeroed memory aligned to MATRIX_ALIGNMENT bytes. Must be released with alignedFree.
+///
+/// \param count - the number of elements to allocate
+/// \param size - the size of a single element
+/// \return the aligned memory, or NULL if it could not be allocated
+void* alignedCalloc(size_t count, size_t size);
+/// \fn void countHeapAllocation(void)
+/// \brief Counts an allocation made by the calling thread. alignedCalloc calls it, and the test build of
+/// src/Tests/HeapAllocationTest.c calls it from its wrappers of malloc, calloc and realloc so every allocator is counted.
+void countHeapAllocation(void);
+/// \fn long heapAllocationCount(void)
+/// \brief Returns the number of allocations counted for the calling thread. The algorithms compare it before and after
+/// their iterations to record whether the main loops reached the heap.
+///
+/// \return the number of allocations made by the calling thread
+long heapAllocationCount(void);
+/// \fn void alignedFree(void* ptr)
+/// \brief Frees memory allocated by alignedCalloc.
+///
+/// \param ptr - the memory to be freed
+void alignedFree(void* ptr);
+/// \fn int matrixStride(int cols)
+/// \brief Calculates the padded stride of a matrix with the given number of columns.
+///
+/// \param cols - the number of columns of the matrix
+/// \return cols rounded up to a multiple of MATRIX_ALIGN_VALUES
+int matrixStride(int cols);
+/// \fn Matrix allocateEmptyMatrix(int rows, int cols)
+/// \brief This is the method which allocates the space for an empty population of a certain size with a certain number of dimensions
+///
+/// \param rows - The number of rows to be allocated
+/// \param cols - The number of columns to be allocated per row
+/// \return returns an empty matrix with every value set to 0
+Matrix allocateEmptyMatrix(int rows, int cols);
+/// \fn void copyMatrix(const Matrix* in, Matrix* out)
+/// \brief This method is used to copy the values from one matrix into another of the same size with a single memcpy
+///
+/// \param in - the matrix to be copied
+/// \param out - the matrix to store the values being copied
+/// \return No return as it modifies the matrix directly
+void copyMatrix(const Matrix* in, Matrix* out);
+/// \fn void transposeMatrix(const Matrix* in, Matrix* out)
+/// \brief This method stores the transpose of a matrix into another, out must have in->cols rows and in->rows columns
+///
+/// \param in - the matrix to be transposed
+/// \param out - the matrix to store the transposed values
+/// \return No return as it modifies the matrix directly
+void transposeMatrix(const Matrix* in, Matrix* out);
+/// \fn void releaseMatrix(Matrix* matrix)
+/// \brief frees the storage of a matrix allocated with allocateEmptyMatrix
+///
+/// \param matrix - the matrix to be freed
+/// \return No return as it only frees memory
+void releaseMatrix(Matrix* matrix);
+
+#endif //TESTINGSUITE_MATRIX_H
@@ -0,0 +1,240 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Memetic.c
+ * \brief This is where the methods defined in src/Memetic.h are implemented.
+ *
+ */
+#include "Memetic.h"
+#include <float.h>
+
+/*!
+ * The relative size of the steps of a forward difference, the square root of the precision of Real.
+ */
+static double differenceStep(){
+    return sqrt(sizeof(Real) == sizeof(float) ? FLT_EPSILON : DBL_EPSILON);
+}
+
+static double dot(const double* a, const double* b, int count){
+    double sum = 0.0; /*!< The sum of the products*/
+    for(int i = 0; i < count; i++)
+        sum += a[i] * b[i];
+    return sum;
+}
+
+/*!
+ * Returns the fitness of a point and stores its gradient, analytic when the objective has a gradient function and a
+ * forward difference towards the inside of the range otherwise.
+ */
+static double evaluateGradient(Memetic* memetic, const double* point, double* gradient){
+    int dimensions = memetic->dimensions;
+    Real* vector = memetic->vector; /*!< The point converted to Real*/
+    double fitness, /*!< The fitness of the point*/
+    base, /*!< The coordinate being moved*/
+    step; /*!< The distance it was moved, after rounding to Real*/
+    for(int j = 0; j < dimensions; j++)
+        vector[j] = (Real)point[j];
+    if(memetic->objective.gradient){
+        memetic->evaluations++;
+        return memetic->objective.gradient(vector, dimensions, gradient);
+    }
+    fitness = memetic->objective.function(vector, dimensions);
+    /*!
+     * Move every coordinate in turn by a step relative to its size, backwards when the step would leave the range.
+     */
+    for(int j = 0; j < dimensions; j++){
+        base = vector[j];
+        step = differenceStep() * (fabs(base) > 1.0 ? fabs(base) : 1.0);
+        vector[j] = (Real)(base + step <= memetic->upper ? base + step : base - step);
+        step = vector[j] - base;
+        gradient[j] = step != 0.0 ? (memetic->objective.function(vector, dimensions) - fitness) / step : 0.0;
+        vector[j] = (Real)base;
+    }
+    memetic->evaluations += dimensions + 1;
+    return fitness;
+}
+
+/*!
+ * Stores the L-BFGS direction from the gradient at the current point into direction, with the two loop recursion over
+ * the remembered steps, newest first and then oldest first.
+ */
+static void quasiNewtonDirection(Memetic* memetic){
+    int dimensions = memetic->dimensions,
+    row; /*!< The row of the step being applied*/
+    double* direction = memetic->direction,
+    scale; /*!< The scale of the initial inverse Hessian, from the newest step*/
+    for(int j = 0; j < dimensions; j++)
+        direction[j] = -memetic->gradient[j];
+    if(memetic->numPairs == 0)
+        return;
+    for(int k = 0; k < memetic->numPairs; k++){
+        row = (memetic->newest - k + MEMETIC_MEMORY) % MEMETIC_MEMORY;
+        const double* step = memetic->steps + (long)row * dimensions, *change = memetic->changes + (long)row * dimensions;
+        memetic->weights[row] = memetic->curvature[row] * dot(step, direction, dimensions);
+        for(int j = 0; j < dimensions; j++)
+            direction[j] -= memetic->weights[row] * change[j];
+    }
+    row = memetic->newest;
+    scale = 1.0 / (memetic->curvature[row] * dot(memetic->changes + (long)row * dimensions, memetic->changes + (long)row * dimensions, dimensions));
+    for(int j = 0; j < dimensions; j++)
+        direction[j] *= scale;
+    for(int k = memetic->numPairs - 1; k >= 0; k--){
+        row = (memetic->newest - k + MEMETIC_MEMORY) % MEMETIC_MEMORY;
+        const double* step = memetic->steps + (long)row * dimensions, *change = memetic->changes + (long)row * dimensions;
+        double correction = memetic->weights[row] - memetic->curvature[row] * dot(change, direction, dimensions); /*!< The weight of the step in the second loop*/
+        for(int j = 0; j < dimensions; j++)
+            direction[j] += correction * step[j];
+    }
+}
+
+/*!
+ * Zeroes the coordinates of the direction which would move a coordinate at a bound out of the range, and returns the
+ * slope of the fitness along what is left.
+ */
+static double holdBounds(Memetic* memetic){
+    double* direction = memetic->direction;
+    for(int j = 0; j < memetic->dimensions; j++){
+        if((memetic->point[j] <= memetic->lower && direction[j] < 0.0) || (memetic->point[j] >= memetic->upper && direction[j] > 0.0))
+            direction[j] = 0.0;
+    }
+    return dot(memetic->gradient, direction, memetic->dimensions);
+}
+
+size_t memeticBytes(int dimensions){
+    return arenaBlockBytes(1, sizeof(Memetic)) + 7 * arenaBlockBytes(dimensions, sizeof(double))
+           + 2 * arenaBlockBytes((size_t)MEMETIC_MEMORY * dimensions, sizeof(double)) + 2 * arenaBlockBytes(MEMETIC_MEMORY, sizeof(double))
+           + arenaBlockBytes(dimensions, sizeof(Real));
+}
+
+Memetic* createMemetic(EquationInfo info){
+    if(info.memetic <= 0)
+        return NULL;
+    int dimensions = info.dimToTest;
+    Memetic* memetic = arenaAlloc(info.arena, 1, sizeof(Memetic)); /*!< The refinement to be returned*/
+    memetic->period = info.memetic;
+    memetic->dimensions = dimensions;
+    memetic->objective = info.objective;
+    memetic->lower = info.range[RANGE_MIN_POS];
+    memetic->upper = info.range[RANGE_MAX_POS];
+    memetic->point = arenaAlloc(info.arena, dimensions, sizeof(double));
+    memetic->gradient = arenaAlloc(info.arena, dimensions, sizeof(double));
+    memetic->trial = arenaAlloc(info.arena, dimensions, sizeof(double));
+    memetic->trialGradient = arenaAlloc(info.arena, dimensions, sizeof(double));
+    memetic->direction = arenaAlloc(info.arena, dimensions, sizeof(double));
+    memetic->step = arenaAlloc(info.arena, dimensions, sizeof(double));
+    memetic->change = arenaAlloc(info.arena, dimensions, sizeof(double));
+    memetic->steps = arenaAlloc(info.arena, (size_t)MEMETIC_MEMORY * dimensions, sizeof(double));
+    memetic->changes = arenaAlloc(info.arena, (size_t)MEMETIC_MEMORY * dimensions, sizeof(double));
+    memetic->curvature = arenaAlloc(info.arena, MEMETIC_MEMORY, sizeof(double));
+    memetic->weights = arenaAlloc(info.arena, MEMETIC_MEMORY, sizeof(double));
+    memetic->vector = arenaAlloc(info.arena, dimensions, sizeof(Real));
+    memetic->refinements = 0;
+    memetic->improved = 0;
+    memetic->evaluations = 0;
+    return memetic;
+}
+
+double refineVector(Memetic* memetic, const Real* start, double fitness, Real* refined){
+    int dimensions = memetic->dimensions;
+    double current, /*!< The fitness at the current point*/
+    trialFit = 0.0, /*!< The fitness at the trial point*/
+    slope, /*!< The slope of the fitness along the direction*/
+    length, /*!< The length of the step along the direction*/
+    promised, /*!< The decrease the gradient promises for the trial point*/
+    sy; /*!< The product of the step and the change of the gradient over it*/
+    int accepted; /*!< Whether a step length was found*/
+    memetic->refinements++;
+    memetic->numPairs = 0;
+    memetic->newest = MEMETIC_MEMORY - 1;
+    for(int j = 0; j < dimensions; j++)
+        memetic->point[j] = start[j];
+    current = evaluateGradient(memetic, memetic->point, memetic->gradient);
+    for(int s = 0; s < MEMETIC_STEPS && isfinite(current); s++){
+        /*!
+         * Take the quasi-Newton direction, or the steepest descent with the curvature forgotten if it does not descend,
+         * and stop once neither does.
+         */
+        quasiNewtonDirection(memetic);
+        slope = holdBounds(memetic);
+        if(!(slope < 0.0) && memetic->numPairs > 0){
+            memetic->numPairs = 0;
+            quasiNewtonDirection(memetic);
+            slope = holdBounds(memetic);
+        }
+        if(!(slope < 0.0))
+            break;
+        length = memetic->numPairs > 0 ? 1.0 : fmin(1.0, 1.0 / sqrt(dot(memetic->direction, memetic->direction, dimensions))); ///without curvature the first step moves a unit distance at most
+        /*!
+         * Halve the step until the clamped trial point decreases the fitness by enough of what the gradient promises.
+         */
+        accepted = 0;
+        for(int b = 0; b < MEMETIC_BACKTRACKS && !accepted; b++, length *= 0.5){
+            promised = 0.0;
+            for(int j = 0; j < dimensions; j++){
+                double value = memetic->point[j] + length * memetic->direction[j]; /*!< The coordinate of the trial point*/
+                value = value < memetic->lower ? memetic->lower : value;
+                value = value > memetic->upper ? memetic->upper : value;
+                memetic->trial[j] = value;
+                promised += memetic->gradient[j] * (value - memetic->point[j]);
+            }
+            trialFit = evaluateGradient(memetic, memetic->trial, memetic->trialGradient);
+            accepted = trialFit < current && trialFit <= current + MEMETIC_ARMIJO * promised;
+        }
+        if(!accepted)
+            break;
+        /*!
+         * Remember the step and the change of the gradient over it when the curvature along it is positive, replacing
+         * the oldest pair only then, and move.
+         */
+        for(int j = 0; j < dimensions; j++){
+            memetic->step[j] = memetic->trial[j] - memetic->point[j];
+            memetic->change[j] = memetic->trialGradient[j] - memetic->gradient[j];
+        }
+        sy = dot(memetic->step, memetic->change, dimensions);
+        if(sy > DBL_EPSILON * dot(memetic->change, memetic->change, dimensions)){
+            int row = (memetic->newest + 1) % MEMETIC_MEMORY; /*!< The row of the step, replacing the oldest*/
+            memcpy(memetic->steps + (long)row * dimensions, memetic->step, dimensions * sizeof(double));
+            memcpy(memetic->changes + (long)row * dimensions, memetic->change, dimensions * sizeof(double));
+            memetic->curvature[row] = 1.0 / sy;
+            memetic->newest = row;
+            if(memetic->numPairs < MEMETIC_MEMORY)
+                memetic->numPairs++;
+        }
+        memcpy(memetic->point, memetic->trial, dimensions * sizeof(double));
+        memcpy(memetic->gradient, memetic->trialGradient, dimensions * sizeof(double));
+        current = trialFit;
+    }
+    if(!(current < fitness))
+        return fitness;
+    /*!
+     * Evaluate the point reached with the function of the run, and only keep it if that fitness is lower as well.
+     */
+    for(int j = 0; j < dimensions; j++)
+        memetic->vector[j] = (Real)memetic->point[j];
+    current = memetic->objective.function(memetic->vector, dimensions);
+    memetic->evaluations++;
+    if(!(current < fitness))
+        return fitness;
+    memcpy(refined, memetic->vector, dimensions * sizeof(Real));
+    memetic->improved++;
+    return current;
+}
+
+double refineSlot(Memetic* memetic, RowPool* pool, int slot, double fitness){
+    int shared = slotShared(pool, slot); /*!< Whether anything else refers to the row of the slot*/
+    Real* refined = shared ? poolScratch(pool) : poolRow(pool, slot); /*!< A shared row is left as it is and the refined vector is built in the scratch row*/
+    double result = refineVector(memetic, poolRow(pool, slot), fitness, refined); /*!< The fitness of the slot afterwards*/
+    if(shared && result < fitness)
+        acceptScratch(pool, slot);
+    return result;
+}
+
+void printRefinements(){
+    long refinements, /*!< The refinements of every run*/
+    improved, /*!< The number of them which replaced the best vector*/
+    evaluations; /*!< The evaluations they made*/
+    readRefinements(&refinements, &improved, &evaluations);
+    if(refinements > 0)
+        printf("Memetic refinements improving the best: %ld of %ld (%.1f%%), using %ld evaluations\n", improved, refinements, 100.0 * improved / refinements, evaluations);
+}
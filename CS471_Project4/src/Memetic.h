@@ -0,0 +1,120 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Memetic.h
+ * \brief This is where the memetic refinement of the best vector of a run is defined.
+ *
+ *  Near an optimum the Particle Swarm, the Firefly Algorithm and the Harmonic Search move by random steps, and spend
+ *  thousands of iterations on the last few digits of the fitness. With the optional 'Memetic Refinement' line every
+ *  run refines its best vector every so many iterations with a few steps of a limited memory quasi-Newton method
+ *  (L-BFGS), which follows the gradient of src/Gradients.h and the curvature of the last MEMETIC_MEMORY steps.
+ *
+ *  - Every step takes the direction of the two loop recursion of L-BFGS, holding the coordinates at a bound of the range
+ *    which the direction would move out of it, and backtracks from the full step until the fitness decreases by at
+ *    least MEMETIC_ARMIJO of what the gradient promises, clamping every trial vector to the range.
+ *  - The curvature is forgotten at the start of every refinement, as the best vector may have moved to another basin.
+ *  - The objective plugins without a gradient function, the formulas and the variants are refined with a forward
+ *    difference gradient, which costs a whole evaluation per dimension.
+ *  - The refined vector is evaluated once more by the function of the run, so its fitness is exactly what the
+ *    algorithm would have calculated for it, and it only replaces the best vector when that fitness is lower.
+ *
+ *  The buffers of the refinement are allocated from the arena of the run, so the refinement never touches the heap.
+ */
+#ifndef TESTINGSUITE_MEMETIC_H
+#define TESTINGSUITE_MEMETIC_H
+
+#include "Utilities.h"
+
+#define MEMETIC_MEMORY 6 /*!< declare the constant for the number of steps whose curvature the refinement remembers*/
+#define MEMETIC_STEPS 20 /*!< declare the constant for the most quasi-Newton steps of a single refinement*/
+#define MEMETIC_BACKTRACKS 30 /*!< declare the constant for the most times a step is halved before the refinement stops*/
+#define MEMETIC_ARMIJO 1e-4 /*!< declare the constant for the share of the decrease promised by the gradient a step must reach*/
+
+/*!
+ * The state of the refinement of a single run. The points and gradients are held in double precision whatever Real is,
+ * and vector holds the point being evaluated converted to Real.
+ */
+typedef struct _Memetic{
+    int period; /*!< The number of iterations between refinements*/
+    int dimensions;
+    Objective objective;
+    double lower;
+    double upper;
+    double* point;
+    double* gradient;
+    double* trial;
+    double* trialGradient;
+    double* direction;
+    double* step; /*!< The step just taken, kept apart from the remembered steps until its curvature is checked*/
+    double* change; /*!< The change of the gradient over it*/
+    double* steps; /*!< The last MEMETIC_MEMORY steps, one row of dimensions values per step*/
+    double* changes; /*!< The change of the gradient over every step, in the same rows*/
+    double* curvature; /*!< 1 / (step . change) of every step*/
+    double* weights; /*!< The weights of the first loop of the recursion*/
+    int numPairs; /*!< The number of steps remembered*/
+    int newest; /*!< The row of the newest step*/
+    Real* vector;
+    long refinements; /*!< The number of refinements run*/
+    long improved; /*!< The number of them which replaced the best vector*/
+    long evaluations; /*!< The number of evaluations they made, every dimension of a forward difference counted*/
+}Memetic;
+
+/// \fn size_t memeticBytes(int dimensions)
+/// \brief Calculates how much of an arena createMemetic takes, used to size the arena of a run.
+///
+/// \param dimensions - the number of dimensions of every vector
+/// \return the number of bytes
+size_t memeticBytes(int dimensions);
+/// \fn Memetic* createMemetic(EquationInfo info)
+/// \brief Allocates the refinement of a run from its arena when the memetic refinement line turned it on.
+///
+/// \param info - the EquationInfo struct housing equation specific info
+/// \return the refinement, or NULL when it is off
+Memetic* createMemetic(EquationInfo info);
+/// \fn int refinementDue(const Memetic* memetic, int iteration)
+/// \brief Checks whether the best vector is refined at the end of an iteration.
+///
+/// \param memetic - the refinement of the run, or NULL when it is off
+/// \param iteration - the iteration which just ended, from 0
+/// \return 1 if the best vector is refined, 0 otherwise
+static inline int refinementDue(const Memetic* memetic, int iteration){
+    return memetic && (iteration + 1) % memetic->period == 0;
+}
+/// \fn double refineVector(Memetic* memetic, const Real* start, double fitness, Real* refined)
+/// \brief Runs up to MEMETIC_STEPS quasi-Newton steps from a vector, storing the vector reached if its fitness is lower.
+///
+/// \param memetic - the refinement of the run
+/// \param start - the vector being refined
+/// \param fitness - the fitness of the vector
+/// \param refined - stores the refined vector when its fitness is lower, which may be start itself
+/// \return the fitness of the refined vector, or fitness if it was not lower and refined is untouched
+double refineVector(Memetic* memetic, const Real* start, double fitness, Real* refined);
+/// \fn double refineSlot(Memetic* memetic, RowPool* pool, int slot, double fitness)
+/// \brief Refines the vector of a slot of a population, building it in the scratch row and handing that to the slot
+/// when the row of the slot is shared or pinned, and in the row itself otherwise.
+///
+/// \param memetic - the refinement of the run
+/// \param pool - the pool holding the population
+/// \param slot - the slot of the vector being refined
+/// \param fitness - the fitness of the vector
+/// \return the fitness of the vector of the slot afterwards
+double refineSlot(Memetic* memetic, RowPool* pool, int slot, double fitness);
+/// \fn void recordRefinements(const Memetic* memetic)
+/// \brief Adds the refinements of a run, how many of them replaced the best vector and the evaluations they made to
+/// the totals of the program. Implemented for each platform in src/PThread/UtilP.c and src/Win32/Util32.c.
+///
+/// \param memetic - the refinement of the run, or NULL when it is off
+void recordRefinements(const Memetic* memetic);
+/// \fn void readRefinements(long* refinements, long* improved, long* evaluations)
+/// \brief Reads the totals of the program added with recordRefinements.
+///
+/// \param refinements - stores the number of refinements of every run
+/// \param improved - stores the number of them which replaced the best vector
+/// \param evaluations - stores the number of evaluations they made
+void readRefinements(long* refinements, long* improved, long* evaluations);
+/// \fn void printRefinements()
+/// \brief Prints how many of the refinements replaced the best vector and the evaluations they made, if any were run.
+void printRefinements();
+
+#endif //TESTINGSUITE_MEMETIC_H
@@ -0,0 +1,77 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file MemoryPlan.c
+ * \brief This is where all methods defined in src/MemoryPlan.h are implemented.
+ *
+ */
+#include "MemoryPlan.h"
+
+static const char* algorithmNames[] = {"Particle Swarm", "Firefly", "Harmonic Search"}; /*!< The name of every TestType for the plan*/
+
+static double toMegabytes(size_t bytes){
+    return (double)bytes / BYTES_PER_MB;
+}
+
+size_t taskBytes(const Info* info, int dimIndex){
+    return runArenaBytes(info->testSelection, info->layout, info->updateOrder, info->numVectors, info->dimsToTest[dimIndex], info->fitnessCache, info->memetic);
+}
+
+int nextTaskBatch(const Info* info, int firstDim, int lastDim, size_t* bytes){
+    int end = firstDim + 1; /*!< One past the last dimension of the batch, which always holds the first*/
+    *bytes = taskBytes(info, firstDim);
+    /*!
+     * Add the following dimensions while they still fit under the cap, or all of them if there is no cap.
+     */
+    while(end < lastDim){
+        size_t next = taskBytes(info, end); /*!< The memory of the next dimension*/
+        if(info->memoryCap && *bytes + next > info->memoryCap)
+            break;
+        *bytes += next;
+        end++;
+    }
+    return end;
+}
+
+size_t plannedPeakBytes(const Info* info){
+    int firstDim = info->replay ? info->replayDimIndex : 0, /*!< The first dimension which will be run*/
+    lastDim = info->replay ? info->replayDimIndex + 1 : info->numDimensions, /*!< One past the last dimension which will be run*/
+    numEq = info->replay ? 1 : info->numEquations + info->numPlugins + info->numFormulas + info->numVariants; /*!< The number of equations which will be run, the objective plugins, formulas and variants included*/
+    size_t equation = 0, /*!< The memory of every dimension of one equation*/
+    largest = 0; /*!< The memory of the largest single task*/
+    for(int i = firstDim; i < lastDim; i++){
+        size_t bytes = taskBytes(info, i);
+        equation += bytes;
+        if(bytes > largest)
+            largest = bytes;
+    }
+    size_t peak = equation * numEq; /*!< Every dimension of every equation running at once*/
+    /*!
+     * With a cap the tasks running together never go over it, unless a single task is larger and runs on its own.
+     */
+    if(info->memoryCap && peak > info->memoryCap)
+        peak = largest > info->memoryCap ? largest : info->memoryCap;
+    return peak;
+}
+
+void printMemoryPlan(const Info* info){
+    int firstDim = info->replay ? info->replayDimIndex : 0, /*!< The first dimension which will be run*/
+    lastDim = info->replay ? info->replayDimIndex + 1 : info->numDimensions, /*!< One past the last dimension which will be run*/
+    numEq = info->replay ? 1 : info->numEquations + info->numPlugins + info->numFormulas + info->numVariants; /*!< The number of equations which will be run, the objective plugins, formulas and variants included*/
+    size_t equation = 0, /*!< The memory of every dimension of one equation*/
+    peak = plannedPeakBytes(info), /*!< The planned peak of the whole grid*/
+    physical = physicalMemoryBytes(); /*!< The physical memory of the machine*/
+    printf("Memory plan for %s with %d vectors:\n", algorithmNames[info->testSelection], info->numVectors);
+    for(int i = firstDim; i < lastDim; i++){
+        size_t bytes = taskBytes(info, i);
+        equation += bytes;
+        printf("  %d dimensions: %.2f MB per task\n", info->dimsToTest[i], toMegabytes(bytes));
+    }
+    printf("  %d tasks, %.2f MB per equation, %.2f MB for all %d equations at once\n", (lastDim - firstDim) * numEq, toMegabytes(equation), toMegabytes(equation * numEq), numEq);
+    if(info->memoryCap)
+        printf("  Memory cap: %.2f MB, planned peak: %.2f MB\n", toMegabytes(info->memoryCap), toMegabytes(peak));
+    if(physical && peak > physical)
+        printf("  Warning: the planned peak is more than the %.2f MB of physical memory, consider the 'Memory Cap' line.\n", toMegabytes(physical));
+    fflush(stdout);
+}
@@ -0,0 +1,51 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file MemoryPlan.h
+ * \brief This is where the memory planner for the whole experiment grid is defined.
+ *
+ *  Every run of a dimension is a task whose memory is exactly its arena, sized by runArenaBytes in src/Utilities.h for
+ *  the selected algorithm. The plan adds the tasks of every equation up before any run starts and prints the peak, so an
+ *  init file asking for more than the machine has is caught up front. With the optional 'Memory Cap' line the equation
+ *  handlers run their dimensions in batches which fit under the cap, and wait in acquireMemory until the batches of the
+ *  other equations leave room for them.
+ */
+#ifndef TESTINGSUITE_MEMORYPLAN_H
+#define TESTINGSUITE_MEMORYPLAN_H
+
+#include "Utilities.h"
+
+/// \fn size_t taskBytes(const Info* info, int dimIndex)
+/// \brief Calculates the memory of a single run of the selected algorithm for one of the dimensions to test.
+///
+/// \param info - the Info struct read from the init file, with the test selected
+/// \param dimIndex - the position of the dimensions in the list of dimensions to test
+/// \return the number of bytes of the arena of the run
+size_t taskBytes(const Info* info, int dimIndex);
+/// \fn int nextTaskBatch(const Info* info, int firstDim, int lastDim, size_t* bytes)
+/// \brief Finds the batch of dimensions starting at firstDim which an equation runs at once. Without a cap this is every
+/// remaining dimension, otherwise as many as fit under the cap together, and always at least one.
+///
+/// \param info - the Info struct read from the init file, with the test selected
+/// \param firstDim - the position of the first dimension of the batch
+/// \param lastDim - one past the position of the last dimension which may be in the batch
+/// \param bytes - stores the memory of the whole batch
+/// \return one past the position of the last dimension of the batch
+int nextTaskBatch(const Info* info, int firstDim, int lastDim, size_t* bytes);
+/// \fn size_t plannedPeakBytes(const Info* info)
+/// \brief Calculates the most memory the runs of every equation use at once, which the cap lowers to the cap itself or to
+/// the largest single task if that does not fit under it.
+///
+/// \param info - the Info struct read from the init file, with the test selected
+/// \return the number of bytes
+size_t plannedPeakBytes(const Info* info);
+/// \fn void printMemoryPlan(const Info* info)
+/// \brief Prints the memory of a task for every dimension, of every equation and the planned peak, and warns if the peak
+/// is more than the physical memory of the machine.
+///
+/// \param info - the Info struct read from the init file, with the test selected
+/// \return No return as it simply prints to console
+void printMemoryPlan(const Info* info);
+
+#endif //TESTINGSUITE_MEMORYPLAN_H
@@ -10,77 +10,137 @@
 #include "Utilities.h"
 #include "MersenneMatrix.h"
 #include "m19937ar-cok.h"
+#include "LowDiscrepancy.h"
 
 
-double** createMatrix(EquationInfo info){
-    int numVec = info.numVectors, /*! < Storing the value for number of vectors to test locally*/
-    dim = info.dimToTest; /*! < Storing the value for the number of dimensions in the vector locally*/
+static void fillRowAt(EquationInfo info, int purpose, int particle, Real* row, double* buffer, double min, double max){
+#ifdef SINGLE_PRECISION
+    fillDblAt(info.rng, purpose, particle, 0, buffer, info.dimToTest, min, max); ///draw in double then round every value into the row
+    for(int j = 0; j < info.dimToTest; j++)
+        row[j] = (Real)buffer[j];
+#else
+    (void)buffer; ///only single precision draws through the buffer
+    fillDblAt(info.rng, purpose, particle, 0, row, info.dimToTest, min, max); ///the row is already double so draw straight into it
+#endif
+}
+
+void createMatrix(EquationInfo info, Matrix* matrix){
+    int numVec = info.numVectors; /*! < Storing the value for number of vectors to test locally*/
 
-    double** matrix = calloc(numVec, sizeof(double*)); /*! < Allocate the space for the return matrix of random values*/
-    double valInRange = 0.0, /*! < Declare and initialize the value which will be calculated and stored as one of the vector dimensions*/
-    minVal = info.range[RANGE_MIN_POS], /*! < Store the range minimum from the read in file for this equation locally for later calculations. RANGE_MIN_POS is defined in src/Utilities.h*/
+    double minVal = info.range[RANGE_MIN_POS], /*! < Store the range minimum from the read in file for this equation locally for later calculations. RANGE_MIN_POS is defined in src/Utilities.h*/
     maxVal = info.range[RANGE_MAX_POS]; /*! < Store the range maximum from the read in file for this equation locally for later calculations. RANGE_MAX_POS is defined in src/Utilities.h*/
     /*!
-     * Iterate through the matrix and allocate the space for the dimensions in each vector
+     * If a low discrepancy initializer was selected fill the whole matrix with it in the range [minVal, maxVal).
+     * Otherwise iterate through every row of the matrix and fill it with random double values in the range
+     * [minVal, maxVal) in a single bulk call.
      */
-    for(int i = 0; i < numVec; i++){
-        matrix[i] = calloc(dim, sizeof(double));
-    }
-    /*!
-     * Iterate through every matrix position of matrix[i][j] and generate a random double value in the range
-     * [minVal, maxVal]. Then finally store that value in matrix[i][j] and repeat till all values are set.
-     */
-    for (int i = 0; i < numVec; i++){
-        for(int j = 0; j < dim; j++){
-            valInRange = genDblInRange(minVal, maxVal);
-            matrix[i][j] = valInRange;
+    if(info.initializer != UniformInit){
+        fillLowDiscrepancy(info.initializer, info.rng, RandPopulation, matrix, minVal, maxVal);
+    }else{
+        double* buffer = NULL; /*!< The draws of a single row before they are rounded to single precision*/
+#ifdef SINGLE_PRECISION
+        int dim = info.dimToTest; /*! < Storing the value for the number of dimensions in the vector locally*/
+        buffer = arenaAlloc(info.arena, dim, sizeof(double));
+#endif
+        for (int i = 0; i < numVec; i++){
+            fillRowAt(info, RandPopulation, i, matrixRow(matrix, i), buffer, minVal, maxVal);
         }
     }
-
-    /// Return the randomly generated matrix.
-    return matrix;
 }
 
-double** createVelocities(EquationInfo info){
+Matrix createVelocities(EquationInfo info){
     int numVec = info.numVectors, /*! < Storing the value for number of vectors to test locally*/
             dim = info.dimToTest; /*! < Storing the value for the number of dimensions in the vector locally*/
     double minVal = info.range[RANGE_MIN_POS], /*! < Store the range minimum from the read in file for this equation locally for later calculations. RANGE_MIN_POS is defined in src/Utilities.h*/
     maxVal = info.range[RANGE_MAX_POS], /*! < Store the range maximum from the read in file for this equation locally for later calculations. RANGE_MAX_POS is defined in src/Utilities.h*/
     range = maxVal - minVal; /*!< calculate the range of possible values as defined in info*/
-    double** matrix = calloc(numVec, sizeof(double*)); /*! < Allocate the space for the return matrix of random values*/
-    /*!
-     * Iterate through the matrix and allocate the space for the dimensions in each vector
-     */
-    for(int i = 0; i < numVec; i++){
-        matrix[i] = calloc(dim, sizeof(double));
-    }
+    Matrix matrix = arenaMatrix(info.arena, numVec, dim); /*! < Allocate the space for the return matrix of random values in a single block from the arena of the run*/
     /*!
-     * Iterate through every matrix position of matrix[i][j] and generate a random double value in the range
-     * [0, .5 * range]. Then finally store that value in matrix[i][j] and repeat till all values are set.
+     * If a low discrepancy initializer was selected fill the whole matrix with it in the range [0, .5 * range).
+     * Otherwise iterate through every row of the matrix and fill it with random double values in the range
+     * [0, .5 * range) in a single bulk call.
      */
-    for (int i = 0; i < numVec; i++){
-        for(int j = 0; j < dim; j++) {
-            matrix[i][j] = genDblInRange(0, 0.5 * range);
+    if(info.initializer != UniformInit){
+        fillLowDiscrepancy(info.initializer, info.rng, RandVelocity, &matrix, 0, 0.5 * range);
+    }else{
+        double* buffer = NULL; /*!< The draws of a single row before they are rounded to single precision*/
+#ifdef SINGLE_PRECISION
+        buffer = arenaAlloc(info.arena, dim, sizeof(double));
+#endif
+        for (int i = 0; i < numVec; i++){
+            fillRowAt(info, RandVelocity, i, matrixRow(&matrix, i), buffer, 0, 0.5 * range);
         }
     }
     /// Return the randomly generated matrix.
     return matrix;
 }
 
-double genDblInRange(double min, double max){
-    double scalar = 0.0;
-    #ifdef WIN32
-        scalar = genRandReal32(); ///WIN32 version of mutex locking and generating random number
-    #else
-        scalar = genRandRealP(); ///Posix version of mutex locking and generating random number
-    #endif
+static uint64_t mixSeed(uint64_t z){
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+uint64_t deriveCellSeed(uint64_t seed, int equation, int dimIndex, int experiment){
+    /*!
+     * Fold each part of the position of the run into the master seed one at a time so every run gets an unrelated seed.
+     */
+    uint64_t h = mixSeed(seed + 0x9e3779b97f4a7c15ULL);
+    h = mixSeed(h ^ (uint32_t)equation);
+    h = mixSeed(h ^ (uint32_t)dimIndex);
+    h = mixSeed(h ^ (uint32_t)experiment);
+    return h;
+}
+
+int derivePrintExperiment(uint64_t seed, int equation, int dimIndex, int numExperiments){
+    ///use a position past any real experiment so the printed experiment is unrelated to the seeds of the runs
+    return (int)(deriveCellSeed(seed, equation, dimIndex, -1) % (uint64_t)numExperiments);
+}
+
+void seedRandStream(RandStream* rng, uint64_t cellSeed, int mode){
+    unsigned long key[] = {(unsigned long)(cellSeed & 0xffffffffUL), (unsigned long)(cellSeed >> 32)}; /*!< The initialization key identifying this run*/
+    init_by_array_r(&rng->mt, key, sizeof(key) / sizeof(key[0])); ///seed the thread's own Mersenne Twister state with the key
+    uint64_t bulkSeed = (uint64_t)genrand_int32_r(&rng->mt) << 32; /*!< Draw the seed for the bulk generator from the seeded stream*/
+    bulkSeed |= genrand_int32_r(&rng->mt);
+    seedBulkRand(&rng->bulk, bulkSeed);
+    rng->mode = mode;
+    rng->key = makeCounterKey(cellSeed); ///derive the counter based key from the same seed
+    rng->iteration = RAND_INIT_ITERATION; ///values drawn before the first iteration use their own iteration in the address
+}
+
+void setRandIteration(RandStream* rng, int iteration){
+    rng->iteration = (uint32_t)iteration;
+}
+
+double genDblInRange(RandStream* rng, double min, double max){
+    double scalar = genrand_real1_r(&rng->mt); ///generate a random real number from the thread's own state, no locking required
     return min + ((max - min) * scalar);
 }
 
-int genNonNegInt(int max){
-#ifdef WIN32
-    return genRandInt32(max); ///WIN32 version of mutex locking and generating random number
-#else
-    return genRandIntP(max); ///Posix version of mutex locking and generating random number
-#endif
+int genNonNegInt(RandStream* rng, int max){
+    return (int)(genrand_int32_r(&rng->mt) % max); ///generate a random integer from the thread's own state, no locking required
+}
+
+void fillDblInRange(RandStream* rng, double* out, int count, double min, double max){
+    bulkRandDoubles(&rng->bulk, out, count, min, max); ///fill the array from the thread's bulk generator defined in src/BulkRandom.h
+}
+
+void fillNonNegInt(RandStream* rng, int* out, int count, int max){
+    bulkRandInts(&rng->bulk, out, count, max); ///fill the array from the thread's bulk generator defined in src/BulkRandom.h
+}
+
+void fillDblAt(RandStream* rng, int purpose, int particle, int partner, double* out, int count, double min, double max){
+    if(rng->mode == CounterGenerator){ ///compute the values from their address with the generator defined in src/CounterRandom.h
+        counterRandDoubles(&rng->key, rng->iteration, (uint32_t)particle, ((uint32_t)purpose << COUNTER_PURPOSE_SHIFT) ^ (uint32_t)partner, out, count, min, max);
+    }else{ ///otherwise draw the next values in order from the bulk generator
+        bulkRandDoubles(&rng->bulk, out, count, min, max);
+    }
+}
+
+void fillNonNegIntAt(RandStream* rng, int purpose, int particle, int partner, int* out, int count, int max){
+    if(rng->mode == CounterGenerator){ ///compute the values from their address with the generator defined in src/CounterRandom.h
+        counterRandInts(&rng->key, rng->iteration, (uint32_t)particle, ((uint32_t)purpose << COUNTER_PURPOSE_SHIFT) ^ (uint32_t)partner, out, count, max);
+    }else{ ///otherwise draw the next values in order from the bulk generator
+        bulkRandInts(&rng->bulk, out, count, max);
+    }
 }
\ No newline at end of file
@@ -12,31 +12,112 @@
 
 #include "Utilities.h"
 
-/// \fn double** createMatrix(struct EquationInfo info)
-/// \brief Using the Mersenne Twister algorithm to develop a set of unique randomized values.
+/// \fn void createMatrix(EquationInfo info, Matrix* matrix)
+/// \brief Using the Mersenne Twister algorithm to develop a set of unique randomized values. The matrix is filled in
+/// place so it can be the first rows of the row pool of a population defined in src/RowPool.h.
 ///
 /// \param info - EquationInfo struct
-/// \return A matrix (2D-Array) of randomized double values
-double** createMatrix(EquationInfo);
-/// \fn double** createVelocities(EquationInfo info)
+/// \param matrix - the numVectors x dimToTest matrix defined in src/Matrix.h to fill with randomized double values
+void createMatrix(EquationInfo info, Matrix* matrix);
+/// \fn Matrix createVelocities(EquationInfo info)
 /// \brief Using the Mersenne Twister algorithm to develop a set of unique randomized velocities.
 ///
 /// \param info  - EquationInfo struct
-/// \return A random matrix of initial velocities for use in src/PSO.c
-double** createVelocities(EquationInfo info);
-/// \fn double genDblInRange(double min, double max)
+/// \return A random matrix of initial velocities for use in src/PSO.c, allocated from the arena of the run
+Matrix createVelocities(EquationInfo info);
+/// \fn uint64_t deriveCellSeed(uint64_t seed, int equation, int dimIndex, int experiment)
+/// \brief Derives the seed of a single run (one cell of the equation, dimension and experiment grid) from the master seed
+/// of the program. The seed of a run only depends on its position, so any run can be reproduced on its own.
+///
+/// \param seed - the master seed for the whole program
+/// \param equation - the equation number of the run
+/// \param dimIndex - the position of the tested dimension in the list of dimensions to test
+/// \param experiment - the experiment number of the run
+/// \return the seed of the run
+uint64_t deriveCellSeed(uint64_t seed, int equation, int dimIndex, int experiment);
+/// \fn int derivePrintExperiment(uint64_t seed, int equation, int dimIndex, int numExperiments)
+/// \brief Picks the experiment whose populations are logged for an equation and dimension from the master seed of the program.
+///
+/// \param seed - the master seed for the whole program
+/// \param equation - the equation number
+/// \param dimIndex - the position of the tested dimension in the list of dimensions to test
+/// \param numExperiments - the number of experiments run
+/// \return the experiment number to log
+int derivePrintExperiment(uint64_t seed, int equation, int dimIndex, int numExperiments);
+/// \fn void seedRandStream(RandStream* rng, uint64_t cellSeed, int mode)
+/// \brief Seeds the generator owned by a single algorithm thread from the seed of its run, so every run draws from its own
+/// independent stream.
+///
+/// \param rng - the RandStream struct to be seeded
+/// \param cellSeed - the seed of the run from deriveCellSeed
+/// \param mode - the RandomMode enum value used by fillDblAt and fillNonNegIntAt
+void seedRandStream(RandStream* rng, uint64_t cellSeed, int mode);
+/// \fn void setRandIteration(RandStream* rng, int iteration)
+/// \brief Sets the iteration used in the address of the values drawn by fillDblAt and fillNonNegIntAt.
+///
+/// \param rng - the RandStream of the calling thread
+/// \param iteration - the iteration the algorithm is about to run
+void setRandIteration(RandStream* rng, int iteration);
+/// \fn double genDblInRange(RandStream* rng, double min, double max)
 /// \brief Using the Mersenne Twister algorithm to develop a scalar between 0 and 1, a unique randomized value between
 /// min and max is produced.
 ///
+/// \param rng - the RandStream of the calling thread
 /// \param min - double representing the minimum value in the range
 /// \param max - double representing the maximum value in the range
 /// \return A random double between min and max
-double genDblInRange(double, double);
-/// \fn int genNonNegInt(int max)
+double genDblInRange(RandStream*, double, double);
+/// \fn int genNonNegInt(RandStream* rng, int max)
 /// \brief Using the Mersenne Twister algorithm to develop a non-negative integer between 0 and max non-inclusive.
 ///
+/// \param rng - the RandStream of the calling thread
 /// \param max - int representing the maximum value in the range
 /// \return A random int between 0 and max
-int genNonNegInt(int);
+int genNonNegInt(RandStream*, int);
+/// \fn void fillDblInRange(RandStream* rng, double* out, int count, double min, double max)
+/// \brief Fills an array with random doubles between min and max using the bulk generator of the stream. This is much
+/// cheaper per value than calling genDblInRange for each value and should be used whenever a run of values is needed.
+///
+/// \param rng - the RandStream of the calling thread
+/// \param out - the array to be filled
+/// \param count - the number of values to be filled
+/// \param min - double representing the minimum value in the range
+/// \param max - double representing the maximum value in the range
+void fillDblInRange(RandStream* rng, double* out, int count, double min, double max);
+/// \fn void fillNonNegInt(RandStream* rng, int* out, int count, int max)
+/// \brief Fills an array with random non-negative integers between 0 and max non-inclusive using the bulk generator of the stream.
+///
+/// \param rng - the RandStream of the calling thread
+/// \param out - the array to be filled
+/// \param count - the number of values to be filled
+/// \param max - int representing the maximum value in the range
+void fillNonNegInt(RandStream* rng, int* out, int count, int max);
+/// \fn void fillDblAt(RandStream* rng, int purpose, int particle, int partner, double* out, int count, double min, double max)
+/// \brief Fills an array with random doubles between min and max for the given particle. In the StreamGenerator mode the values
+/// are drawn in order from the bulk generator and the address is ignored. In the CounterGenerator mode the values are
+/// computed from the current iteration, the purpose, the particle and the partner, so they are the same whatever order
+/// or thread the particles are processed in.
+///
+/// \param rng - the RandStream of the calling thread
+/// \param purpose - the RandPurpose enum value for what the values are drawn for
+/// \param particle - the position of the particle the values are drawn for
+/// \param partner - the position of a second particle involved in the draw, or 0
+/// \param out - the array to be filled
+/// \param count - the number of values to be filled
+/// \param min - double representing the minimum value in the range
+/// \param max - double representing the maximum value in the range
+void fillDblAt(RandStream* rng, int purpose, int particle, int partner, double* out, int count, double min, double max);
+/// \fn void fillNonNegIntAt(RandStream* rng, int purpose, int particle, int partner, int* out, int count, int max)
+/// \brief Fills an array with random non-negative integers between 0 and max non-inclusive for the given particle, addressed the
+/// same way as fillDblAt.
+///
+/// \param rng - the RandStream of the calling thread
+/// \param purpose - the RandPurpose enum value for what the values are drawn for
+/// \param particle - the position of the particle the values are drawn for
+/// \param partner - the position of a second particle involved in the draw, or 0
+/// \param out - the array to be filled
+/// \param count - the number of values to be filled
+/// \param max - int representing the maximum value in the range
+void fillNonNegIntAt(RandStream* rng, int purpose, int particle, int partner, int* out, int count, int max);
 
 #endif //TESTINGSUITE_MERSENNEMATRIX_H
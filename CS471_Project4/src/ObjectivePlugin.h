@@ -0,0 +1,64 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file ObjectivePlugin.h
+ * \brief This is the interface a shared library implements to add its own objective function to the suite.
+ *
+ *  This header is the only one a plugin needs. The library exports a single ObjectivePlugin named objectivePlugin,
+ *  which is read when the plugin is named in the optional 'Objective Plugins' line of the init file, and the function
+ *  then runs in every algorithm the same way as the functions in src/Equations.h. A plugin is built as a shared
+ *  library, e.g. gcc -O2 -shared -fPIC myObjective.c -o myObjective.so, with -DSINGLE_PRECISION when the suite is.
+ *
+ *  Every function is called from many threads at once, so a plugin must not change any state shared between calls.
+ */
+#ifndef TESTINGSUITE_OBJECTIVEPLUGIN_H
+#define TESTINGSUITE_OBJECTIVEPLUGIN_H
+
+#define OBJECTIVE_PLUGIN_ABI 1 /*!< declare the constant for the version of this interface, which the suite checks on load*/
+#define OBJECTIVE_PLUGIN_SYMBOL "objectivePlugin" /*!< declare the constant for the name the ObjectivePlugin is exported as*/
+
+#ifdef SINGLE_PRECISION
+typedef float PluginReal; /*!< The type the vectors are stored as, which is the Real of src/Matrix.h*/
+#else
+typedef double PluginReal; /*!< The type the vectors are stored as, which is the Real of src/Matrix.h*/
+#endif
+
+#ifdef WIN32
+#define OBJECTIVE_PLUGIN_EXPORT __declspec(dllexport) /*!< declare the attribute exporting objectivePlugin from a DLL*/
+#else
+#define OBJECTIVE_PLUGIN_EXPORT __attribute__((visibility("default"))) /*!< declare the attribute exporting objectivePlugin*/
+#endif
+
+/*!
+ * The description of an objective function exported by a plugin. Only evaluateBatch is required, the other functions
+ * may be NULL.
+ */
+typedef struct _ObjectivePlugin{
+    int abiVersion; /*!< Must be OBJECTIVE_PLUGIN_ABI*/
+    int realBytes; /*!< Must be sizeof(PluginReal), so a double plugin is never loaded into a float suite*/
+    double lower; /*!< The lowest value of every coordinate*/
+    double upper; /*!< The highest value of every coordinate*/
+    int minDimensions; /*!< The fewest dimensions the function is defined for*/
+    int maxDimensions; /*!< The most dimensions the function is defined for, 0 for no limit*/
+    /*!
+     * Stores the fitness of count vectors of numDim values, vector v starting at vectors[v]. Called with whole
+     * populations where the algorithm evaluates them together and with count 1 otherwise.
+     */
+    void (*evaluateBatch)(const PluginReal* const* vectors, int count, int numDim, double* fitness);
+    /*!
+     * Returns the fitness of a single vector, used instead of evaluateBatch with count 1 when it is given.
+     */
+    double (*evaluate)(const PluginReal* vector, int numDim);
+    /*!
+     * Returns the fitness of a vector after a move changed count of its coordinates, given the fitness before the move,
+     * the coordinates in increasing order and the values they had before it. Used for moves changing few coordinates.
+     */
+    double (*delta)(const PluginReal* vector, int numDim, const int* dims, const PluginReal* previous, int count, double baseFit);
+    /*!
+     * Stores the gradient of the function at a vector into gradient, one value per dimension.
+     */
+    void (*gradient)(const PluginReal* vector, int numDim, double* gradient);
+}ObjectivePlugin;
+
+#endif //TESTINGSUITE_OBJECTIVEPLUGIN_H
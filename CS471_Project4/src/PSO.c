@@ -14,78 +14,342 @@
 
 void* particleSwarmAlg(void* data){
     EquationInfo info = *(EquationInfo*)data;
+    pinThread(info.cpu); ///pin before the arena is touched so its pages are placed on the node of this CPU
     int iterations = info.iterations,
     numVec = info.numVectors,
     numDim = info.dimToTest;
     struct timespec start, /*!< Declare the timespec struct storing the start time of the iterations*/
             end; /*!< Declare the timespec struct storing the end time of the iterations*/
     double totTMillSec; /*!< Declare the double storing the total runtime of all iterations in milliseconds*/
-    Particle* particles = calloc(1, sizeof(Particle));
+    RandStream* rng = arenaAlloc(info.arena, 1, sizeof(RandStream)); /*!< Allocate the random number generator owned by this thread*/
+    seedRandStream(rng, info.cellSeed, info.randomMode);
+    info.rng = rng;
+    writeSeedManifest("PSO", info); ///record the seed of this run so it can be replayed on its own
+    Particle* particles = arenaAlloc(info.arena, 1, sizeof(Particle));
     createParticles(particles, numVec, numDim, info);
-    evaluatePop(particles->population, particles->fitness, numVec, numDim, info.equationNum, &particles->bestPos, &particles->worstPos, &particles->gBestFit, &particles->gWorstFit);
+    Memetic* memetic = createMemetic(info); /*!< The refinement of the global best, NULL when it is off*/
+    Matrix initial = poolMatrix(&particles->swarm, numVec); /*!< The rows of the position slots, which are in order until the first iteration*/
+    evaluatePop(&initial, particles->fitness, &info.objective, &particles->bestPos, &particles->worstPos, &particles->gBestFit, &particles->gWorstFit);
     copyArray(particles->fitness, particles->pBestFit, numVec);
+    Matrix logMatrix; /*!< The population transposed back to one row per particle for the population log*/
+    if(particles->dimMajor){
+        transposeParticles(particles, info.arena, numVec, numDim); ///switch to one row per dimension now the initial population is evaluated
+        logMatrix = arenaMatrix(info.arena, numVec, numDim);
+    }
+    long heapCalls = heapAllocationCount(); /*!< The heap allocations made by this thread before the iterations*/
     for(int i =0; i < iterations; i++){
         clock_gettime(CLOCK_MONOTONIC, &start); /*!< Set the start time using a monotonic clock, meaning it will ignore if the system clock changes*/
-        particleLoop(particles, numVec, numDim, info.c1, info.c2, info.k, info.range, info.equationNum); ///run the particle swarm loop for this iteration
+        setRandIteration(rng, i); ///random values drawn in this iteration are addressed by it
+        if(particles->dimMajor)
+            particleLoopDimMajor(particles, numVec, numDim, info.c1, info.c2, info.k, info.range, &info.objective); ///run the particle swarm loop across the particles for this iteration
+        else
+            particleLoop(particles, numVec, numDim, info.c1, info.c2, info.k, info.range, &info.objective); ///run the particle swarm loop for this iteration
+        if(refinementDue(memetic, i))
+            refineParticles(particles, memetic, numVec, numDim); ///polish the global best with a few quasi-Newton steps
         clock_gettime(CLOCK_MONOTONIC, &end);/*!< Store the end time*/
         totTMillSec = (double)((end.tv_sec - start.tv_sec) * MS_PER_SEC) +  ((end.tv_nsec - start.tv_nsec) / (double) NS_PER_MS); /*!< Calculate the total runtime by subtracting end time's seconds from the start time's seconds and converting to milliseconds and adding the end time's nanoseconds minus the start time's nanoseconds and converting to milliseconds*/
         ///write the best and worst to a file
         writeResultToFile(particles->gBestFit, particles->gWorstFit, "PSO", i, totTMillSec, info);
         if(info.currExperiment == info.printExperiment) {
             ///write the new population to a log file
-            writePopulationLogToFile(particles->population, "PSO", i, info);
+            if(particles->dimMajor){
+                transposeMatrix(&particles->population, &logMatrix);
+                writePopulationLogToFile(&logMatrix, NULL, "PSO", i, info);
+            }else{
+                writePopulationLogToFile(&particles->swarm.rows, particles->swarm.slots, "PSO", i, info); ///the position slots are the first numVec slots
+            }
         }
     }
-    ///free PSO
-    freeParticles(particles, info.numVectors);
+    recordHeapAllocations(heapAllocationCount() - heapCalls); ///every buffer should have come from the arena before the first iteration
+    recordRefinements(memetic);
+    ///every buffer of PSO is released when the arena is reset for the next experiment
+}
+
+static int personalBestSlot(const Particle* particles, int vecPos){
+    return particles->swarm.numSlots / 2 + vecPos; ///the personal best slots follow the position slots
 }
 
-double calcPBestModifier(Particle* particles, double c1, int vecPos, int dimPos){
-    return c1 * genDblInRange(0, 1) * (particles->personalBest[vecPos][dimPos] - particles->population[vecPos][dimPos]);
+double calcPBestModifier(Particle* particles, double c1, double rand, int vecPos, int dimPos){
+    return c1 * rand * (poolRow(&particles->swarm, personalBestSlot(particles, vecPos))[dimPos] - poolRow(&particles->swarm, vecPos)[dimPos]);
 }
 
-double calcGBestModifier(Particle* particles, double c2, int vecPos, int dimPos){
-    return c2 * genDblInRange(0, 1) * (particles->personalBest[particles->bestPos][dimPos] -  particles->population[vecPos][dimPos]);
+double calcGBestModifier(Particle* particles, double c2, double rand, int vecPos, int dimPos){
+    return c2 * rand * (poolRow(&particles->swarm, personalBestSlot(particles, particles->bestPos))[dimPos] -  poolRow(&particles->swarm, vecPos)[dimPos]);
 }
 
 void calcNewVelocity(Particle* particles, int dimensions, int position, double c1, double c2, double k){
+    double* pRand = particles->randBuf, /*!< The random scalars for the personal best terms*/
+    *gRand = particles->randBuf + dimensions; /*!< The random scalars for the global best terms*/
+    Real* velocity = matrixRow(&particles->velocities, position); /*!< The velocity row of this particle*/
+    fillDblAt(particles->rng, RandVelocityUpdate, position, 0, particles->randBuf, 2 * dimensions, 0, 1); ///generate the random scalars for every dimension of this particle at once
     for(int i = 0; i < dimensions; i++){
-        particles->velocities[position][i] = k * (particles->velocities[position][i] + calcPBestModifier(particles, c1, position, i) + calcGBestModifier(particles, c2, position, i));
+        velocity[i] = k * (velocity[i] + calcPBestModifier(particles, c1, pRand[i], position, i) + calcGBestModifier(particles, c2, gRand[i], position, i));
     }
 }
 
 void calcNewVector(Particle* particles, int dimensions, int position, const double* range){
     double temp = 0;
+    const Real* particle = poolRow(&particles->swarm, position); /*!< The position row of this particle*/
+    int shared = slotShared(&particles->swarm, position); /*!< Whether the row is also the personal best of this particle*/
+    Real* newParticle = shared ? poolScratch(&particles->swarm) : poolRow(&particles->swarm, position); /*!< A row shared with the personal best is left as it is and the new position is built in the scratch row*/
+    const Real* velocity = matrixRow(&particles->velocities, position); /*!< The velocity row of this particle*/
+    MoveLog* log = particles->moves ? &particles->moves[position] : NULL; /*!< The log of the coordinates the move changes, if it is kept*/
+    if(log)
+        resetMoveLog(log);
     for(int i = 0; i < dimensions; i++){
-        temp = particles->population[position][i] + particles->velocities[position][i];
+        Real previous = particle[i]; /*!< The coordinate before the move, read first as the row may be written in place*/
+        temp = particle[i] + velocity[i];
         if(temp < range[RANGE_MIN_POS]){
             temp = range[RANGE_MIN_POS];
-            particles->population[position][i] = temp;
+            newParticle[i] = temp;
         }
         else if(temp > range[RANGE_MAX_POS]){
             temp = range[RANGE_MAX_POS];
-            particles->population[position][i] = temp;
+            newParticle[i] = temp;
         }
         else{
-            particles->population[position][i] = temp;
+            newParticle[i] = temp;
         }
+        if(log && newParticle[i] != previous)
+            logMove(log, i, previous);
     }
+    if(shared)
+        acceptScratch(&particles->swarm, position);
 }
 
-void particleLoop(Particle* particles, int numParticles, int dimensions, double c1, double c2, double k, double* range, int equation){
-    double newFitness = 0;
+void evaluateMoves(Particle* particles, int numParticles, const Objective* objective){
+    int dense = 0; /*!< The number of particles evaluated in full*/
+    /*!
+     * Evaluate the particles whose move was sparse from the fitness they had before it, and gather the rows of the rest.
+     */
+    for(int i = 0; i < numParticles; i++){
+        if(moveIsSparse(&particles->moves[i], particles->moveAge[i])){
+            particles->fitness[i] = evaluateMove(poolRow(&particles->swarm, i), objective, &particles->moves[i],
+                                                 particles->fitness[i], particles->moveAge[i], &particles->moveAge[i]);
+        }else{
+            particles->denseRows[dense] = particles->swarm.slots[i];
+            particles->densePos[dense++] = i;
+        }
+    }
+    if(dense == 0)
+        return;
+    evaluateBatch(&particles->swarm.rows, particles->denseRows, dense, objective, particles->denseFit);
+    for(int i = 0; i < dense; i++){
+        particles->fitness[particles->densePos[i]] = particles->denseFit[i];
+        particles->moveAge[particles->densePos[i]] = 0;
+    }
+}
+/*!
+ * Evaluates a single moved particle of a row major swarm, by its delta when its move was sparse.
+ */
+static double evaluateParticle(Particle* particles, int position, const Objective* objective){
+    const Real* particle = poolRow(&particles->swarm, position); /*!< The position row of this particle*/
+    if(!particles->moves)
+        return objective->function(particle, objective->dimensions);
+    if(moveIsSparse(&particles->moves[position], particles->moveAge[position]))
+        return evaluateMove(particle, objective, &particles->moves[position], particles->fitness[position],
+                            particles->moveAge[position], &particles->moveAge[position]);
+    particles->moveAge[position] = 0;
+    return objective->function(particle, objective->dimensions);
+}
+
+/*!
+ * Updates the personal best of a row major particle if it improved, then the global best.
+ */
+static void updateBests(Particle* particles, int numParticles, int position){
+    if(particles->fitness[position] < particles->pBestFit[position]){
+        particles->pBestFit[position] = particles->fitness[position];
+        shareSlot(&particles->swarm, numParticles + position, position); ///the personal best takes the row of the particle instead of a copy
+    }
+    if(particles->fitness[position] < particles->gBestFit){
+        particles->gBestFit = particles->fitness[position];
+        particles->bestPos = position;
+    }
+}
+
+void particleLoop(Particle* particles, int numParticles, int dimensions, double c1, double c2, double k, double* range, const Objective* objective){
+    /*!
+     * With the sequential update move and evaluate every particle in turn, so the particles after it move towards the
+     * global best it may have just become.
+     */
+    if(particles->sequential){
+        for(int i = 0; i < numParticles; i++){
+            calcNewVelocity(particles, dimensions, i, c1, c2, k);
+            calcNewVector(particles, dimensions, i, range);
+            particles->fitness[i] = evaluateParticle(particles, i, objective);
+            updateBests(particles, numParticles, i);
+        }
+        return;
+    }
+    /*!
+     * Otherwise move every particle towards the global best from the start of the iteration, which the personal best
+     * rows keep unchanged until the whole swarm has moved.
+     */
     for(int i = 0; i < numParticles; i++){
         calcNewVelocity(particles, dimensions, i, c1, c2, k);
         calcNewVector(particles, dimensions, i, range);
-        newFitness = evaluateFitness(particles->population[i], dimensions, equation);
-        particles->fitness[i] = newFitness;
-        if(newFitness < particles->pBestFit[i]){
-            particles->pBestFit[i] = newFitness;
-            copyArray(particles->population[i], particles->personalBest[i], dimensions);
+    }
+    if(particles->moves)
+        evaluateMoves(particles, numParticles, objective);
+    else
+        evaluateBatch(&particles->swarm.rows, particles->swarm.slots, numParticles, objective, particles->fitness); ///the position slots are the first numParticles slots
+    /*!
+     * Update the personal bests of the particles which improved, then the global best for the next iteration.
+     */
+    for(int i = 0; i < numParticles; i++)
+        updateBests(particles, numParticles, i);
+}
+
+void transposeParticles(Particle* particles, Arena* arena, int numParticles, int dimensions){
+    Matrix transposed = arenaMatrix(arena, dimensions, numParticles); /*!< The velocities with one row per dimension*/
+    transposeMatrix(&particles->velocities, &transposed);
+    particles->velocities = transposed; ///the row major matrix stays in the arena until it is reset
+    particles->population = arenaMatrix(arena, dimensions, numParticles);
+    particles->personalBest = arenaMatrix(arena, dimensions, numParticles);
+    /*!
+     * Gather the position and personal best of every particle from the row pool into its column of the new matrices.
+     */
+    for(int i = 0; i < numParticles; i++){
+        const Real* position = poolRow(&particles->swarm, i), /*!< The position row of this particle*/
+        *best = poolRow(&particles->swarm, numParticles + i); /*!< The personal best row of this particle*/
+        for(int j = 0; j < dimensions; j++){
+            matrixRow(&particles->population, j)[i] = position[j];
+            matrixRow(&particles->personalBest, j)[i] = best[j];
         }
-        if(newFitness < particles->gBestFit){
-            particles->gBestFit = newFitness;
+    }
+}
+
+void particleSequenceDimMajor(Particle* particles, int numParticles, int dimensions, double c1, double c2, double k, const double* range, const Objective* objective){
+    Matrix* population = &particles->population, /*!< The positions, one row per dimension*/
+    *velocities = &particles->velocities, /*!< The velocities, one row per dimension*/
+    *personalBest = &particles->personalBest; /*!< The personal bests, one row per dimension*/
+    const double* pRand = particles->randBuf, /*!< The random scalars for the personal best terms*/
+    *gRand = particles->randBuf + dimensions; /*!< The random scalars for the global best terms*/
+    double minVal = range[RANGE_MIN_POS], /*!< Store the range minimum locally*/
+    maxVal = range[RANGE_MAX_POS]; /*!< Store the range maximum locally*/
+    /*!
+     * Move every particle down its column towards the personal best of the current global best, gathering it into the
+     * scratch row as it goes, then evaluate it and update the bests before the next particle moves.
+     */
+    for(int i = 0; i < numParticles; i++){
+        fillDblAt(particles->rng, RandVelocityUpdate, i, 0, particles->randBuf, 2 * dimensions, 0, 1);
+        for(int j = 0; j < dimensions; j++){
+            Real* position = matrixRow(population, j), /*!< This dimension of every particle*/
+            *velocity = matrixRow(velocities, j); /*!< This dimension of every velocity*/
+            const Real* pBest = matrixRow(personalBest, j); /*!< This dimension of every personal best*/
+            velocity[i] = k * (velocity[i] + c1 * pRand[j] * (pBest[i] - position[i]) + c2 * gRand[j] * (pBest[particles->bestPos] - position[i]));
+            double newPosition = position[i] + velocity[i];
+            newPosition = newPosition < minVal ? minVal : newPosition;
+            newPosition = newPosition > maxVal ? maxVal : newPosition;
+            position[i] = newPosition;
+            particles->scratch[j] = position[i];
+        }
+        particles->fitness[i] = objective->function(particles->scratch, dimensions);
+        if(particles->fitness[i] < particles->pBestFit[i]){
+            particles->pBestFit[i] = particles->fitness[i];
+            for(int j = 0; j < dimensions; j++)
+                matrixRow(personalBest, j)[i] = particles->scratch[j];
+        }
+        if(particles->fitness[i] < particles->gBestFit){
+            particles->gBestFit = particles->fitness[i];
+            particles->bestPos = i;
+        }
+    }
+}
+
+void particleLoopDimMajor(Particle* particles, int numParticles, int dimensions, double c1, double c2, double k, const double* range, const Objective* objective){
+    Matrix* population = &particles->population, /*!< The positions, one row per dimension*/
+    *velocities = &particles->velocities, /*!< The velocities, one row per dimension*/
+    *personalBest = &particles->personalBest, /*!< The personal bests, one row per dimension*/
+    *randoms = &particles->randoms; /*!< The random scalars, one row per term and dimension*/
+    double minVal = range[RANGE_MIN_POS], /*!< Store the range minimum locally*/
+    maxVal = range[RANGE_MAX_POS]; /*!< Store the range maximum locally*/
+    if(particles->sequential){
+        particleSequenceDimMajor(particles, numParticles, dimensions, c1, c2, k, range, objective);
+        return;
+    }
+    /*!
+     * Draw the random scalars of every particle with the same addresses as the row major loop, then spread them over
+     * the rows of the random matrix so each dimension's scalars are contiguous.
+     */
+    for(int i = 0; i < numParticles; i++){
+        fillDblAt(particles->rng, RandVelocityUpdate, i, 0, particles->randBuf, 2 * dimensions, 0, 1);
+        for(int j = 0; j < 2 * dimensions; j++)
+            matrixRow(randoms, j)[i] = particles->randBuf[j];
+    }
+    /*!
+     * Every particle moves towards the global best from the start of the iteration, so it is copied out once.
+     */
+    for(int j = 0; j < dimensions; j++)
+        particles->gBestRow[j] = matrixRow(personalBest, j)[particles->bestPos];
+    /*!
+     * Update the velocity and position of every particle one dimension at a time. The inner loop runs over contiguous
+     * particles with no dependencies between them, so it vectorizes across the particles.
+     */
+    for(int j = 0; j < dimensions; j++){
+        Real* position = matrixRow(population, j), /*!< This dimension of every particle*/
+        *velocity = matrixRow(velocities, j); /*!< This dimension of every velocity*/
+        const Real* pBest = matrixRow(personalBest, j), /*!< This dimension of every personal best*/
+        *pRand = matrixRow(randoms, j), /*!< The personal best scalars of this dimension*/
+        *gRand = matrixRow(randoms, dimensions + j); /*!< The global best scalars of this dimension*/
+        double gBest = particles->gBestRow[j]; /*!< This dimension of the global best*/
+        for(int i = 0; i < numParticles; i++){
+            double newVelocity = k * (velocity[i] + c1 * pRand[i] * (pBest[i] - position[i]) + c2 * gRand[i] * (gBest - position[i]));
+            double newPosition = position[i] + newVelocity;
+            newPosition = newPosition < minVal ? minVal : newPosition;
+            newPosition = newPosition > maxVal ? maxVal : newPosition;
+            velocity[i] = newVelocity;
+            position[i] = newPosition;
+        }
+    }
+    /*!
+     * Evaluate every particle straight from the columns, marking the particles which improved their personal best.
+     */
+    evaluateColumns(population, objective, particles->fitness, particles->scratch);
+    for(int i = 0; i < numParticles; i++){
+        particles->improved[i] = particles->fitness[i] < particles->pBestFit[i];
+        if(particles->improved[i])
+            particles->pBestFit[i] = particles->fitness[i];
+    }
+    /*!
+     * Copy the improved particles into their personal bests one dimension at a time.
+     */
+    for(int j = 0; j < dimensions; j++){
+        const Real* position = matrixRow(population, j);
+        Real* pBest = matrixRow(personalBest, j);
+        for(int i = 0; i < numParticles; i++)
+            pBest[i] = particles->improved[i] ? position[i] : pBest[i];
+    }
+    /*!
+     * Finally update the global best for the next iteration.
+     */
+    for(int i = 0; i < numParticles; i++){
+        if(particles->fitness[i] < particles->gBestFit){
+            particles->gBestFit = particles->fitness[i];
             particles->bestPos = i;
         }
     }
-}
\ No newline at end of file
+}
+
+void refineParticles(Particle* particles, Memetic* memetic, int numParticles, int dimensions){
+    int best = particles->bestPos; /*!< The particle whose personal best is the global best*/
+    double refined; /*!< The fitness of the personal best afterwards*/
+    /*!
+     * A dimension major swarm gathers the personal best from its column and scatters it back once refined, while a row
+     * major swarm refines the row of its personal best slot.
+     */
+    if(particles->dimMajor){
+        for(int j = 0; j < dimensions; j++)
+            particles->scratch[j] = matrixRow(&particles->personalBest, j)[best];
+        refined = refineVector(memetic, particles->scratch, particles->pBestFit[best], particles->scratch);
+        if(refined < particles->pBestFit[best]){
+            for(int j = 0; j < dimensions; j++)
+                matrixRow(&particles->personalBest, j)[best] = particles->scratch[j];
+        }
+    }else{
+        refined = refineSlot(memetic, &particles->swarm, numParticles + best, particles->pBestFit[best]);
+    }
+    particles->pBestFit[best] = refined;
+    if(refined < particles->gBestFit)
+        particles->gBestFit = refined;
+}
@@ -16,6 +16,7 @@
 #define CS471_PROJECT4_PSO_H
 
 #include "Utilities.h"
+#include "Memetic.h"
 
 /// \fn void* particleSwarmAlg(void* data)
 /// \brief Responsible for initializing the algorithm and all data related to the algorithm and calling related functions to start and record results fo the algorithm
@@ -23,8 +24,12 @@
 /// \param data - void pointer to be converted to an EquationInfo struct
 /// \return Nothing as it is a threaded function
 void* particleSwarmAlg(void* data);
-/// \fn void particleLoop(Particle* particles, int numParticles, int dimensions, double c1, double c2, double k, double* range, int equation)
-/// \brief executes the loop which iterates through the population, calculates new velocities for each dimension, creates the new particle and evaluates it
+/// \fn void particleLoop(Particle* particles, int numParticles, int dimensions, double c1, double c2, double k, double* range, const Objective* objective)
+/// \brief executes the loop which iterates through the population, calculates new velocities for each dimension and creates
+/// the new particle. With the sequential update every particle is evaluated as soon as it moves and the bests are updated
+/// before the next particle moves. With the synchronous update every particle moves towards the global best from the start
+/// of the iteration, so the whole swarm is evaluated in a single batch before the personal and global bests are updated,
+/// with evaluateMoves when the moves are logged.
 ///
 /// \param particles - The struct to be processed
 /// \param numParticles - The number of particles in the population
@@ -33,28 +38,76 @@ void* particleSwarmAlg(void* data);
 /// \param c2 - the globalBest modification factor
 /// \param k - the velocity dampening factor
 /// \param range - the range of accepted values
-/// \param equation - the equation number for the objective function call
-void particleLoop(Particle* particles, int numParticles, int dimensions, double c1, double c2, double k, double* range, int equation);
-/// \fn double calcPBestModifier(Particle* particles, double c1, int vecPos, int dimPos)
+/// \param objective - the functions of the run, resolved once by resolveObjective
+void particleLoop(Particle* particles, int numParticles, int dimensions, double c1, double c2, double k, double* range, const Objective* objective);
+/// \fn void evaluateMoves(Particle* particles, int numParticles, const Objective* objective)
+/// \brief evaluates the moved swarm from the move logs of the particles. Particles whose move changed few coordinates are
+/// evaluated by their delta, and the rest are gathered into a single batch.
+///
+/// \param particles - The struct to be processed, with its move logs allocated
+/// \param numParticles - The number of particles in the population
+/// \param objective - the functions of the run, resolved once by resolveObjective
+void evaluateMoves(Particle* particles, int numParticles, const Objective* objective);
+/// \fn void transposeParticles(Particle* particles, Arena* arena, int numParticles, int dimensions)
+/// \brief Switches the population, velocities and personal bests of the struct from one row per particle in the swarm row
+/// pool to matrices with one row per dimension
+///
+/// \param particles - The struct to be processed
+/// \param arena - The arena of the run the transposed matrices are allocated from
+/// \param numParticles - The number of particles in the population
+/// \param dimensions - the number of dimensions per particle
+void transposeParticles(Particle* particles, Arena* arena, int numParticles, int dimensions);
+/// \fn void particleLoopDimMajor(Particle* particles, int numParticles, int dimensions, double c1, double c2, double k, const double* range, const Objective* objective)
+/// \brief executes the particle swarm loop on dimension major matrices. With the synchronous update every particle moves
+/// towards the global best from the start of the iteration, so the velocity and position updates vectorize across the
+/// particles, and the global best is updated once the whole swarm has moved. With the sequential update it runs
+/// particleSequenceDimMajor instead.
+///
+/// \param particles - The struct to be processed, stored dimension major
+/// \param numParticles - The number of particles in the population
+/// \param dimensions - the number of dimensions per particle
+/// \param c1 - the personalBest modification factor
+/// \param c2 - the globalBest modification factor
+/// \param k - the velocity dampening factor
+/// \param range - the range of accepted values
+/// \param objective - the functions of the run, resolved once by resolveObjective
+void particleLoopDimMajor(Particle* particles, int numParticles, int dimensions, double c1, double c2, double k, const double* range, const Objective* objective);
+/// \fn void particleSequenceDimMajor(Particle* particles, int numParticles, int dimensions, double c1, double c2, double k, const double* range, const Objective* objective)
+/// \brief executes the sequential particle swarm loop on dimension major matrices, moving and evaluating one particle at a
+/// time down its column so the results are the same as the row major loop.
+///
+/// \param particles - The struct to be processed, stored dimension major
+/// \param numParticles - The number of particles in the population
+/// \param dimensions - the number of dimensions per particle
+/// \param c1 - the personalBest modification factor
+/// \param c2 - the globalBest modification factor
+/// \param k - the velocity dampening factor
+/// \param range - the range of accepted values
+/// \param objective - the functions of the run, resolved once by resolveObjective
+void particleSequenceDimMajor(Particle* particles, int numParticles, int dimensions, double c1, double c2, double k, const double* range, const Objective* objective);
+/// \fn double calcPBestModifier(Particle* particles, double c1, double rand, int vecPos, int dimPos)
 /// \brief calculates the personal best term when determining a new velocity
 ///
 /// \param particles - the struct being processed
 /// \param c1  - the personalBest modification factor
+/// \param rand - the pre-generated random scalar in [0, 1) for this term
 /// \param vecPos - the position of the particle in the population
 /// \param dimPos - the position of the dimension whose new velocity is being calculated
 /// \return returns a double value representing the velocity towards the personal best dimension
-double calcPBestModifier(Particle* particles, double c1, int vecPos, int dimPos);
-/// \fn double calcGBestModifier(Particle* particles, double c2, int vecPos, int dimPos)
+double calcPBestModifier(Particle* particles, double c1, double rand, int vecPos, int dimPos);
+/// \fn double calcGBestModifier(Particle* particles, double c2, double rand, int vecPos, int dimPos)
 /// \brief calculates the global best term when determining the new velocity
 ///
 /// \param particles - the struct being processed
 /// \param c2  - the globalBest modification factor
+/// \param rand - the pre-generated random scalar in [0, 1) for this term
 /// \param vecPos - the position of the particle in the population
 /// \param dimPos - the position of the dimension whose new velocity is being calculated
 /// \return returns a double value representing the velocity towards the global best dimension
-double calcGBestModifier(Particle* particles, double c2, int vecPos, int dimPos);
+double calcGBestModifier(Particle* particles, double c2, double rand, int vecPos, int dimPos);
 /// \fn void calcNewVelocity(Particle* particles, int dimensions, int position, double c1, double c2, double k)
 /// \brief Calculates the velocity of the current dimension utilizing the old velocity and a term derived from the personal best particle and a term derived from the global best particle.
+/// The random scalars for every dimension of the particle are generated up front in a single bulk call.
 ///
 /// \param particles - the struct being processed
 /// \param dimensions - the number of dimensions per particle in the population
@@ -64,13 +117,23 @@ double calcGBestModifier(Particle* particles, double c2, int vecPos, int dimPos)
 /// \param k - the velocity dampening factor
 void calcNewVelocity(Particle* particles, int dimensions, int position, double c1, double c2, double k);
 /// \fn void calcNewVector(Particle* particles, int dimensions, int position, const double* range)
-/// \brief calculates a new vector using the current dimensional value and the velocity calculated in a prior step.
+/// \brief calculates a new vector using the current dimensional value and the velocity calculated in a prior step,
+/// logging the coordinates it changed when the particles keep move logs.
 ///
 /// \param particles - the struct being processed
 /// \param dimensions - the number of dimensions per particle in the population
 /// \param position - the current particle position
 /// \param range - the range of acceptable values for the search space
 void calcNewVector(Particle* particles, int dimensions, int position, const double* range);
+/// \fn void refineParticles(Particle* particles, Memetic* memetic, int numParticles, int dimensions)
+/// \brief Refines the personal best of the global best particle with src/Memetic.h, updating its personal best and
+/// the global best fitness when the refined vector is better. The particle itself keeps its position.
+///
+/// \param particles - the struct being processed
+/// \param memetic - the refinement of the run
+/// \param numParticles - The number of particles in the population
+/// \param dimensions - the number of dimensions per particle
+void refineParticles(Particle* particles, Memetic* memetic, int numParticles, int dimensions);
 
 
 #endif //CS471_PROJECT4_PSO_H
@@ -14,6 +14,11 @@
 #include "../src/Harmonic.h"
 #include "../src/PSO.h"
 #include "../src/EquationHandlers.h"
+#include "../src/MersenneMatrix.h"
+#include "../src/MemoryPlan.h"
+#include "../src/Plugins.h"
+#include "../src/Formulas.h"
+#include "../src/Variants.h"
 #include <pthread.h>
 
 
@@ -41,6 +46,7 @@ int runEquationsAsThreads(int equationPos, char* eqName, Info* data){
         temp.equationNum = equationPos; /*!< Set the equationNum to one greater than the position in a 0 based array*/
         temp.numVectors = data->numVectors; /*!< Set the number of vectors for the test*/
         temp.dimToTest = data->dimsToTest[i]; /*!< Set the specific dimensions for this test*/
+        temp.dimIndex = i; /*!< Set the position of these dimensions in the list of dimensions to test*/
         temp.iterations = data->iterations; /*!< Set the number of iterations for this test*/
         temp.bandwidth = data->bandwidth; /*!< Set the bandwidth for the harmonic test*/
         temp.PAR = data->PAR; /*!< Set the pitch adjustment rate for the harmonic test*/
@@ -51,9 +57,23 @@ int runEquationsAsThreads(int equationPos, char* eqName, Info* data){
         temp.c1  = data->c1;/*!< Set the personalBest term modifier c1 for PSO test*/
         temp.c2  = data->c2;/*!< Set the globalBest term modifier c2 for PSO test*/
         temp.k  = data->k;/*!< Set the dampening factor for PSO test*/
+        temp.seed = data->seed;/*!< Set the master seed every run of the test derives its own seed from*/
+        temp.randomMode = data->randomMode;/*!< Set how the random values of the test are generated*/
+        temp.initializer = data->initializer;/*!< Set how the initial population and velocities of the test are filled*/
+        temp.layout = data->layout;/*!< Set how the particle swarm matrices of the test are stored*/
+        temp.updateOrder = data->updateOrder;/*!< Set when the particles and attracted fireflies of the test are evaluated*/
+        temp.delta = data->delta;/*!< Set whether sparse moves of the test are evaluated by their delta*/
+        temp.bounded = data->bounded;/*!< Set whether candidates of the test are cut short against the worst fitness*/
+        temp.fitnessCache = data->fitnessCache;/*!< Set the number of vectors the fitness cache of every run holds*/
+        temp.memetic = data->memetic;/*!< Set the number of iterations between the refinements of the best vector of every run*/
+        temp.replay = data->replay;/*!< Set whether this is a replay of a single run so its output is kept apart*/
+        temp.objective = resolveObjective(equationPos, temp.dimToTest);/*!< Look up the functions of the run once so no evaluation has to look them up*/
+        temp.rng = NULL;/*!< The random stream is owned and created by the test thread itself*/
+        temp.arena = NULL;/*!< The arena is only created for the dimensions which will be run*/
+        temp.cpu = data->pinThreads ? (equationPos * numDim + i) % cpuCount() : -1;/*!< Give every dimension its own CPU so its arena stays on one node*/
         temp.range = calloc(RANGE_SIZE, sizeof(double)); /*!< Allocate space for the range of this equation*/
         temp.range = calloc(RANGE_SIZE, sizeof(double)); /*!< Allocate space for the range of this equation*/
-        temp.printExperiment = genRandIntP(data->numExperiments);
+        temp.printExperiment = derivePrintExperiment(data->seed, equationPos, i, data->numExperiments); /*!< Pick the experiment to log from the master seed so a replay logs the same one*/
         /*!
          * Loop through the range for this equation and copy the values over.
          */
@@ -70,43 +90,80 @@ int runEquationsAsThreads(int equationPos, char* eqName, Info* data){
      * struct for each dimension. If it fails, print the error message, free the struct, and return failure.
      */
     pthread_t *threads = calloc(numDim, sizeof(pthread_t));
-    int numExp = data->numExperiments;
-    for(int e = 0; e < numExp; e++) {
-        for (int i = 0; i < numDim; i++) {
-            eqInfo[i].currExperiment = e; /*!< Set the currentExperiment number for this test*/
-            if (pthread_create(&threads[i], NULL, testTypeCalls[data->testSelection], &eqInfo[i]) < 0) {
-                fprintf(stderr,
-                        "There was an error creating the equation dimension thread for equation: %s and test dimension: %d",
-                        eqName, i);
-                for (int j = 0; j < numDim; j++) {
-                    freeEquationInfo(&eqInfo[j]);
-                }
-                free(threads);
-                return -1;
-            }
-        }
+    int firstExp = 0, /*!< The first experiment to run*/
+    lastExp = data->numExperiments, /*!< One past the last experiment to run*/
+    firstDim = 0, /*!< The position of the first dimension to run*/
+    lastDim = numDim; /*!< One past the position of the last dimension to run*/
+    /*!
+     * If a single run is being replayed, only run its dimension and experiment.
+     */
+    if(data->replay){
+        firstExp = data->replayExperiment;
+        lastExp = firstExp + 1;
+        firstDim = data->replayDimIndex;
+        lastDim = firstDim + 1;
+    }
+    Arena* arenas = calloc(numDim, sizeof(Arena)); /*!< The arena every run of a dimension allocates its buffers from*/
+    int batchEnd; /*!< One past the position of the last dimension of the current batch*/
+    /*!
+     * Run the dimensions in batches which fit under the memory cap, waiting until the other equations leave room for
+     * each batch. Without a cap every dimension is in a single batch.
+     */
+    for(int batchStart = firstDim; batchStart < lastDim; batchStart = batchEnd){
+        size_t batchBytes; /*!< The memory of every run of the batch*/
+        batchEnd = nextTaskBatch(data, batchStart, lastDim, &batchBytes);
+        acquireMemory(batchBytes, data->memoryCap);
         /*!
-         * Wait for all the threads to finish, and if there was an error, print the last error and return failure.
+         * Create the arena of every dimension of the batch once, sized for a run of that dimension, so the
+         * experiments only reset it.
          */
-        for (int i = 0; i < numDim; i++) {
-            if (pthread_join(threads[i], NULL) < 0) {
-                fprintf(stderr,
-                        "There was an error joining the equation dimension thread for equation: %s and test dimension: %d",
-                        eqName, i);
-                for (int j = 0; j < numDim; j++) {
-                    freeEquationInfo(&eqInfo[j]);
+        for(int i = batchStart; i < batchEnd; i++){
+            arenas[i] = createArena(taskBytes(data, i), data->hugePages);
+            eqInfo[i].arena = &arenas[i];
+        }
+        for(int e = firstExp; e < lastExp; e++) {
+            for (int i = batchStart; i < batchEnd; i++) {
+                eqInfo[i].currExperiment = e; /*!< Set the currentExperiment number for this test*/
+                eqInfo[i].cellSeed = deriveCellSeed(data->seed, equationPos, i, e); /*!< Set the seed of this run from its position*/
+                resetArena(&arenas[i]); ///the previous experiment of this dimension has finished with its buffers
+                if (pthread_create(&threads[i], NULL, testTypeCalls[data->testSelection], &eqInfo[i]) < 0) {
+                    fprintf(stderr,
+                            "There was an error creating the equation dimension thread for equation: %s and test dimension: %d",
+                            eqName, i);
+                    for (int j = 0; j < numDim; j++) {
+                        freeEquationInfo(&eqInfo[j]);
+                    }
+                    free(threads);
+                    return -1;
+                }
+            }
+            /*!
+             * Wait for all the threads to finish, and if there was an error, print the last error and return failure.
+             */
+            for (int i = batchStart; i < batchEnd; i++) {
+                if (pthread_join(threads[i], NULL) < 0) {
+                    fprintf(stderr,
+                            "There was an error joining the equation dimension thread for equation: %s and test dimension: %d",
+                            eqName, i);
+                    for (int j = 0; j < numDim; j++) {
+                        freeEquationInfo(&eqInfo[j]);
+                    }
+                    free(threads);
+                    return -1;
                 }
-                free(threads);
-                return -1;
             }
+            printf("EquationInfo completed successfully: %s\n", eqInfo[0].equationName);
+            fflush(stdout);
         }
-        printf("EquationInfo completed successfully: %s\n", eqInfo[0].equationName);
-        fflush(stdout);
+        for(int i = batchStart; i < batchEnd; i++)
+            releaseArena(&arenas[i]);
+        releaseMemory(batchBytes, data->memoryCap); ///the batch has finished, let the waiting equations start theirs
     }
     /*!
-     * This equation has finished for all dimensions and experiments, free the threads array, free the array of EquationInfo structs and return success.
+     * This equation has finished for all dimensions and experiments, free the threads array and the arenas, free the array of EquationInfo structs and return success.
      */
     free(threads);
+    free(arenas);
     for(int j = 0; j < numDim; j++) {
         freeEquationInfo(&eqInfo[j]);
     }
@@ -256,4 +313,29 @@ void* alpineHandler(void* info){
     /// pass in the variables defined above to the runEquationsAsThreads method and if it returns less than 0 it failed and exit failure
     if(runEquationsAsThreads(equationPos, eqName, data) < 0)
         exit(EXIT_FAILURE);
-}
\ No newline at end of file
+}
+void* pluginHandler(void* run){
+    EquationRun* plugin = ((EquationRun*)run); /*!< Cast the passed in struct back to an EquationRun struct for processing*/
+    char* eqName = pluginName(plugin->equationPos); /*!< Set the name the plugin was registered under for file output in writeResultsToFile defined in src/Utilities.h*/
+    /// pass in the variables defined above to the runEquationsAsThreads method and if it returns less than 0 it failed and exit failure
+    if(runEquationsAsThreads(plugin->equationPos, eqName, plugin->data) < 0)
+        exit(EXIT_FAILURE);
+    return NULL;
+}
+void* formulaHandler(void* run){
+    EquationRun* formula = ((EquationRun*)run); /*!< Cast the passed in struct back to an EquationRun struct for processing*/
+    char* eqName = formulaName(formula->equationPos); /*!< Set the name the formula was registered under for file output in writeResultsToFile defined in src/Utilities.h*/
+    /// pass in the variables defined above to the runEquationsAsThreads method and if it returns less than 0 it failed and exit failure
+    if(runEquationsAsThreads(formula->equationPos, eqName, formula->data) < 0)
+        exit(EXIT_FAILURE);
+    return NULL;
+}
+
+void* variantHandler(void* run){
+    EquationRun* variant = ((EquationRun*)run); /*!< Cast the passed in struct back to an EquationRun struct for processing*/
+    char* eqName = variantName(variant->equationPos); /*!< Set the name the variant was registered under for file output in writeResultsToFile defined in src/Utilities.h*/
+    /// pass in the variables defined above to the runEquationsAsThreads method and if it returns less than 0 it failed and exit failure
+    if(runEquationsAsThreads(variant->equationPos, eqName, variant->data) < 0)
+        exit(EXIT_FAILURE);
+    return NULL;
+}
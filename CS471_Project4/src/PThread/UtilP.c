@@ -2,13 +2,18 @@
 // Created by Taylor Apple on 5/2/2019.
 //
 /*! \file UtilP.c
- * \brief contains the implementations for the methods declared in src/Utilities.h which produce random numbers using a mutex in POSIX format.
+ * \brief contains the implementations for the methods declared in src/Utilities.h which produce random numbers using a mutex, pin threads, open plugins and run the work pool in POSIX format.
  *
  */
 
+#define _GNU_SOURCE
 #include "../src/Utilities.h"
 #include "../src/m19937ar-cok.h"
+#include "../src/Memetic.h"
 #include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <dlfcn.h>
 
 int genRandIntP(int modulo){
     int result = 0;/*!< Initialize the result*/
@@ -24,4 +29,236 @@ double genRandRealP(){
     result = genrand_real1(); ///generate a random real number with the method defined in ../src/m19937ar-cok.h
     pthread_mutex_unlock(&mutex);///done accessing the random number generator
     return result;///return the result
-}
\ No newline at end of file
+}
+void pinThread(int cpu){
+#ifdef __linux__
+    if(cpu < 0)
+        return;
+    cpu_set_t set; /*!< The set holding only the CPU to run on*/
+    CPU_ZERO(&set);
+    CPU_SET(cpu % CPU_SETSIZE, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set); ///a failure leaves the thread unpinned, which only costs locality
+#else
+    (void)cpu; ///affinity is not available, the thread stays where the scheduler puts it
+#endif
+}
+
+int cpuCount(){
+    long count = sysconf(_SC_NPROCESSORS_ONLN); /*!< The number of CPUs online*/
+    return count > 0 ? (int)count : 1;
+}
+
+size_t physicalMemoryBytes(){
+    long pages = sysconf(_SC_PHYS_PAGES), /*!< The number of physical pages*/
+    pageSize = sysconf(_SC_PAGESIZE); /*!< The size of a page*/
+    return pages > 0 && pageSize > 0 ? (size_t)pages * (size_t)pageSize : 0;
+}
+
+void* openLibrary(const char* path){
+    void* library = dlopen(path, RTLD_NOW | RTLD_LOCAL); /*!< Resolve every symbol now, so a broken plugin fails here and not in a run*/
+    if(!library)
+        printf("%s\n", dlerror());
+    return library;
+}
+
+void* librarySymbol(void* library, const char* name){
+    return dlsym(library, name);
+}
+
+static pthread_mutex_t budgetMutex = PTHREAD_MUTEX_INITIALIZER; /*!< The mutex guarding the memory in use by the running tasks*/
+static pthread_cond_t budgetFreed = PTHREAD_COND_INITIALIZER; /*!< Signalled whenever a task returns its memory*/
+static size_t budgetUsed = 0; /*!< The memory in use by the running tasks*/
+
+void acquireMemory(size_t bytes, size_t cap){
+    if(!cap)
+        return;
+    pthread_mutex_lock(&budgetMutex);
+    while(budgetUsed > 0 && budgetUsed + bytes > cap) ///wait for running tasks to finish until this one fits
+        pthread_cond_wait(&budgetFreed, &budgetMutex);
+    budgetUsed += bytes;
+    pthread_mutex_unlock(&budgetMutex);
+}
+
+void releaseMemory(size_t bytes, size_t cap){
+    if(!cap)
+        return;
+    pthread_mutex_lock(&budgetMutex);
+    budgetUsed -= bytes;
+    pthread_cond_broadcast(&budgetFreed); ///every waiting task checks whether it fits now
+    pthread_mutex_unlock(&budgetMutex);
+}
+
+static pthread_mutex_t cutShortMutex = PTHREAD_MUTEX_INITIALIZER; /*!< The mutex guarding the totals of the bounded evaluations*/
+static long cutShortEvaluations = 0, /*!< The bounded evaluations of every finished run*/
+cutShortCount = 0; /*!< The number of them which stopped early*/
+
+void recordCutShort(long evaluations, long cutShort){
+    pthread_mutex_lock(&cutShortMutex);
+    cutShortEvaluations += evaluations;
+    cutShortCount += cutShort;
+    pthread_mutex_unlock(&cutShortMutex);
+}
+
+void readCutShort(long* evaluations, long* cutShort){
+    pthread_mutex_lock(&cutShortMutex);
+    *evaluations = cutShortEvaluations;
+    *cutShort = cutShortCount;
+    pthread_mutex_unlock(&cutShortMutex);
+}
+
+static pthread_mutex_t heapMutex = PTHREAD_MUTEX_INITIALIZER; /*!< The mutex guarding the total of the heap allocations*/
+static long heapAllocationTotal = 0; /*!< The heap allocations the iterations of every finished run made*/
+
+void recordHeapAllocations(long count){
+    pthread_mutex_lock(&heapMutex);
+    heapAllocationTotal += count;
+    pthread_mutex_unlock(&heapMutex);
+}
+
+void readHeapAllocations(long* count){
+    pthread_mutex_lock(&heapMutex);
+    *count = heapAllocationTotal;
+    pthread_mutex_unlock(&heapMutex);
+}
+
+static pthread_mutex_t cacheMutex = PTHREAD_MUTEX_INITIALIZER; /*!< The mutex guarding the totals of the fitness caches*/
+static long cacheLookups = 0, /*!< The vectors looked up in the cache of every finished run*/
+cacheHits = 0; /*!< The number of them which were found*/
+
+void recordCacheHits(const FitnessCache* cache){
+    if(!cache)
+        return;
+    pthread_mutex_lock(&cacheMutex);
+    cacheLookups += cache->lookups;
+    cacheHits += cache->hits;
+    pthread_mutex_unlock(&cacheMutex);
+}
+
+void readCacheHits(long* lookups, long* hits){
+    pthread_mutex_lock(&cacheMutex);
+    *lookups = cacheLookups;
+    *hits = cacheHits;
+    pthread_mutex_unlock(&cacheMutex);
+}
+
+static pthread_mutex_t memeticMutex = PTHREAD_MUTEX_INITIALIZER; /*!< The mutex guarding the totals of the memetic refinements*/
+static long memeticRefinements = 0, /*!< The refinements of every finished run*/
+memeticImproved = 0, /*!< The number of them which replaced the best vector*/
+memeticEvaluations = 0; /*!< The evaluations they made*/
+
+void recordRefinements(const Memetic* memetic){
+    if(!memetic)
+        return;
+    pthread_mutex_lock(&memeticMutex);
+    memeticRefinements += memetic->refinements;
+    memeticImproved += memetic->improved;
+    memeticEvaluations += memetic->evaluations;
+    pthread_mutex_unlock(&memeticMutex);
+}
+
+void readRefinements(long* refinements, long* improved, long* evaluations){
+    pthread_mutex_lock(&memeticMutex);
+    *refinements = memeticRefinements;
+    *improved = memeticImproved;
+    *evaluations = memeticEvaluations;
+    pthread_mutex_unlock(&memeticMutex);
+}
+
+/*!
+ * A call to parallelFor waiting in the queue of the work pool. It lives on the stack of the calling thread, which
+ * takes chunks of it as well and only returns once no chunk is unfinished.
+ */
+typedef struct _WorkJob{
+    ParallelBody body;
+    void* context;
+    int count;
+    int grain;
+    int next;
+    int unfinished;
+    struct _WorkJob* nextJob;
+}WorkJob;
+
+static pthread_mutex_t poolMutex = PTHREAD_MUTEX_INITIALIZER; /*!< The mutex guarding the queue of the work pool*/
+static pthread_cond_t poolWork = PTHREAD_COND_INITIALIZER; /*!< Signalled whenever a job is queued*/
+static pthread_cond_t poolDone = PTHREAD_COND_INITIALIZER; /*!< Signalled whenever a job finishes its last chunk*/
+static WorkJob* poolJobs = NULL; /*!< The jobs with chunks left to take, oldest first*/
+static int poolWorkers = 0; /*!< The number of worker threads started*/
+
+static void takeChunk(WorkJob* job, int* begin, int* end){
+    *begin = job->next;
+    *end = job->next + job->grain < job->count ? job->next + job->grain : job->count;
+    job->next = *end;
+    if(job->next == job->count){ ///the last chunk is taken, so the job leaves the queue
+        WorkJob** link = &poolJobs;
+        while(*link != job)
+            link = &(*link)->nextJob;
+        *link = job->nextJob;
+    }
+}
+
+static void finishChunk(WorkJob* job, int begin, int end){
+    job->unfinished -= end - begin;
+    if(!job->unfinished)
+        pthread_cond_broadcast(&poolDone);
+}
+
+static void* poolWorker(void* unused){
+    (void)unused;
+    int begin, end;
+    pthread_mutex_lock(&poolMutex);
+    /*!
+     * Take chunks from the oldest job in the queue until the program exits, waiting whenever the queue is empty.
+     */
+    for(;;){
+        while(!poolJobs)
+            pthread_cond_wait(&poolWork, &poolMutex);
+        WorkJob* job = poolJobs;
+        takeChunk(job, &begin, &end);
+        pthread_mutex_unlock(&poolMutex);
+        job->body(job->context, begin, end);
+        pthread_mutex_lock(&poolMutex);
+        finishChunk(job, begin, end);
+    }
+    return NULL;
+}
+
+void startWorkPool(int threads){
+    pthread_t thread;
+    /*!
+     * The thread calling parallelFor works on its own job, so one fewer worker is started than threads requested.
+     */
+    for(int i = poolWorkers; i < threads - 1; i++){
+        if(pthread_create(&thread, NULL, poolWorker, NULL) != 0)
+            break; ///the pool runs with the workers it has, parallelFor still finishes every job on the calling thread
+        pthread_detach(thread);
+        poolWorkers++;
+    }
+}
+
+void parallelFor(int count, int grain, ParallelBody body, void* context){
+    int begin, end;
+    if(!poolWorkers || count <= grain){ ///too little work to share, run it all here
+        body(context, 0, count);
+        return;
+    }
+    WorkJob job = {body, context, count, grain, 0, count, NULL}, /*!< The job shared with the workers*/
+    **link = &poolJobs; /*!< The end of the queue*/
+    pthread_mutex_lock(&poolMutex);
+    while(*link)
+        link = &(*link)->nextJob;
+    *link = &job;
+    pthread_cond_broadcast(&poolWork);
+    /*!
+     * Work on the job alongside the workers, then wait for the chunks they took to finish.
+     */
+    while(job.next < job.count){
+        takeChunk(&job, &begin, &end);
+        pthread_mutex_unlock(&poolMutex);
+        body(context, begin, end);
+        pthread_mutex_lock(&poolMutex);
+        finishChunk(&job, begin, end);
+    }
+    while(job.unfinished)
+        pthread_cond_wait(&poolDone, &poolMutex);
+    pthread_mutex_unlock(&poolMutex);
+}
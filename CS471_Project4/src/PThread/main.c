@@ -10,6 +10,11 @@
 #include "../src/Utilities.h"
 #include "../src/Init.h"
 #include "../src/EquationHandlers.h"
+#include "../src/MemoryPlan.h"
+#include "../src/CpuFeatures.h"
+#include "../src/Memetic.h"
+#include <inttypes.h>
+#include <time.h>
 #include "../src/m19937ar-cok.h"
 #include <pthread.h>
 
@@ -71,11 +76,7 @@ int main(int argc, char*argv[]) {
         perror("There was an issue trying to initialize the mutex:");
         return -2;
     }
-    unsigned long seed = clock(); /*! < generating a value to seed the Mersenne Twister algorithm*/
-    /*!
-     * Seed the Mersenne Twister algorithm defined in src/m19937ar-cok.h
-     */
-    init_genrand(seed);
+    detectSimdLevel(); ///detect the SIMD instruction sets once before any threads are started
     /*!
      * Once the filename is set, process the init file, passing in the Info struct and the file name
      * to the init function of src/Init.h. The init method will print the subsequent errors and
@@ -85,6 +86,14 @@ int main(int argc, char*argv[]) {
         freeInfo(&progInfo);
         return -1;
     }
+    /*!
+     * If no seed line was provided generate the master seed from the clock. Print it so the run can be reproduced, then
+     * seed the Mersenne Twister algorithm defined in src/m19937ar-cok.h with it.
+     */
+    if(!progInfo.seedProvided)
+        progInfo.seed = ((uint64_t)time(NULL) << 32) ^ (uint64_t)clock();
+    printf("Master seed: %" PRIu64 "\n", progInfo.seed);
+    init_genrand((unsigned long)progInfo.seed);
 
     int numExp = progInfo.numExperiments,
     numEq = progInfo.numEquations; /*! < creating a local variable for the number of equations to avoid accessing the struct multiple times*/
@@ -94,21 +103,40 @@ int main(int argc, char*argv[]) {
      */
     printMatrix(progInfo.ranges, numEq, RANGE_SIZE);
     printIArray(progInfo.dimsToTest, progInfo.numDimensions);
+    printMemoryPlan(&progInfo); ///plan the memory of every run before any of them start
+    installEquationKernels(progInfo.kernels); ///replace the objective functions with the selected kernels before any threads are started
+    startWorkPool(progInfo.batchThreads); ///start the workers every batch of vectors is shared with, none unless the batch threads line asks for them
 
     /*!
      * Create an array of pthread_t which is how threads are referenced in POSIX threads.
      * Iterate from 0 to (numExp - 1) and set the current experiment number to our iteration.
-     * Iterate from 0 to (numEq - 1) and start a thread for each equation handler from
+     * Iterate through the equations to be run and start a thread for each equation handler from
      * the constant defined above. Each thread will be passed a reference to the progInfo
      * struct. If it fails, print the error message, free progInfo and threads, and return failure.
      */
-    pthread_t *threads = calloc(numEq, sizeof(pthread_t));
+    pthread_t *threads = calloc(MAX_NUM_EQUATIONS, sizeof(pthread_t));
+    EquationRun *equationRuns = calloc(MAX_NUM_EQUATIONS - NUM_BUILTIN_EQUATIONS, sizeof(EquationRun)); /*!< The Info struct and position passed to the thread of every objective plugin, formula and variant*/
+    int numThreads = 0; /*!< The number of equation threads started*/
 
-    for (int i = 0; i < numEq; i++) {
-        if (pthread_create(&threads[i], NULL, equationHandlers[i], &progInfo) < 0) {
+    /*!
+     * The built in functions are followed by the objective plugins, formulas and variants, whose threads are passed their
+     * EquationRun. In replay mode only the replayed equation is run.
+     */
+    for (int i = 0; i < MAX_NUM_EQUATIONS; i++) {
+        if (progInfo.replay ? i != progInfo.replayEquation : !equationInRun(&progInfo, i))
+            continue;
+        const void* handler = i < NUM_BUILTIN_EQUATIONS ? equationHandlers[i] : i < FIRST_FORMULA_EQUATION ? (const void*)&pluginHandler : i < FIRST_VARIANT_EQUATION ? (const void*)&formulaHandler : (const void*)&variantHandler; /*!< The handler of the equation*/
+        void* argument = &progInfo; /*!< The struct passed to the handler*/
+        if (i >= NUM_BUILTIN_EQUATIONS) {
+            equationRuns[i - NUM_BUILTIN_EQUATIONS].data = &progInfo;
+            equationRuns[i - NUM_BUILTIN_EQUATIONS].equationPos = i;
+            argument = &equationRuns[i - NUM_BUILTIN_EQUATIONS];
+        }
+        if (pthread_create(&threads[numThreads++], NULL, handler, argument) < 0) {
             fprintf(stderr, "There was an error creating the equation thread at position: %d", i);
             freeInfo(&progInfo);
             free(threads);
+            free(equationRuns);
             return -1;
         }
     }
@@ -117,19 +145,24 @@ int main(int argc, char*argv[]) {
      * before finalising the program. If it fails, print the error message, free progInfo and threads,
      * and return failure.
      */
-    for (int i = 0; i < numEq; i++) {
+    for (int i = 0; i < numThreads; i++) {
         if (pthread_join(threads[i], NULL) < 0) {
             fprintf(stderr, "There was an error joining the equation thread at position: %d", i);
             freeInfo(&progInfo);
             free(threads);
+            free(equationRuns);
             return -1;
         }
     }
+    printCutShort();
+    printCacheHits();
+    printRefinements();
     /*!
      * The program has finished. Free progInfo and threads, then destroy the mutex then return success.
      */
     freeInfo(&progInfo);
     free(threads);
+    free(equationRuns);
     pthread_mutex_destroy(&mutex);
     return 0;
 }
\ No newline at end of file
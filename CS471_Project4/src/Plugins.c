@@ -0,0 +1,138 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Plugins.c
+ * \brief This is where the methods defined in src/Plugins.h are implemented.
+ *
+ *  The plugins are only loaded while the init file is read, before any threads are started, and their libraries stay
+ *  open until the program exits, so the registry below is never written while a run reads it.
+ */
+#include "Plugins.h"
+
+static ObjectivePlugin plugins[MAX_NUM_PLUGINS]; /*!< The description exported by every plugin loaded*/
+static char* pluginNames[MAX_NUM_PLUGINS]; /*!< The name every plugin was registered under*/
+static int numPlugins = 0; /*!< The number of plugins loaded*/
+
+/*!
+ * Evaluates a single vector through the batch function of a plugin which has no function for a single vector.
+ */
+static double evaluateOne(const ObjectivePlugin* plugin, const Real* vector, int numDim){
+    double fitness; /*!< The fitness of the vector*/
+    plugin->evaluateBatch(&vector, 1, numDim, &fitness);
+    return fitness;
+}
+
+/*!
+ * Evaluates a single vector and stores its gradient through a plugin which has a gradient function, which only stores
+ * the gradient.
+ */
+static double gradientOne(const ObjectivePlugin* plugin, const Real* vector, int numDim, double* gradient){
+    plugin->gradient(vector, numDim, gradient);
+    return plugin->evaluate ? plugin->evaluate(vector, numDim) : evaluateOne(plugin, vector, numDim);
+}
+
+/*!
+ * Defines the EquationFunction, DeltaFunction and EquationGradient of the plugin in a slot of the registry. They take
+ * no context, so every slot has its own set, each forwarding to the plugin stored in its slot.
+ */
+#define PLUGIN_SLOT(slot) \
+static double pluginEvaluate##slot(const Real* vector, int numDim){ \
+    return evaluateOne(&plugins[slot], vector, numDim); \
+} \
+static double pluginDelta##slot(const Real* vector, int numDim, const MoveLog* log, double baseFit){ \
+    return plugins[slot].delta(vector, numDim, log->dims, log->previous, log->count, baseFit); \
+} \
+static double pluginGradient##slot(const Real* vector, int numDim, double* gradient){ \
+    return gradientOne(&plugins[slot], vector, numDim, gradient); \
+}
+
+PLUGIN_SLOT(0)
+PLUGIN_SLOT(1)
+PLUGIN_SLOT(2)
+PLUGIN_SLOT(3)
+PLUGIN_SLOT(4)
+PLUGIN_SLOT(5)
+PLUGIN_SLOT(6)
+PLUGIN_SLOT(7)
+
+#undef PLUGIN_SLOT
+
+//! The functions of every slot of the registry evaluating a single vector, in slot order
+static const EquationFunction slotEvaluates[MAX_NUM_PLUGINS] = {
+    &pluginEvaluate0, &pluginEvaluate1, &pluginEvaluate2, &pluginEvaluate3,
+    &pluginEvaluate4, &pluginEvaluate5, &pluginEvaluate6, &pluginEvaluate7
+};
+
+//! The delta functions of every slot of the registry, in slot order
+static const DeltaFunction slotDeltas[MAX_NUM_PLUGINS] = {
+    &pluginDelta0, &pluginDelta1, &pluginDelta2, &pluginDelta3,
+    &pluginDelta4, &pluginDelta5, &pluginDelta6, &pluginDelta7
+};
+
+//! The gradient functions of every slot of the registry, in slot order
+static const EquationGradient slotGradients[MAX_NUM_PLUGINS] = {
+    &pluginGradient0, &pluginGradient1, &pluginGradient2, &pluginGradient3,
+    &pluginGradient4, &pluginGradient5, &pluginGradient6, &pluginGradient7
+};
+
+int loadPlugin(const char* name, const char* path){
+    void* library; /*!< The opened shared library*/
+    const ObjectivePlugin* plugin; /*!< The description the library exports*/
+    if(numPlugins == MAX_NUM_PLUGINS){
+        printf("Too many objective plugins were named. Please name at most %d and try again.\n", MAX_NUM_PLUGINS);
+        return -1;
+    }
+    if(!(library = openLibrary(path))){
+        printf("The objective plugin %s could not be opened from %s. Please check the input file and try again.\n", name, path);
+        return -1;
+    }
+    if(!(plugin = librarySymbol(library, OBJECTIVE_PLUGIN_SYMBOL))){
+        printf("The objective plugin %s does not export %s. Please check the plugin and try again.\n", name, OBJECTIVE_PLUGIN_SYMBOL);
+        return -1;
+    }
+    /*!
+     * Check that the plugin was built against this interface with the same Real as the program, and that its batch
+     * function, bounds and dimensionality limits are usable. If not tell the user and return failure.
+     */
+    if(plugin->abiVersion != OBJECTIVE_PLUGIN_ABI || plugin->realBytes != (int)sizeof(Real)){
+        printf("The objective plugin %s was built for interface %d with %d byte values, but the program uses interface %d with %d byte values. Please rebuild the plugin and try again.\n",
+               name, plugin->abiVersion, plugin->realBytes, OBJECTIVE_PLUGIN_ABI, (int)sizeof(Real));
+        return -1;
+    }
+    if(!plugin->evaluateBatch || !(plugin->lower < plugin->upper) || plugin->minDimensions < 1 ||
+            (plugin->maxDimensions != 0 && plugin->maxDimensions < plugin->minDimensions)){
+        printf("The objective plugin %s needs a batch function, a lower bound below its upper bound and at least 1 dimension. Please check the plugin and try again.\n", name);
+        return -1;
+    }
+    plugins[numPlugins] = *plugin;
+    pluginNames[numPlugins] = malloc(strlen(name) + 1);
+    strcpy(pluginNames[numPlugins], name);
+    return NUM_BUILTIN_EQUATIONS + numPlugins++;
+}
+
+int pluginCount(){
+    return numPlugins;
+}
+
+char* pluginName(int equation){
+    return pluginNames[equation - NUM_BUILTIN_EQUATIONS];
+}
+
+const ObjectivePlugin* pluginAt(int equation){
+    return &plugins[equation - NUM_BUILTIN_EQUATIONS];
+}
+
+Objective pluginObjective(int equation, int dimensions){
+    int slot = equation - NUM_BUILTIN_EQUATIONS; /*!< The slot of the plugin in the registry*/
+    Objective objective; /*!< Declare the functions of the run to be returned*/
+    objective.equation = equation;
+    objective.dimensions = dimensions;
+    objective.function = plugins[slot].evaluate ? plugins[slot].evaluate : slotEvaluates[slot];
+    objective.anySize = objective.function;
+    objective.batch = NULL; ///the plugin evaluates whole rows, so nothing is gathered one row per dimension for it
+    objective.rows = plugins[slot].evaluateBatch;
+    objective.delta = plugins[slot].delta ? slotDeltas[slot] : NULL;
+    objective.gradient = plugins[slot].gradient ? slotGradients[slot] : NULL;
+    return objective;
+}
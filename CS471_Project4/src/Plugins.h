@@ -0,0 +1,53 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Plugins.h
+ * \brief This is where the objective functions loaded from the plugins of src/ObjectivePlugin.h are registered.
+ *
+ *  Every plugin named in the optional 'Objective Plugins' line of the init file is loaded once while the init file is
+ *  read and takes the next EquationPosition after the built in functions, so the functions of a plugin are run by the
+ *  same handlers, work pool and arenas as the built in ones. resolveObjective in src/Utilities.h picks up the functions
+ *  of a plugin from pluginObjective, and nothing else has to tell the two apart.
+ */
+#ifndef TESTINGSUITE_PLUGINS_H
+#define TESTINGSUITE_PLUGINS_H
+
+#include "Utilities.h"
+#include "ObjectivePlugin.h"
+
+/// \fn int loadPlugin(const char* name, const char* path)
+/// \brief Opens the shared library at path, checks the ObjectivePlugin it exports and registers its function under
+/// name, after the built in functions and the plugins loaded before it.
+///
+/// \param name - the name of the function, used in the output and the names of the result files
+/// \param path - the path of the shared library
+/// \return the EquationPosition of the function, or -1 if it could not be loaded, having told the user why
+int loadPlugin(const char* name, const char* path);
+/// \fn int pluginCount()
+/// \brief Returns the number of plugins loaded, whose functions take the positions from NUM_BUILTIN_EQUATIONS on.
+///
+/// \return the number of plugins
+int pluginCount();
+/// \fn char* pluginName(int equation)
+/// \brief Returns the name the function of a plugin was registered under.
+///
+/// \param equation - the position of the function, at least NUM_BUILTIN_EQUATIONS
+/// \return the name of the function
+char* pluginName(int equation);
+/// \fn const ObjectivePlugin* pluginAt(int equation)
+/// \brief Returns the description the plugin of a function exported, with its bounds and dimensionality limits.
+///
+/// \param equation - the position of the function, at least NUM_BUILTIN_EQUATIONS
+/// \return the description of the plugin
+const ObjectivePlugin* pluginAt(int equation);
+/// \fn Objective pluginObjective(int equation, int dimensions)
+/// \brief Looks up the functions evaluating the function of a plugin at the size of one run, called by
+/// resolveObjective for every position from NUM_BUILTIN_EQUATIONS on.
+///
+/// \param equation - the position of the function, at least NUM_BUILTIN_EQUATIONS
+/// \param dimensions - the number of dimensions of every vector of the run
+/// \return the functions of the run
+Objective pluginObjective(int equation, int dimensions);
+
+#endif //TESTINGSUITE_PLUGINS_H
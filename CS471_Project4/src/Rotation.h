@@ -0,0 +1,55 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Rotation.h
+ * \brief This is where the layout of the rotation matrices of the variants in src/Variants.h is defined.
+ *
+ *  A rotation is applied to many vectors at once as a matrix-matrix product, z = M y for every vector y. The matrix is
+ *  stored transposed, row j holding the weights of y[j] for every output, and every row is padded with zeros to a stride
+ *  of whole ROTATION_COLUMN_BLOCKs. The product then runs over strips of ROTATION_COLUMN_BLOCK outputs, adding y[j]
+ *  times a contiguous piece of row j to the outputs of ROTATION_BLOCK_ROWS vectors at a time, so every piece of the
+ *  matrix loaded is used for several vectors. The rows are taken a panel of ROTATION_PANEL_ROWS at a time, so the strip
+ *  of the panel being used stays in the first level cache while it is applied to every vector.
+ *
+ *  rotateRowsScalar is the reference every kernel follows. src/SimdKernels.h computes the same sums VEC_WIDTH outputs at
+ *  a time, which only differ from it by rounding.
+ */
+#ifndef TESTINGSUITE_ROTATION_H
+#define TESTINGSUITE_ROTATION_H
+
+#define ROTATION_COLUMN_BLOCK 16 /*!< declare the constant for the number of outputs in a strip, two of the widest vectors*/
+#define ROTATION_BLOCK_ROWS 4 /*!< declare the constant for the number of vectors a strip is applied to at a time*/
+#define ROTATION_PANEL_ROWS 256 /*!< declare the constant for the number of rows of the matrix in a panel*/
+
+/*!
+ * The signature of the kernels applying a rotation to count vectors. rotation holds dimensions rows of stride values,
+ * inputs and outputs count rows of stride values, of which the first dimensions inputs of every row are read and every
+ * output is written.
+ */
+typedef void (*RotationKernel)(const double* rotation, int stride, const double* inputs, int count, int dimensions, double* outputs);
+
+/// \fn void rotateRowsScalar(const double* rotation, int stride, const double* inputs, int count, int dimensions, double* outputs)
+/// \brief Applies a rotation to count vectors one output at a time, following the panels of the kernels.
+///
+/// \param rotation - the transposed matrix, dimensions rows of stride values
+/// \param stride - the padded length of every row, a multiple of ROTATION_COLUMN_BLOCK
+/// \param inputs - the vectors, one per row of stride values
+/// \param count - the number of vectors
+/// \param dimensions - the number of dimensions of every vector
+/// \param outputs - stores the rotated vectors, one per row of stride values
+static inline void rotateRowsScalar(const double* rotation, int stride, const double* inputs, int count, int dimensions, double* outputs){
+    for(int c = 0; c < count; c++){
+        const double* y = inputs + (long)c * stride; /*!< The vector being rotated*/
+        double* z = outputs + (long)c * stride; /*!< The rotated vector*/
+        for(int i = 0; i < stride; i++)
+            z[i] = 0;
+        for(int j = 0; j < dimensions; j++){
+            const double* row = rotation + (long)j * stride; /*!< The weights of y[j] for every output*/
+            for(int i = 0; i < stride; i++)
+                z[i] += y[j] * row[i];
+        }
+    }
+}
+
+#endif //TESTINGSUITE_ROTATION_H
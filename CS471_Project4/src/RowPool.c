@@ -0,0 +1,79 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file RowPool.c
+ * \brief This is where all methods defined in src/RowPool.h are implemented.
+ *
+ */
+#include "RowPool.h"
+#include <string.h>
+
+static void releaseRow(RowPool* pool, int row){
+    if(--pool->refs[row] == 0) ///nothing refers to the row anymore so it can become the scratch row
+        pool->freeRows[pool->numFree++] = row;
+}
+
+size_t rowPoolBytes(int numSlots, int numRows, int cols){
+    return arenaMatrixBytes(numRows, cols) + 2 * arenaBlockBytes(numSlots, sizeof(int)) + 2 * arenaBlockBytes(numRows, sizeof(int));
+}
+
+RowPool createRowPool(Arena* arena, int numSlots, int numRows, int cols){
+    RowPool pool; /*!< Declare the pool to be returned*/
+    pool.rows = arenaMatrix(arena, numRows, cols);
+    pool.numSlots = numSlots;
+    pool.slots = arenaAlloc(arena, numSlots, sizeof(int));
+    pool.pinned = arenaAlloc(arena, numSlots, sizeof(int));
+    pool.refs = arenaAlloc(arena, numRows, sizeof(int));
+    pool.freeRows = arenaAlloc(arena, numRows, sizeof(int));
+    pool.numFree = 0;
+    pool.isPinned = 0;
+    /*!
+     * Give every slot the row with the same position, and stack the rest so the lowest free row is the first scratch row.
+     */
+    for(int i = 0; i < numSlots; i++){
+        pool.slots[i] = i;
+        pool.refs[i] = 1;
+    }
+    for(int i = numRows - 1; i >= numSlots; i--)
+        pool.freeRows[pool.numFree++] = i;
+    return pool;
+}
+
+Matrix poolMatrix(const RowPool* pool, int numRows){
+    Matrix matrix = pool->rows; /*!< The matrix shares the storage and stride of the pool*/
+    matrix.rows = numRows;
+    return matrix;
+}
+
+void acceptScratch(RowPool* pool, int slot){
+    int row = pool->freeRows[--pool->numFree]; /*!< Take the scratch row off the stack*/
+    pool->refs[row] = 1;
+    releaseRow(pool, pool->slots[slot]);
+    pool->slots[slot] = row;
+}
+
+void shareSlot(RowPool* pool, int dest, int src){
+    int row = pool->slots[src]; /*!< The row being shared*/
+    pool->refs[row]++; ///count the new reference first so sharing a slot's own row never frees it
+    releaseRow(pool, pool->slots[dest]);
+    pool->slots[dest] = row;
+}
+
+int slotShared(const RowPool* pool, int slot){
+    return pool->refs[pool->slots[slot]] > 1;
+}
+
+void pinSlots(RowPool* pool){
+    /*!
+     * Reference the current rows of every slot before releasing the previous snapshot, so a row in both is never freed.
+     */
+    for(int i = 0; i < pool->numSlots; i++)
+        pool->refs[pool->slots[i]]++;
+    if(pool->isPinned){
+        for(int i = 0; i < pool->numSlots; i++)
+            releaseRow(pool, pool->pinned[i]);
+    }
+    memcpy(pool->pinned, pool->slots, (size_t)pool->numSlots * sizeof(int));
+    pool->isPinned = 1;
+}
@@ -0,0 +1,114 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file RowPool.h
+ * \brief This is where the row pool holding the vectors of a population behind slot indices is defined.
+ *
+ *  Every slot of a population refers to a row of the pool instead of owning it, and every row counts the slots and
+ *  snapshots referring to it. Accepting a candidate built in the scratch row then only changes the row a slot refers
+ *  to, and the replaced row is recycled as soon as nothing refers to it, so no vector is ever copied on replacement.
+ */
+#ifndef TESTINGSUITE_ROWPOOL_H
+#define TESTINGSUITE_ROWPOOL_H
+
+#include "Arena.h"
+
+/*!
+ * A pool of rows shared by numSlots slots. Rows nobody refers to are kept on the freeRows stack, and the top of the
+ * stack is the scratch row candidates are built in. pinned holds the row of every slot at the last call to pinSlots.
+ */
+typedef struct _RowPool{
+    Matrix rows;
+    int* slots;
+    int numSlots;
+    int* refs;
+    int* freeRows;
+    int numFree;
+    int* pinned;
+    int isPinned;
+}RowPool;
+
+/// \fn Real* poolRow(const RowPool* pool, int slot)
+/// \brief Returns the row a slot currently refers to.
+///
+/// \param pool - the pool holding the row
+/// \param slot - the slot of the population
+/// \return a pointer to the first value of the row
+static inline Real* poolRow(const RowPool* pool, int slot){
+    return matrixRow(&pool->rows, pool->slots[slot]);
+}
+
+/// \fn const Real* pinnedRow(const RowPool* pool, int slot)
+/// \brief Returns the row a slot referred to at the last call to pinSlots, which is left untouched until the next one.
+///
+/// \param pool - the pool holding the row
+/// \param slot - the slot of the population
+/// \return a pointer to the first value of the row
+static inline const Real* pinnedRow(const RowPool* pool, int slot){
+    return matrixRow(&pool->rows, pool->pinned[slot]);
+}
+
+/// \fn Real* poolScratch(const RowPool* pool)
+/// \brief Returns the scratch row a candidate is built in before acceptScratch hands it to a slot. The scratch row stays
+/// the same until a candidate is accepted, so a rejected candidate is simply overwritten by the next one.
+///
+/// \param pool - the pool holding the row
+/// \return a pointer to the first value of the row
+static inline Real* poolScratch(const RowPool* pool){
+    return matrixRow(&pool->rows, pool->freeRows[pool->numFree - 1]);
+}
+
+/// \fn RowPool createRowPool(Arena* arena, int numSlots, int numRows, int cols)
+/// \brief Allocates a pool from the arena of a run where slot i refers to row i, and the rows past the last slot are free.
+///
+/// \param arena - the arena of the run the pool is allocated from
+/// \param numSlots - the number of slots of the population
+/// \param numRows - the number of rows of the pool, at least numSlots plus the most rows ever needed besides them
+/// \param cols - the number of values in every row
+/// \return the pool with every row set to 0
+RowPool createRowPool(Arena* arena, int numSlots, int numRows, int cols);
+/// \fn size_t rowPoolBytes(int numSlots, int numRows, int cols)
+/// \brief Calculates the space createRowPool takes from an arena for a pool of the given size.
+///
+/// \param numSlots - the number of slots of the population
+/// \param numRows - the number of rows of the pool
+/// \param cols - the number of values in every row
+/// \return the number of bytes, the rows and every index array included
+size_t rowPoolBytes(int numSlots, int numRows, int cols);
+/// \fn Matrix poolMatrix(const RowPool* pool, int numRows)
+/// \brief Returns a matrix covering the first rows of the pool, which are the rows of the first slots until any slot is
+/// changed, so the initial population can be filled and evaluated in place.
+///
+/// \param pool - the pool holding the rows
+/// \param numRows - the number of rows covered by the matrix
+/// \return a matrix sharing the storage of the pool
+Matrix poolMatrix(const RowPool* pool, int numRows);
+/// \fn void acceptScratch(RowPool* pool, int slot)
+/// \brief Hands the scratch row to a slot, and recycles the row the slot referred to if nothing else refers to it.
+///
+/// \param pool - the pool holding the rows
+/// \param slot - the slot taking the candidate in the scratch row
+void acceptScratch(RowPool* pool, int slot);
+/// \fn void shareSlot(RowPool* pool, int dest, int src)
+/// \brief Makes a slot refer to the row of another slot, recycling the row it referred to if nothing else refers to it.
+///
+/// \param pool - the pool holding the rows
+/// \param dest - the slot being changed
+/// \param src - the slot whose row is shared
+void shareSlot(RowPool* pool, int dest, int src);
+/// \fn int slotShared(const RowPool* pool, int slot)
+/// \brief Checks whether anything besides the slot refers to its row, in which case the row must not be changed in place.
+///
+/// \param pool - the pool holding the rows
+/// \param slot - the slot being checked
+/// \return 1 if the row of the slot is shared, 0 otherwise
+int slotShared(const RowPool* pool, int slot);
+/// \fn void pinSlots(RowPool* pool)
+/// \brief Takes a snapshot of the rows every slot refers to, readable with pinnedRow. The pinned rows are kept out of
+/// the scratch row until the next snapshot, so the snapshot costs one index per slot instead of a copy of the population.
+///
+/// \param pool - the pool holding the rows
+void pinSlots(RowPool* pool);
+
+#endif //TESTINGSUITE_ROWPOOL_H
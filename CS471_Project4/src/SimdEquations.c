@@ -0,0 +1,391 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file SimdEquations.c
+ * \brief This is where the methods defined in src/SimdEquations.h are implemented.
+ *
+ *  The VEC_ macros map the operations of src/SimdKernels.h onto the intrinsics of one instruction set, and that file is
+ *  included once for each. Instruction sets without a fused multiply add use a separate multiply and add.
+ */
+#include "SimdEquations.h"
+#include "Bytecode.h"
+#include "Rotation.h"
+#include "Summation.h"
+#include "CpuFeatures.h"
+#include "Matrix.h"
+#include <float.h>
+#include <math.h>
+#include <stddef.h>
+
+#define ROUND_MAGIC 6755399441055744.0 /*!< declare the constant 1.5 * 2^52, adding it rounds a double to an integer held in the low bits*/
+#define EXPONENT_MAGIC 4503599627370496.0 /*!< declare the constant 2^52, the double whose low mantissa bits hold an exponent field*/
+#define EXPONENT_MAGIC_BITS 0x4330000000000000LL /*!< declare the constant for the bits of EXPONENT_MAGIC*/
+#define MANTISSA_BITS 0x000FFFFFFFFFFFFFLL /*!< declare the constant for the mantissa bits of a double*/
+#define HALF_BITS 0x3FE0000000000000LL /*!< declare the constant for the bits of 0.5*/
+#define TWO_OVER_PI 6.36619772367581382433e-01 /*!< declare the constant 2/pi*/
+#define PIO2_1 1.57079632673412561417e+00 /*!< declare the constant for the first 33 bits of pi/2*/
+#define PIO2_2 6.07710050630396597660e-11 /*!< declare the constant for the next 33 bits of pi/2*/
+#define PIO2_3 2.02226624871116645580e-21 /*!< declare the constant for the next 33 bits of pi/2*/
+#define SIN_S1 -1.66666666666666324348e-01 /*!< declare the constants of the fdlibm sine polynomial*/
+#define SIN_S2 8.33333333332248946124e-03
+#define SIN_S3 -1.98412698298579493134e-04
+#define SIN_S4 2.75573137070700676789e-06
+#define SIN_S5 -2.50507602534068634195e-08
+#define SIN_S6 1.58969099521155010221e-10
+#define COS_C1 4.16666666666666019037e-02 /*!< declare the constants of the fdlibm cosine polynomial*/
+#define COS_C2 -1.38888888888741095749e-03
+#define COS_C3 2.48015872894767294178e-05
+#define COS_C4 -2.75573143513906633035e-07
+#define COS_C5 2.08757232129817482790e-09
+#define COS_C6 -1.13596475577881948265e-11
+#define LOG2_E 1.4426950408889634073599 /*!< declare the constant log2(e)*/
+#define EXP_MIN_ARG -708.0 /*!< declare the constant for the smallest argument of the exponential*/
+#define EXP_MAX_ARG 709.0 /*!< declare the constant for the largest argument of the exponential*/
+#define EXP_C1 6.93145751953125E-1 /*!< declare the constants of the two part ln(2) in the Cephes exponential*/
+#define EXP_C2 1.42860682030941723212E-6
+#define EXP_P0 1.26177193074810590878E-4 /*!< declare the constants of the Cephes exponential Pade approximation*/
+#define EXP_P1 3.02994407707441961300E-2
+#define EXP_P2 9.99999999999999999910E-1
+#define EXP_Q0 3.00198505138664455042E-6
+#define EXP_Q1 2.52448340349684104192E-3
+#define EXP_Q2 2.27265548208155028766E-1
+#define EXP_Q3 2.00000000000000000009E0
+#define SQRT_HALF 7.07106781186547524401E-1 /*!< declare the constant sqrt(1/2)*/
+#define LOG_E1 0.693359375 /*!< declare the constants of the two part ln(2) in the Cephes logarithm*/
+#define LOG_E2 2.121944400546905827679e-4
+#define LOG_P0 1.01875663804580931796E-4 /*!< declare the constants of the Cephes logarithm rational approximation*/
+#define LOG_P1 4.97494994976747001425E-1
+#define LOG_P2 4.70579119878881725854E0
+#define LOG_P3 1.44989225341610930846E1
+#define LOG_P4 1.79368678507819816313E1
+#define LOG_P5 7.70838733755885391666E0
+#define LOG_Q0 1.12873587189167450590E1
+#define LOG_Q1 4.52279145837532221105E1
+#define LOG_Q2 8.29875266912776603211E1
+#define LOG_Q3 7.11544750618563894466E1
+#define LOG_Q4 2.31251620126765340583E1
+#define ACKLEY_ONE_CONST (1.0 / exp(0.2)) /*!< declare the constant 1/e^0.2 of Ackley's One*/
+#define ACKLEY_TWO_CONST (20.0 + exp(1.0)) /*!< declare the constant 20 + e of Ackley's Two*/
+#define FIXED_TABLE_LENGTH 56 /*!< declare the constant for the length of the tables of the fixed size kernels, the largest size rounded up to whole AVX-512 vectors*/
+
+#define VEC_PASTE2(a, b) a##b
+#define VEC_PASTE(a, b) VEC_PASTE2(a, b)
+#define VEC_NAME(name) VEC_PASTE(name, VEC_SUFFIX) /*!< appends the suffix of the instruction set being compiled to a name*/
+
+static const double laneOffsets[8] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0}; /*!< The position plus one of every lane*/
+
+//! The position plus one of every element of the fixed size kernels, the weights of Quartic
+static const double fixedIndices[FIXED_TABLE_LENGTH] = {
+        1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0, 13.0, 14.0, 15.0, 16.0, 17.0, 18.0, 19.0, 20.0,
+        21.0, 22.0, 23.0, 24.0, 25.0, 26.0, 27.0, 28.0, 29.0, 30.0, 31.0, 32.0, 33.0, 34.0, 35.0, 36.0, 37.0, 38.0,
+        39.0, 40.0, 41.0, 42.0, 43.0, 44.0, 45.0, 46.0, 47.0, 48.0, 49.0, 50.0, 51.0, 52.0, 53.0, 54.0, 55.0, 56.0
+};
+
+//! 1/sqrt(j + 1) for every element of the fixed size kernels, the scale of Griewangk's cosines
+static const double fixedInvSqrt[FIXED_TABLE_LENGTH] = {
+        1.0, 0.7071067811865475, 0.5773502691896258, 0.5, 0.4472135954999579, 0.4082482904638631, 0.3779644730092272,
+        0.35355339059327373, 0.3333333333333333, 0.31622776601683794, 0.30151134457776363, 0.2886751345948129,
+        0.2773500981126146, 0.2672612419124244, 0.2581988897471611, 0.25, 0.24253562503633297, 0.23570226039551587,
+        0.22941573387056174, 0.22360679774997896, 0.2182178902359924, 0.21320071635561041, 0.20851441405707477,
+        0.20412414523193154, 0.2, 0.19611613513818404, 0.19245008972987526, 0.1889822365046136, 0.18569533817705186,
+        0.18257418583505536, 0.1796053020267749, 0.17677669529663687, 0.17407765595569785, 0.17149858514250882,
+        0.1690308509457033, 0.16666666666666666, 0.1643989873053573, 0.16222142113076254, 0.16012815380508713,
+        0.15811388300841897, 0.15617376188860607, 0.1543033499620919, 0.15249857033260467, 0.15075567228888181,
+        0.14907119849998599, 0.14744195615489714, 0.14586499149789456, 0.14433756729740646, 0.14285714285714285,
+        0.1414213562373095, 0.14002800840280097, 0.1386750490563073, 0.13736056394868904, 0.13608276348795434,
+        0.13483997249264842, 0.1336306209562122
+};
+
+//! (j + 1)/pi for every element of the fixed size kernels, the scale of Michalewicz's sines
+static const double fixedMichalewicz[FIXED_TABLE_LENGTH] = {
+        0.3183098861837907, 0.6366197723675814, 0.954929658551372, 1.2732395447351628, 1.5915494309189535,
+        1.909859317102744, 2.228169203286535, 2.5464790894703255, 2.864788975654116, 3.183098861837907,
+        3.5014087480216975, 3.819718634205488, 4.138028520389279, 4.45633840657307, 4.7746482927568605,
+        5.092958178940651, 5.411268065124442, 5.729577951308232, 6.047887837492023, 6.366197723675814,
+        6.684507609859605, 7.002817496043395, 7.321127382227186, 7.639437268410976, 7.957747154594767,
+        8.276057040778557, 8.594366926962348, 8.91267681314614, 9.23098669932993, 9.549296585513721, 9.867606471697512,
+        10.185916357881302, 10.504226244065093, 10.822536130248883, 11.140846016432674, 11.459155902616464,
+        11.777465788800255, 12.095775674984045, 12.414085561167836, 12.732395447351628, 13.050705333535419,
+        13.36901521971921, 13.687325105903, 14.00563499208679, 14.32394487827058, 14.642254764454371,
+        14.960564650638162, 15.278874536821952, 15.597184423005743, 15.915494309189533, 16.233804195373324,
+        16.552114081557114, 16.870423967740905, 17.188733853924695, 17.507043740108486, 17.82535362629228
+};
+
+#ifdef SIMD_X86
+/*!
+ * SSE2, two lanes. Without a fused multiply add the reduction of the sine and cosine is only exact for smaller arguments.
+ */
+#define VEC __m128d
+#define VEC_BITS __m128i
+#define VEC_WIDTH 2
+#define VEC_SUFFIX SSE2
+#define VEC_TARGET TARGET_SSE2
+#define VEC_SINCOS_LIMIT 1.0e6
+#define VEC_SET1 _mm_set1_pd
+#define VEC_LOADU _mm_loadu_pd
+#define VEC_STOREU _mm_storeu_pd
+#ifdef SINGLE_PRECISION
+#define VEC_LOAD_REAL(p) _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64((const __m128i*)(p))))
+#else
+#define VEC_LOAD_REAL _mm_loadu_pd
+#endif
+#define VEC_ADD _mm_add_pd
+#define VEC_SUB _mm_sub_pd
+#define VEC_MUL _mm_mul_pd
+#define VEC_DIV _mm_div_pd
+#define VEC_SQRT _mm_sqrt_pd
+#define VEC_MIN _mm_min_pd
+#define VEC_MAX _mm_max_pd
+#define VEC_FMA(a, b, c) _mm_add_pd(_mm_mul_pd(a, b), c)
+#define VEC_FNMA(a, b, c) _mm_sub_pd(c, _mm_mul_pd(a, b))
+#define VEC_ABS(a) _mm_andnot_pd(_mm_set1_pd(-0.0), a)
+#define VEC_SELECT_LT(a, b, x, y) _mm_or_pd(_mm_and_pd(_mm_cmplt_pd(a, b), x), _mm_andnot_pd(_mm_cmplt_pd(a, b), y))
+#define VEC_ANY_GT(a, b) _mm_movemask_pd(_mm_cmpgt_pd(a, b))
+#define VEC_TO_BITS _mm_castpd_si128
+#define VEC_FROM_BITS _mm_castsi128_pd
+#define BITS_SET1 _mm_set1_epi64x
+#define BITS_AND _mm_and_si128
+#define BITS_ANDNOT _mm_andnot_si128
+#define BITS_OR _mm_or_si128
+#define BITS_XOR _mm_xor_si128
+#define BITS_ADD _mm_add_epi64
+#define BITS_SUB _mm_sub_epi64
+#define BITS_SLLI _mm_slli_epi64
+#define BITS_SRLI _mm_srli_epi64
+#include "SimdKernels.h"
+#undef VEC
+#undef VEC_BITS
+#undef VEC_WIDTH
+#undef VEC_SUFFIX
+#undef VEC_TARGET
+#undef VEC_SINCOS_LIMIT
+#undef VEC_SET1
+#undef VEC_LOADU
+#undef VEC_STOREU
+#undef VEC_LOAD_REAL
+#undef VEC_ADD
+#undef VEC_SUB
+#undef VEC_MUL
+#undef VEC_DIV
+#undef VEC_SQRT
+#undef VEC_MIN
+#undef VEC_MAX
+#undef VEC_FMA
+#undef VEC_FNMA
+#undef VEC_ABS
+#undef VEC_SELECT_LT
+#undef VEC_ANY_GT
+#undef VEC_TO_BITS
+#undef VEC_FROM_BITS
+#undef BITS_SET1
+#undef BITS_AND
+#undef BITS_ANDNOT
+#undef BITS_OR
+#undef BITS_XOR
+#undef BITS_ADD
+#undef BITS_SUB
+#undef BITS_SLLI
+#undef BITS_SRLI
+
+/*!
+ * AVX2 with FMA, four lanes.
+ */
+#define VEC __m256d
+#define VEC_BITS __m256i
+#define VEC_WIDTH 4
+#define VEC_SUFFIX AVX2
+#define VEC_TARGET TARGET_AVX2
+#define VEC_SINCOS_LIMIT 1.0e9
+#define VEC_SET1 _mm256_set1_pd
+#define VEC_LOADU _mm256_loadu_pd
+#define VEC_STOREU _mm256_storeu_pd
+#ifdef SINGLE_PRECISION
+#define VEC_LOAD_REAL(p) _mm256_cvtps_pd(_mm_loadu_ps(p))
+#else
+#define VEC_LOAD_REAL _mm256_loadu_pd
+#endif
+#define VEC_ADD _mm256_add_pd
+#define VEC_SUB _mm256_sub_pd
+#define VEC_MUL _mm256_mul_pd
+#define VEC_DIV _mm256_div_pd
+#define VEC_SQRT _mm256_sqrt_pd
+#define VEC_MIN _mm256_min_pd
+#define VEC_MAX _mm256_max_pd
+#define VEC_FMA _mm256_fmadd_pd
+#define VEC_FNMA _mm256_fnmadd_pd
+#define VEC_ABS(a) _mm256_andnot_pd(_mm256_set1_pd(-0.0), a)
+#define VEC_SELECT_LT(a, b, x, y) _mm256_blendv_pd(y, x, _mm256_cmp_pd(a, b, _CMP_LT_OQ))
+#define VEC_ANY_GT(a, b) _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GT_OQ))
+#define VEC_TO_BITS _mm256_castpd_si256
+#define VEC_FROM_BITS _mm256_castsi256_pd
+#define BITS_SET1 _mm256_set1_epi64x
+#define BITS_AND _mm256_and_si256
+#define BITS_ANDNOT _mm256_andnot_si256
+#define BITS_OR _mm256_or_si256
+#define BITS_XOR _mm256_xor_si256
+#define BITS_ADD _mm256_add_epi64
+#define BITS_SUB _mm256_sub_epi64
+#define BITS_SLLI _mm256_slli_epi64
+#define BITS_SRLI _mm256_srli_epi64
+#include "SimdKernels.h"
+#undef VEC
+#undef VEC_BITS
+#undef VEC_WIDTH
+#undef VEC_SUFFIX
+#undef VEC_TARGET
+#undef VEC_SINCOS_LIMIT
+#undef VEC_SET1
+#undef VEC_LOADU
+#undef VEC_STOREU
+#undef VEC_LOAD_REAL
+#undef VEC_ADD
+#undef VEC_SUB
+#undef VEC_MUL
+#undef VEC_DIV
+#undef VEC_SQRT
+#undef VEC_MIN
+#undef VEC_MAX
+#undef VEC_FMA
+#undef VEC_FNMA
+#undef VEC_ABS
+#undef VEC_SELECT_LT
+#undef VEC_ANY_GT
+#undef VEC_TO_BITS
+#undef VEC_FROM_BITS
+#undef BITS_SET1
+#undef BITS_AND
+#undef BITS_ANDNOT
+#undef BITS_OR
+#undef BITS_XOR
+#undef BITS_ADD
+#undef BITS_SUB
+#undef BITS_SLLI
+#undef BITS_SRLI
+
+/*!
+ * AVX-512, eight lanes. Comparisons produce a mask register instead of a vector.
+ */
+#define VEC __m512d
+#define VEC_BITS __m512i
+#define VEC_WIDTH 8
+#define VEC_SUFFIX AVX512
+#define VEC_TARGET TARGET_AVX512
+#define VEC_SINCOS_LIMIT 1.0e9
+#define VEC_SET1 _mm512_set1_pd
+#define VEC_LOADU _mm512_loadu_pd
+#define VEC_STOREU _mm512_storeu_pd
+#ifdef SINGLE_PRECISION
+#define VEC_LOAD_REAL(p) _mm512_cvtps_pd(_mm256_loadu_ps(p))
+#else
+#define VEC_LOAD_REAL _mm512_loadu_pd
+#endif
+#define VEC_ADD _mm512_add_pd
+#define VEC_SUB _mm512_sub_pd
+#define VEC_MUL _mm512_mul_pd
+#define VEC_DIV _mm512_div_pd
+#define VEC_SQRT _mm512_sqrt_pd
+#define VEC_MIN _mm512_min_pd
+#define VEC_MAX _mm512_max_pd
+#define VEC_FMA _mm512_fmadd_pd
+#define VEC_FNMA _mm512_fnmadd_pd
+#define VEC_ABS(a) _mm512_andnot_pd(_mm512_set1_pd(-0.0), a)
+#define VEC_SELECT_LT(a, b, x, y) _mm512_mask_blend_pd(_mm512_cmp_pd_mask(a, b, _CMP_LT_OQ), y, x)
+#define VEC_ANY_GT(a, b) _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ)
+#define VEC_TO_BITS _mm512_castpd_si512
+#define VEC_FROM_BITS _mm512_castsi512_pd
+#define BITS_SET1 _mm512_set1_epi64
+#define BITS_AND _mm512_and_si512
+#define BITS_ANDNOT _mm512_andnot_si512
+#define BITS_OR _mm512_or_si512
+#define BITS_XOR _mm512_xor_si512
+#define BITS_ADD _mm512_add_epi64
+#define BITS_SUB _mm512_sub_epi64
+#define BITS_SLLI _mm512_slli_epi64
+#define BITS_SRLI _mm512_srli_epi64
+#include "SimdKernels.h"
+#endif
+
+const void* equationFixedKernel(int level, int equation, int slot){
+#ifdef SIMD_X86
+    if(level >= SimdAVX512)
+        return fixedKernelsAVX512[equation][slot];
+    if(level >= SimdAVX2)
+        return fixedKernelsAVX2[equation][slot];
+    if(level >= SimdSSE2)
+        return fixedKernelsSSE2[equation][slot];
+#endif
+    return NULL;
+}
+
+const void* equationFixedBatchKernel(int level, int equation, int slot){
+#ifdef SIMD_X86
+    if(level >= SimdAVX512)
+        return fixedBatchesAVX512[equation][slot];
+    if(level >= SimdAVX2)
+        return fixedBatchesAVX2[equation][slot];
+    if(level >= SimdSSE2)
+        return fixedBatchesSSE2[equation][slot];
+#endif
+    return NULL;
+}
+
+const void* equationKernel(int level, int equation){
+#ifdef SIMD_X86
+    if(level >= SimdAVX512)
+        return equationKernelsAVX512[equation];
+    if(level >= SimdAVX2)
+        return equationKernelsAVX2[equation];
+    if(level >= SimdSSE2)
+        return equationKernelsSSE2[equation];
+#endif
+    return NULL;
+}
+
+const void* equationBatchKernel(int level, int equation){
+#ifdef SIMD_X86
+    if(level >= SimdAVX512)
+        return equationBatchesAVX512[equation];
+    if(level >= SimdAVX2)
+        return equationBatchesAVX2[equation];
+    if(level >= SimdSSE2)
+        return equationBatchesSSE2[equation];
+#endif
+    return NULL;
+}
+
+const void* equationPartKernel(int level, int equation){
+#ifdef SIMD_X86
+    if(level >= SimdAVX512)
+        return equationPartsAVX512[equation];
+    if(level >= SimdAVX2)
+        return equationPartsAVX2[equation];
+    if(level >= SimdSSE2)
+        return equationPartsSSE2[equation];
+#endif
+    return NULL;
+}
+
+const void* formulaKernel(int level){
+#ifdef SIMD_X86
+    if(level >= SimdAVX512)
+        return &runFormulaAVX512;
+    if(level >= SimdAVX2)
+        return &runFormulaAVX2;
+    if(level >= SimdSSE2)
+        return &runFormulaSSE2;
+#endif
+    return NULL;
+}
+
+const void* rotationKernel(int level){
+#ifdef SIMD_X86
+    if(level >= SimdAVX512)
+        return &rotateRowsAVX512;
+    if(level >= SimdAVX2)
+        return &rotateRowsAVX2;
+    if(level >= SimdSSE2)
+        return &rotateRowsSSE2;
+#endif
+    return NULL;
+}
@@ -0,0 +1,95 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file SimdEquations.h
+ * \brief This is where the vectorized versions of the objective functions in src/Equations.h are selected.
+ *
+ *  Every objective function has an SSE2, an AVX2 and an AVX-512 kernel, written once in src/SimdKernels.h. At start up
+ *  installEquationKernels in src/Utilities.h replaces the entries of equationHostCalls in src/HostCalls.h with the
+ *  kernels of the widest instruction set the processor supports, or the one chosen with the optional 'Objective
+ *  Kernels' line, and fills equationBatchCalls with their batch kernels. The scalar functions in src/Equations.c stay
+ *  the reference the kernels are checked against.
+ *
+ *  The common sizes in FIXED_DIMENSIONS also have kernels written for exactly that many elements, with constant trip
+ *  counts and the per element constants of the indexed functions read from tables. installEquationKernels fills
+ *  equationFixedCalls and equationFixedBatchCalls with them, and they are used whenever a vector has one of those sizes.
+ */
+#ifndef TESTINGSUITE_SIMDEQUATIONS_H
+#define TESTINGSUITE_SIMDEQUATIONS_H
+
+#define FIXED_DIMENSION_COUNT 4 /*!< declare the constant for the number of sizes with fixed size kernels*/
+#define FIXED_DIMENSIONS 10, 20, 30, 50 /*!< declare the constant for the sizes with fixed size kernels, in the order of their slots*/
+
+/// \fn int fixedDimensionSlot(int dimensions)
+/// \brief Finds the slot of the fixed size kernels of a size, called for every vector evaluated.
+///
+/// \param dimensions - the number of dimensions of the vector
+/// \return the position of the size in FIXED_DIMENSIONS, or -1 if it has no fixed size kernels
+static inline int fixedDimensionSlot(int dimensions){
+    switch(dimensions){
+        case 10: return 0;
+        case 20: return 1;
+        case 30: return 2;
+        case 50: return 3;
+        default: return -1;
+    }
+}
+
+/// \fn const void* equationKernel(int level, int equation)
+/// \brief Returns the vectorized kernel of an objective function for an instruction set.
+///
+/// \param level - the SimdLevel enum value in src/CpuFeatures.h of the instruction set
+/// \param equation - the EquationPosition enum value in src/Utilities.h of the function
+/// \return a function with the signature of the functions in src/Equations.h, or NULL for the scalar level
+const void* equationKernel(int level, int equation);
+/// \fn const void* equationBatchKernel(int level, int equation)
+/// \brief Returns the batch kernel of an objective function for an instruction set, which evaluates many vectors stored
+/// one row per element, so element j of vector v is at columns[j * stride + v]. Every row must be padded like the rows
+/// of a Matrix in src/Matrix.h, as the last group of vectors is loaded whole.
+///
+/// \param level - the SimdLevel enum value in src/CpuFeatures.h of the instruction set
+/// \param equation - the EquationPosition enum value in src/Utilities.h of the function
+/// \return a function with the signature of EquationBatch in src/Utilities.h, or NULL for the scalar level
+const void* equationBatchKernel(int level, int equation);
+/// \fn const void* equationFixedKernel(int level, int equation, int slot)
+/// \brief Returns the kernel of an objective function for an instruction set written for one of the FIXED_DIMENSIONS.
+///
+/// \param level - the SimdLevel enum value in src/CpuFeatures.h of the instruction set
+/// \param equation - the EquationPosition enum value in src/Utilities.h of the function
+/// \param slot - the slot of the size returned by fixedDimensionSlot
+/// \return a function with the signature of the functions in src/Equations.h which ignores the number of dimensions it
+/// is given, or NULL for the scalar level
+const void* equationFixedKernel(int level, int equation, int slot);
+/// \fn const void* equationFixedBatchKernel(int level, int equation, int slot)
+/// \brief Returns the batch kernel of an objective function for an instruction set written for one of the
+/// FIXED_DIMENSIONS, with the same layout as equationBatchKernel.
+///
+/// \param level - the SimdLevel enum value in src/CpuFeatures.h of the instruction set
+/// \param equation - the EquationPosition enum value in src/Utilities.h of the function
+/// \param slot - the slot of the size returned by fixedDimensionSlot
+/// \return a function with the signature of EquationBatch in src/Utilities.h, or NULL for the scalar level
+const void* equationFixedBatchKernel(int level, int equation, int slot);
+/// \fn const void* equationPartKernel(int level, int equation)
+/// \brief Returns the vectorized part of an objective function whose terms use their index in the vector, or which
+/// multiplies its terms, for an instruction set.
+///
+/// \param level - the SimdLevel enum value in src/CpuFeatures.h of the instruction set
+/// \param equation - the EquationPosition enum value in src/Utilities.h of the function
+/// \return a function with the signature of EquationPart in src/Utilities.h, or NULL for the scalar level and the other
+/// functions
+const void* equationPartKernel(int level, int equation);
+/// \fn const void* formulaKernel(int level)
+/// \brief Returns the runner of the formula bytecode in src/Bytecode.h for an instruction set.
+///
+/// \param level - the SimdLevel enum value in src/CpuFeatures.h of the instruction set
+/// \return a function with the signature of FormulaRunner in src/Bytecode.h, or NULL for the scalar level
+const void* formulaKernel(int level);
+/// \fn const void* rotationKernel(int level)
+/// \brief Returns the kernel applying the rotations of the variants in src/Variants.h for an instruction set.
+///
+/// \param level - the SimdLevel enum value in src/CpuFeatures.h of the instruction set
+/// \return a function with the signature of RotationKernel in src/Rotation.h, or NULL for the scalar level
+const void* rotationKernel(int level);
+
+#endif //TESTINGSUITE_SIMDEQUATIONS_H
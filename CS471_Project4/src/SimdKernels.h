@@ -0,0 +1,1138 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file SimdKernels.h
+ * \brief This is where the vectorized objective functions are written once for every instruction set.
+ *
+ *  This file has no include guard on purpose. src/SimdEquations.c includes it once for each of SSE2, AVX2 and AVX-512
+ *  after defining the VEC_ macros for that instruction set, which compiles every kernel below for each of them with
+ *  VEC_SUFFIX appended to its name.
+ *
+ *  Every kernel computes the same terms as its scalar reference in src/Equations.c, VEC_WIDTH elements at a time. The
+ *  sine and cosine use the Cody-Waite reduction and the polynomials of fdlibm, the exponential and logarithm the
+ *  rational approximations of Cephes, all accurate to a few ulp. Lanes past the last element are filled with zeros and
+ *  given a weight of 0, so they add nothing to the sums.
+ *
+ *  Every function also has a batch kernel, which evaluates VEC_WIDTH vectors at a time with one lane per vector instead
+ *  of one lane per element. Short vectors leave most lanes of the kernels empty, while a batch fills every lane no
+ *  matter how many elements there are. Both are built from the same term function, so they only differ in the order
+ *  the terms are summed. Both add their terms in blocks carried into a compensated sum, in the way and to the bound
+ *  set out in src/Summation.h.
+ *
+ *  The runner of the objective formulas in src/Bytecode.h is compiled here as well, so the interpreted formulas use the
+ *  same vectorized functions as the kernels, along with the kernel rotating the variants of src/Variants.h.
+ */
+
+/*!
+ * Rounds every lane to the nearest integer, valid while |x| < 2^51.
+ */
+VEC_TARGET static inline VEC VEC_NAME(vecRound)(VEC x){
+    VEC magic = VEC_SET1(ROUND_MAGIC);
+    return VEC_SUB(VEC_ADD(x, magic), magic);
+}
+
+/*!
+ * Selects between two vectors bit by bit, taking a where the mask is set and b elsewhere.
+ */
+VEC_TARGET static inline VEC VEC_NAME(vecBlend)(VEC_BITS mask, VEC a, VEC b){
+    return VEC_FROM_BITS(BITS_OR(BITS_AND(mask, VEC_TO_BITS(a)), BITS_ANDNOT(mask, VEC_TO_BITS(b))));
+}
+
+/*!
+ * Calculates the sine and cosine of every lane. The argument is reduced to [-pi/4, pi/4] by the nearest multiple of
+ * pi/2 in three parts, and the quadrant picks the polynomial and sign. Arguments too large for the reduction to stay
+ * exact fall back to the C library.
+ */
+VEC_TARGET static inline void VEC_NAME(vecSinCos)(VEC x, VEC* sinOut, VEC* cosOut){
+    if(VEC_ANY_GT(VEC_ABS(x), VEC_SET1(VEC_SINCOS_LIMIT))){
+        double lanes[VEC_WIDTH], /*!< The arguments of every lane*/
+        sines[VEC_WIDTH], /*!< The sine of every lane*/
+        cosines[VEC_WIDTH]; /*!< The cosine of every lane*/
+        VEC_STOREU(lanes, x);
+        for(int k = 0; k < VEC_WIDTH; k++){
+            sines[k] = sin(lanes[k]);
+            cosines[k] = cos(lanes[k]);
+        }
+        *sinOut = VEC_LOADU(sines);
+        *cosOut = VEC_LOADU(cosines);
+        return;
+    }
+    VEC magic = VEC_SET1(ROUND_MAGIC),
+    t = VEC_ADD(VEC_MUL(x, VEC_SET1(TWO_OVER_PI)), magic), /*!< The quadrant count in the low bits of the mantissa*/
+    n = VEC_SUB(t, magic), /*!< The nearest multiple of pi/2*/
+    r = VEC_FNMA(n, VEC_SET1(PIO2_1), x); /*!< The reduced argument*/
+    r = VEC_FNMA(n, VEC_SET1(PIO2_2), r);
+    r = VEC_FNMA(n, VEC_SET1(PIO2_3), r);
+    VEC z = VEC_MUL(r, r),
+    sinPoly = VEC_FMA(z, VEC_SET1(SIN_S6), VEC_SET1(SIN_S5)),
+    cosPoly = VEC_FMA(z, VEC_SET1(COS_C6), VEC_SET1(COS_C5));
+    sinPoly = VEC_FMA(z, sinPoly, VEC_SET1(SIN_S4));
+    sinPoly = VEC_FMA(z, sinPoly, VEC_SET1(SIN_S3));
+    sinPoly = VEC_FMA(z, sinPoly, VEC_SET1(SIN_S2));
+    sinPoly = VEC_FMA(z, sinPoly, VEC_SET1(SIN_S1));
+    cosPoly = VEC_FMA(z, cosPoly, VEC_SET1(COS_C4));
+    cosPoly = VEC_FMA(z, cosPoly, VEC_SET1(COS_C3));
+    cosPoly = VEC_FMA(z, cosPoly, VEC_SET1(COS_C2));
+    cosPoly = VEC_FMA(z, cosPoly, VEC_SET1(COS_C1));
+    VEC sinR = VEC_FMA(VEC_MUL(r, z), sinPoly, r), /*!< The sine of the reduced argument*/
+    cosR = VEC_FMA(VEC_MUL(z, z), cosPoly, VEC_FNMA(VEC_SET1(0.5), z, VEC_SET1(1.0))); /*!< The cosine of the reduced argument*/
+    /*!
+     * Odd quadrants swap the sine and cosine, and the second bit of the quadrant (one further along for the cosine)
+     * flips the sign.
+     */
+    VEC_BITS quadrant = VEC_TO_BITS(t),
+    one = BITS_SET1(1),
+    two = BITS_SET1(2),
+    swap = BITS_SUB(BITS_SET1(0), BITS_AND(quadrant, one)), /*!< All bits set in the odd quadrants*/
+    sinSign = BITS_SLLI(BITS_AND(quadrant, two), 62),
+    cosSign = BITS_SLLI(BITS_AND(BITS_ADD(quadrant, one), two), 62);
+    *sinOut = VEC_FROM_BITS(BITS_XOR(VEC_TO_BITS(VEC_NAME(vecBlend)(swap, cosR, sinR)), sinSign));
+    *cosOut = VEC_FROM_BITS(BITS_XOR(VEC_TO_BITS(VEC_NAME(vecBlend)(swap, sinR, cosR)), cosSign));
+}
+
+VEC_TARGET static inline VEC VEC_NAME(vecSin)(VEC x){
+    VEC s, c;
+    VEC_NAME(vecSinCos)(x, &s, &c);
+    return s;
+}
+
+VEC_TARGET static inline VEC VEC_NAME(vecCos)(VEC x){
+    VEC s, c;
+    VEC_NAME(vecSinCos)(x, &s, &c);
+    return c;
+}
+
+/*!
+ * Calculates e^x as 2^n e^r with |r| <= ln(2)/2, using the Pade approximation of Cephes for e^r. The argument is
+ * clamped so 2^n stays a normal double.
+ */
+VEC_TARGET static inline VEC VEC_NAME(vecExp)(VEC x){
+    x = VEC_MIN(VEC_MAX(x, VEC_SET1(EXP_MIN_ARG)), VEC_SET1(EXP_MAX_ARG));
+    VEC magic = VEC_SET1(ROUND_MAGIC),
+    t = VEC_ADD(VEC_MUL(x, VEC_SET1(LOG2_E)), magic), /*!< The power of two in the low bits of the mantissa*/
+    n = VEC_SUB(t, magic),
+    r = VEC_FNMA(n, VEC_SET1(EXP_C1), x);
+    r = VEC_FNMA(n, VEC_SET1(EXP_C2), r);
+    VEC rr = VEC_MUL(r, r),
+    px = VEC_FMA(rr, VEC_SET1(EXP_P0), VEC_SET1(EXP_P1)),
+    qx = VEC_FMA(rr, VEC_SET1(EXP_Q0), VEC_SET1(EXP_Q1));
+    px = VEC_MUL(r, VEC_FMA(rr, px, VEC_SET1(EXP_P2)));
+    qx = VEC_FMA(rr, qx, VEC_SET1(EXP_Q2));
+    qx = VEC_FMA(rr, qx, VEC_SET1(EXP_Q3));
+    VEC er = VEC_FMA(VEC_SET1(2.0), VEC_DIV(px, VEC_SUB(qx, px)), VEC_SET1(1.0)); /*!< e^r*/
+    VEC_BITS pow2 = BITS_SLLI(BITS_ADD(VEC_TO_BITS(t), BITS_SET1(1023)), 52); /*!< 2^n built in the exponent field*/
+    return VEC_MUL(er, VEC_FROM_BITS(pow2));
+}
+
+/*!
+ * Calculates the natural logarithm of positive normal lanes. The mantissa is taken in [sqrt(1/2), sqrt(2)) and the
+ * rational approximation of Cephes is applied to it minus 1.
+ */
+VEC_TARGET static inline VEC VEC_NAME(vecLog)(VEC x){
+    VEC_BITS bits = VEC_TO_BITS(x);
+    VEC e = VEC_SUB(VEC_FROM_BITS(BITS_OR(BITS_SRLI(bits, 52), BITS_SET1(EXPONENT_MAGIC_BITS))), VEC_SET1(EXPONENT_MAGIC + 1022.0)), /*!< The binary exponent*/
+    m = VEC_FROM_BITS(BITS_OR(BITS_AND(bits, BITS_SET1(MANTISSA_BITS)), BITS_SET1(HALF_BITS))); /*!< The mantissa in [0.5, 1)*/
+    e = VEC_SUB(e, VEC_SELECT_LT(m, VEC_SET1(SQRT_HALF), VEC_SET1(1.0), VEC_SET1(0.0)));
+    VEC f = VEC_SELECT_LT(m, VEC_SET1(SQRT_HALF), VEC_SUB(VEC_ADD(m, m), VEC_SET1(1.0)), VEC_SUB(m, VEC_SET1(1.0))),
+    z = VEC_MUL(f, f),
+    p = VEC_FMA(f, VEC_SET1(LOG_P0), VEC_SET1(LOG_P1)),
+    q = VEC_ADD(f, VEC_SET1(LOG_Q0));
+    p = VEC_FMA(f, p, VEC_SET1(LOG_P2));
+    p = VEC_FMA(f, p, VEC_SET1(LOG_P3));
+    p = VEC_FMA(f, p, VEC_SET1(LOG_P4));
+    p = VEC_FMA(f, p, VEC_SET1(LOG_P5));
+    q = VEC_FMA(f, q, VEC_SET1(LOG_Q1));
+    q = VEC_FMA(f, q, VEC_SET1(LOG_Q2));
+    q = VEC_FMA(f, q, VEC_SET1(LOG_Q3));
+    q = VEC_FMA(f, q, VEC_SET1(LOG_Q4));
+    VEC y = VEC_MUL(f, VEC_DIV(VEC_MUL(z, p), q));
+    y = VEC_FNMA(e, VEC_SET1(LOG_E2), y);
+    y = VEC_FNMA(VEC_SET1(0.5), z, y);
+    return VEC_FMA(e, VEC_SET1(LOG_E1), VEC_ADD(f, y));
+}
+
+/*!
+ * Calculates x^0.1 for non-negative lanes, with 0 mapped to a value small enough to vanish from any term.
+ */
+VEC_TARGET static inline VEC VEC_NAME(vecTenthRoot)(VEC x){
+    return VEC_NAME(vecExp)(VEC_MUL(VEC_SET1(0.1), VEC_NAME(vecLog)(VEC_MAX(x, VEC_SET1(DBL_MIN)))));
+}
+
+/*!
+ * Loads VEC_WIDTH elements starting at j, with the weight of every lane set to 1 if it is one of the count elements
+ * and 0 otherwise.
+ */
+VEC_TARGET static inline VEC VEC_NAME(loadElements)(const Real* vector, int j, int count, VEC* weight){
+    if(j + VEC_WIDTH <= count){
+        *weight = VEC_SET1(1.0);
+        return VEC_LOAD_REAL(vector + j);
+    }
+    double values[VEC_WIDTH] = {0}, /*!< The remaining elements padded with zeros*/
+    weights[VEC_WIDTH] = {0}; /*!< 1 for the remaining elements*/
+    for(int k = 0; j + k < count; k++){
+        values[k] = vector[j + k];
+        weights[k] = 1.0;
+    }
+    *weight = VEC_LOADU(weights);
+    return VEC_LOADU(values);
+}
+
+/*!
+ * Loads the elements starting at j and the elements following them, for the functions summed over neighbouring
+ * pairs, with the weight of every lane set to 1 if it is one of the count pairs and 0 otherwise.
+ */
+VEC_TARGET static inline VEC VEC_NAME(loadPairs)(const Real* vector, int j, int count, VEC* next, VEC* weight){
+    if(j + VEC_WIDTH <= count){
+        *weight = VEC_SET1(1.0);
+        *next = VEC_LOAD_REAL(vector + j + 1);
+        return VEC_LOAD_REAL(vector + j);
+    }
+    double values[VEC_WIDTH] = {0}, /*!< The remaining elements padded with zeros*/
+    nextValues[VEC_WIDTH] = {0}, /*!< The elements following them padded with zeros*/
+    weights[VEC_WIDTH] = {0}; /*!< 1 for the remaining pairs*/
+    for(int k = 0; j + k < count; k++){
+        values[k] = vector[j + k];
+        nextValues[k] = vector[j + k + 1];
+        weights[k] = 1.0;
+    }
+    *weight = VEC_LOADU(weights);
+    *next = VEC_LOADU(nextValues);
+    return VEC_LOADU(values);
+}
+
+/*!
+ * Returns the position plus one of every lane starting at j, the weight the indexed functions use.
+ */
+VEC_TARGET static inline VEC VEC_NAME(laneIndices)(int j){
+    return VEC_ADD(VEC_LOADU(laneOffsets), VEC_SET1((double)j));
+}
+
+VEC_TARGET static inline double VEC_NAME(sumLanes)(VEC v){
+    double lanes[VEC_WIDTH]; /*!< The partial sum of every lane*/
+    double sum = 0.0;
+    VEC_STOREU(lanes, v);
+    for(int k = 0; k < VEC_WIDTH; k++)
+        sum += lanes[k];
+    return sum;
+}
+
+/*!
+ * Carries a block of plain sums into the sum and error of every lane. The error free addition of Knuth recovers the
+ * rounding error of sum + block exactly whichever of the two is larger, so it needs no comparison.
+ */
+VEC_TARGET static inline void VEC_NAME(carryBlock)(VEC* sum, VEC* error, VEC block){
+    VEC total = VEC_ADD(*sum, block),
+    blockPart = VEC_SUB(total, *sum), /*!< The part of block the rounded total holds*/
+    lost = VEC_ADD(VEC_SUB(*sum, VEC_SUB(total, blockPart)), VEC_SUB(block, blockPart)); /*!< The rounding error of the total*/
+    *error = VEC_ADD(*error, lost);
+    *sum = total;
+}
+
+/*!
+ * Adds the compensated sums of every lane together with addCompensated of src/Summation.h.
+ */
+VEC_TARGET static inline double VEC_NAME(sumLanesCompensated)(VEC sum, VEC error){
+    double lanes[VEC_WIDTH], /*!< The sum of every lane*/
+    errors[VEC_WIDTH]; /*!< The error of every lane*/
+    CompensatedSum total = {0.0, 0.0}; /*!< The sum of the lanes*/
+    VEC_STOREU(lanes, sum);
+    VEC_STOREU(errors, error);
+    for(int k = 0; k < VEC_WIDTH; k++){
+        addCompensated(&total, lanes[k]);
+        total.error += errors[k];
+    }
+    return compensatedTotal(&total);
+}
+
+/*!
+ * Adds the error of every lane back to its sum, keeping the sums which are infinite or NaN, whose errors are NaN.
+ */
+VEC_TARGET static inline VEC VEC_NAME(compensatedLanes)(VEC sum, VEC error){
+    return VEC_SELECT_LT(VEC_ABS(sum), VEC_SET1(INFINITY), VEC_ADD(sum, error), sum);
+}
+
+/*!
+ * Stores the lanes of v to the count values starting at out, or all of them if there are more than VEC_WIDTH.
+ */
+VEC_TARGET static inline void VEC_NAME(storeLanes)(double* out, int count, VEC v){
+    if(count >= VEC_WIDTH){
+        VEC_STOREU(out, v);
+        return;
+    }
+    double lanes[VEC_WIDTH]; /*!< Every lane, of which only the first count are kept*/
+    VEC_STOREU(lanes, v);
+    for(int k = 0; k < count; k++)
+        out[k] = lanes[k];
+}
+
+/*!
+ * The term every function sums, calculated from one element x, the element y following it for the functions summed
+ * over neighbouring pairs, and the position plus one of the element for the indexed functions. Each term is shared by
+ * the kernel of its function and its batch kernel.
+ */
+typedef VEC (*VEC_NAME(TermFunction))(VEC x, VEC y, VEC index);
+
+/*!
+ * Sums a term over the elements begin up to end of a whole vector VEC_WIDTH elements at a time, with the index of every
+ * element in the whole vector, adding SUMMATION_BLOCK_TERMS terms in every lane before carrying them into its sum.
+ */
+VEC_TARGET static ALWAYS_INLINE double VEC_NAME(sumElementsPart)(const Real* vector, int begin, int end, VEC_NAME(TermFunction) term){
+    VEC sum = VEC_SET1(0.0), error = VEC_SET1(0.0), weight;
+    for(int first = begin; first < end; first += SUMMATION_BLOCK_TERMS * VEC_WIDTH){
+        int last = end - first < SUMMATION_BLOCK_TERMS * VEC_WIDTH ? end : first + SUMMATION_BLOCK_TERMS * VEC_WIDTH; /*!< The element after the block*/
+        VEC block = VEC_SET1(0.0);
+        for(int j = first; j < last; j += VEC_WIDTH){
+            VEC x = VEC_NAME(loadElements)(vector, j, end, &weight);
+            block = VEC_FMA(weight, term(x, x, VEC_NAME(laneIndices)(j)), block);
+        }
+        VEC_NAME(carryBlock)(&sum, &error, block);
+    }
+    return VEC_NAME(sumLanesCompensated)(sum, error);
+}
+
+/*!
+ * Sums a term over the elements of one vector, the way every kernel runs.
+ */
+VEC_TARGET static ALWAYS_INLINE double VEC_NAME(sumElements)(const Real* vector, int numDim, VEC_NAME(TermFunction) term){
+    return VEC_NAME(sumElementsPart)(vector, 0, numDim, term);
+}
+
+/*!
+ * Sums a term over the neighbouring pairs of one vector VEC_WIDTH pairs at a time, in blocks like sumElementsPart.
+ */
+VEC_TARGET static ALWAYS_INLINE double VEC_NAME(sumPairs)(const Real* vector, int numDim, VEC_NAME(TermFunction) term){
+    VEC sum = VEC_SET1(0.0), error = VEC_SET1(0.0), y, weight;
+    for(int first = 0; first < numDim - 1; first += SUMMATION_BLOCK_TERMS * VEC_WIDTH){
+        int last = numDim - 1 - first < SUMMATION_BLOCK_TERMS * VEC_WIDTH ? numDim - 1 : first + SUMMATION_BLOCK_TERMS * VEC_WIDTH; /*!< The pair after the block*/
+        VEC block = VEC_SET1(0.0);
+        for(int j = first; j < last; j += VEC_WIDTH){
+            VEC x = VEC_NAME(loadPairs)(vector, j, numDim - 1, &y, &weight);
+            block = VEC_FMA(weight, term(x, y, VEC_NAME(laneIndices)(j)), block);
+        }
+        VEC_NAME(carryBlock)(&sum, &error, block);
+    }
+    return VEC_NAME(sumLanesCompensated)(sum, error);
+}
+
+/*!
+ * Sums a term over the elements of VEC_WIDTH vectors at a time, the way every batch kernel runs. Element j of vector v
+ * is at columns[j * stride + v], and every row is padded like the rows of a Matrix so the last group of vectors can be
+ * loaded whole. The lanes past count hold whatever the padding holds and are never stored.
+ */
+VEC_TARGET static ALWAYS_INLINE void VEC_NAME(batchElements)(const Real* columns, int stride, int count, int numDim, VEC_NAME(TermFunction) term, double* fitness){
+    for(int v = 0; v < count; v += VEC_WIDTH){
+        VEC sum = VEC_SET1(0.0), error = VEC_SET1(0.0);
+        for(int first = 0; first < numDim; first += SUMMATION_BLOCK_TERMS){
+            int last = numDim - first < SUMMATION_BLOCK_TERMS ? numDim : first + SUMMATION_BLOCK_TERMS; /*!< The element after the block*/
+            VEC block = VEC_SET1(0.0);
+            for(int j = first; j < last; j++){
+                VEC x = VEC_LOAD_REAL(columns + (size_t)j * stride + v);
+                block = VEC_ADD(block, term(x, x, VEC_SET1(j + 1.0)));
+            }
+            VEC_NAME(carryBlock)(&sum, &error, block);
+        }
+        VEC_NAME(storeLanes)(fitness + v, count - v, VEC_NAME(compensatedLanes)(sum, error));
+    }
+}
+
+/*!
+ * Sums a term over the neighbouring pairs of VEC_WIDTH vectors at a time, reusing every row as the next pair's first.
+ */
+VEC_TARGET static ALWAYS_INLINE void VEC_NAME(batchPairs)(const Real* columns, int stride, int count, int numDim, VEC_NAME(TermFunction) term, double* fitness){
+    for(int v = 0; v < count; v += VEC_WIDTH){
+        VEC sum = VEC_SET1(0.0), error = VEC_SET1(0.0),
+        x = VEC_LOAD_REAL(columns + v);
+        for(int first = 0; first < numDim - 1; first += SUMMATION_BLOCK_TERMS){
+            int last = numDim - 1 - first < SUMMATION_BLOCK_TERMS ? numDim - 1 : first + SUMMATION_BLOCK_TERMS; /*!< The pair after the block*/
+            VEC block = VEC_SET1(0.0);
+            for(int j = first; j < last; j++){
+                VEC y = VEC_LOAD_REAL(columns + (size_t)(j + 1) * stride + v);
+                block = VEC_ADD(block, term(x, y, VEC_SET1(j + 1.0)));
+                x = y;
+            }
+            VEC_NAME(carryBlock)(&sum, &error, block);
+        }
+        VEC_NAME(storeLanes)(fitness + v, count - v, VEC_NAME(compensatedLanes)(sum, error));
+    }
+}
+
+/*!
+ * Defines the kernel and the batch kernel of a function from its term, the driver summing it and the function applied
+ * to the sum of every vector.
+ */
+#define VEC_KERNELS(name, driver, finish) \
+VEC_TARGET static double VEC_NAME(name##Kernel)(const Real* vector, int numDim){ \
+    return VEC_NAME(finish)(VEC_NAME(sum##driver)(vector, numDim, VEC_NAME(name##Term)), numDim); \
+} \
+VEC_TARGET static void VEC_NAME(name##Batch)(const Real* columns, int stride, int count, int numDim, double* fitness){ \
+    VEC_NAME(batch##driver)(columns, stride, count, numDim, VEC_NAME(name##Term), fitness); \
+    for(int v = 0; v < count; v++) \
+        fitness[v] = VEC_NAME(finish)(fitness[v], numDim); \
+}
+
+static inline double VEC_NAME(plainFinish)(double sum, int numDim){
+    (void)numDim;
+    return sum;
+}
+
+static inline double VEC_NAME(negatedFinish)(double sum, int numDim){
+    (void)numDim;
+    return -1.0 * sum;
+}
+
+static inline double VEC_NAME(schwefelFinish)(double sum, int numDim){
+    return 418.9829 * numDim - sum;
+}
+
+static inline double VEC_NAME(rastgrinFinish)(double sum, int numDim){
+    return 10.0 * numDim * sum;
+}
+
+VEC_TARGET static inline VEC VEC_NAME(schwefelTerm)(VEC x, VEC y, VEC index){
+    (void)y; (void)index;
+    return VEC_MUL(VEC_SUB(VEC_SET1(0.0), x), VEC_NAME(vecSin)(VEC_SQRT(VEC_ABS(x))));
+}
+
+VEC_TARGET static inline VEC VEC_NAME(deJongTerm)(VEC x, VEC y, VEC index){
+    (void)y; (void)index;
+    return VEC_MUL(x, x);
+}
+
+VEC_TARGET static inline VEC VEC_NAME(rosenbrockTerm)(VEC x, VEC y, VEC index){
+    (void)index;
+    VEC a = VEC_SUB(VEC_MUL(x, x), y), b = VEC_SUB(VEC_SET1(1.0), x);
+    return VEC_FMA(VEC_SET1(100.0), VEC_MUL(a, a), VEC_MUL(b, b));
+}
+
+VEC_TARGET static inline VEC VEC_NAME(rastgrinTerm)(VEC x, VEC y, VEC index){
+    (void)y; (void)index;
+    return VEC_FNMA(VEC_SET1(10.0), VEC_NAME(vecCos)(VEC_MUL(VEC_SET1(2.0 * M_PI), x)), VEC_MUL(x, x));
+}
+
+VEC_TARGET static inline VEC VEC_NAME(sineEnvSineWaveTerm)(VEC x, VEC y, VEC index){
+    (void)index;
+    VEC s = VEC_FMA(x, x, VEC_MUL(y, y)),
+    a = VEC_SUB(s, VEC_SET1(0.5)),
+    b = VEC_FMA(VEC_SET1(0.001), s, VEC_SET1(1.0));
+    return VEC_ADD(VEC_SET1(0.5), VEC_DIV(VEC_NAME(vecSin)(VEC_MUL(a, a)), VEC_MUL(b, b)));
+}
+
+VEC_TARGET static inline VEC VEC_NAME(stretchVSineWaveTerm)(VEC x, VEC y, VEC index){
+    (void)index;
+    VEC s = VEC_FMA(x, x, VEC_MUL(y, y)),
+    a = VEC_MUL(VEC_SET1(50.0), VEC_NAME(vecTenthRoot)(s));
+    return VEC_FMA(VEC_SQRT(VEC_SQRT(s)), VEC_NAME(vecSin)(VEC_MUL(a, a)), VEC_SET1(1.0));
+}
+
+VEC_TARGET static inline VEC VEC_NAME(ackleyOneTerm)(VEC x, VEC y, VEC index){
+    (void)index;
+    VEC s = VEC_FMA(x, x, VEC_MUL(y, y)),
+    waves = VEC_ADD(VEC_NAME(vecCos)(VEC_ADD(x, x)), VEC_NAME(vecSin)(VEC_ADD(y, y)));
+    return VEC_FMA(VEC_SET1(ACKLEY_ONE_CONST), VEC_SQRT(s), VEC_MUL(VEC_SET1(3.0), waves));
+}
+
+VEC_TARGET static inline VEC VEC_NAME(ackleyTwoTerm)(VEC x, VEC y, VEC index){
+    (void)index;
+    VEC s = VEC_FMA(x, x, VEC_MUL(y, y)),
+    decay = VEC_NAME(vecExp)(VEC_MUL(VEC_SET1(0.2), VEC_SQRT(VEC_MUL(s, VEC_SET1(0.5))))),
+    waves = VEC_ADD(VEC_NAME(vecCos)(VEC_MUL(VEC_SET1(2.0 * M_PI), x)), VEC_NAME(vecCos)(VEC_MUL(VEC_SET1(2.0 * M_PI), y)));
+    return VEC_SUB(VEC_SUB(VEC_SET1(ACKLEY_TWO_CONST), VEC_DIV(VEC_SET1(20.0), decay)), VEC_NAME(vecExp)(VEC_MUL(VEC_SET1(0.5), waves)));
+}
+
+VEC_TARGET static inline VEC VEC_NAME(eggHolderTerm)(VEC x, VEC y, VEC index){
+    (void)index;
+    VEC shifted = VEC_ADD(y, VEC_SET1(47.0)),
+    a = VEC_NAME(vecSin)(VEC_SQRT(VEC_ABS(VEC_SUB(VEC_SUB(x, y), VEC_SET1(47.0))))),
+    b = VEC_NAME(vecSin)(VEC_SQRT(VEC_ABS(VEC_FMA(x, VEC_SET1(0.5), shifted))));
+    return VEC_SUB(VEC_MUL(VEC_SUB(VEC_SET1(0.0), x), a), VEC_MUL(shifted, b));
+}
+
+VEC_TARGET static inline VEC VEC_NAME(ranaTerm)(VEC x, VEC y, VEC index){
+    (void)index;
+    VEC sinA, cosA, sinB, cosB;
+    VEC_NAME(vecSinCos)(VEC_SQRT(VEC_ABS(VEC_ADD(VEC_SUB(y, x), VEC_SET1(1.0)))), &sinA, &cosA);
+    VEC_NAME(vecSinCos)(VEC_SQRT(VEC_ABS(VEC_ADD(VEC_ADD(y, x), VEC_SET1(1.0)))), &sinB, &cosB);
+    return VEC_FMA(VEC_MUL(x, sinA), cosB, VEC_MUL(VEC_MUL(VEC_ADD(y, VEC_SET1(1.0)), cosA), sinB));
+}
+
+VEC_TARGET static inline VEC VEC_NAME(pathologicalTerm)(VEC x, VEC y, VEC index){
+    (void)index;
+    VEC root = VEC_SQRT(VEC_FMA(VEC_SET1(100.0), VEC_MUL(x, x), VEC_MUL(y, y))),
+    spread = VEC_ADD(VEC_FNMA(VEC_ADD(x, x), y, VEC_MUL(x, x)), VEC_MUL(y, y)),
+    denominator = VEC_FMA(VEC_SET1(0.001), VEC_MUL(spread, spread), VEC_SET1(1.0));
+    return VEC_ADD(VEC_SET1(0.5), VEC_DIV(VEC_SUB(VEC_NAME(vecSin)(VEC_MUL(root, root)), VEC_SET1(0.5)), denominator));
+}
+
+/*!
+ * The term of Michalewicz given the angle (j + 1) x^2 / pi of its second sine.
+ */
+VEC_TARGET static inline VEC VEC_NAME(michalewiczWave)(VEC x, VEC angle){
+    VEC s = VEC_NAME(vecSin)(angle),
+    s2 = VEC_MUL(s, s),
+    s4 = VEC_MUL(s2, s2),
+    s16 = VEC_MUL(VEC_MUL(s4, s4), VEC_MUL(s4, s4));
+    return VEC_MUL(VEC_NAME(vecSin)(x), VEC_MUL(s16, s4)); ///the 20th power by squaring
+}
+
+VEC_TARGET static inline VEC VEC_NAME(michalewiczTerm)(VEC x, VEC y, VEC index){
+    (void)y;
+    return VEC_NAME(michalewiczWave)(x, VEC_DIV(VEC_MUL(index, VEC_MUL(x, x)), VEC_SET1(M_PI)));
+}
+
+/*!
+ * The term of Michalewicz for the fixed size kernels, which are given (j + 1)/pi from a table instead of the index.
+ */
+VEC_TARGET static inline VEC VEC_NAME(michalewiczFixedTerm)(VEC x, VEC y, VEC scale){
+    (void)y;
+    return VEC_NAME(michalewiczWave)(x, VEC_MUL(scale, VEC_MUL(x, x)));
+}
+
+VEC_TARGET static inline VEC VEC_NAME(mastersCosineWaveTerm)(VEC x, VEC y, VEC index){
+    (void)index;
+    VEC t = VEC_FMA(VEC_MUL(VEC_SET1(0.5), y), x, VEC_FMA(x, x, VEC_MUL(y, y)));
+    return VEC_MUL(VEC_NAME(vecExp)(VEC_MUL(VEC_SET1(-1.0 / 8.0), t)), VEC_NAME(vecCos)(VEC_SQRT(VEC_SQRT(t))));
+}
+
+VEC_TARGET static inline VEC VEC_NAME(quarticTerm)(VEC x, VEC y, VEC index){
+    (void)y;
+    VEC x2 = VEC_MUL(x, x);
+    return VEC_MUL(index, VEC_MUL(x2, x2));
+}
+
+VEC_TARGET static inline VEC VEC_NAME(stepTerm)(VEC x, VEC y, VEC index){
+    (void)y; (void)index;
+    VEC a = VEC_ADD(VEC_ABS(x), VEC_SET1(0.5));
+    return VEC_MUL(a, a);
+}
+
+VEC_TARGET static inline VEC VEC_NAME(alpineTerm)(VEC x, VEC y, VEC index){
+    (void)y; (void)index;
+    return VEC_ABS(VEC_FMA(x, VEC_NAME(vecSin)(x), VEC_MUL(VEC_SET1(0.1), x)));
+}
+
+VEC_KERNELS(schwefel, Elements, schwefelFinish)
+VEC_KERNELS(deJong, Elements, plainFinish)
+VEC_KERNELS(rosenbrock, Pairs, plainFinish)
+VEC_KERNELS(rastgrin, Elements, rastgrinFinish)
+VEC_KERNELS(sineEnvSineWave, Pairs, negatedFinish)
+VEC_KERNELS(stretchVSineWave, Pairs, plainFinish)
+VEC_KERNELS(ackleyOne, Pairs, plainFinish)
+VEC_KERNELS(ackleyTwo, Pairs, plainFinish)
+VEC_KERNELS(eggHolder, Pairs, plainFinish)
+VEC_KERNELS(rana, Pairs, plainFinish)
+VEC_KERNELS(pathological, Pairs, plainFinish)
+VEC_KERNELS(michalewicz, Elements, negatedFinish)
+VEC_KERNELS(mastersCosineWave, Pairs, negatedFinish)
+VEC_KERNELS(quartic, Elements, plainFinish)
+VEC_KERNELS(step, Elements, plainFinish)
+VEC_KERNELS(alpine, Elements, plainFinish)
+
+#undef VEC_KERNELS
+
+/*!
+ * Griewangk multiplies as well as sums, so its kernels are written out, the kernel being its part over the whole
+ * vector. Padding lanes multiply by exactly 1.
+ */
+VEC_TARGET static double VEC_NAME(griewangkPart)(const Real* vector, int numDim, int begin, int end, double* product){
+    (void)numDim;
+    VEC sum = VEC_SET1(0.0), error = VEC_SET1(0.0), lanesProduct = VEC_SET1(1.0), weight;
+    double lanes[VEC_WIDTH]; /*!< The partial product of every lane*/
+    for(int first = begin; first < end; first += SUMMATION_BLOCK_TERMS * VEC_WIDTH){
+        int last = end - first < SUMMATION_BLOCK_TERMS * VEC_WIDTH ? end : first + SUMMATION_BLOCK_TERMS * VEC_WIDTH; /*!< The element after the block*/
+        VEC block = VEC_SET1(0.0);
+        for(int j = first; j < last; j += VEC_WIDTH){
+            VEC x = VEC_NAME(loadElements)(vector, j, end, &weight);
+            block = VEC_FMA(weight, VEC_DIV(VEC_MUL(x, x), VEC_SET1(4000.0)), block);
+            VEC factor = VEC_NAME(vecCos)(VEC_DIV(x, VEC_SQRT(VEC_NAME(laneIndices)(j))));
+            lanesProduct = VEC_MUL(lanesProduct, VEC_SELECT_LT(weight, VEC_SET1(0.5), VEC_SET1(1.0), factor));
+        }
+        VEC_NAME(carryBlock)(&sum, &error, block);
+    }
+    VEC_STOREU(lanes, lanesProduct);
+    for(int k = 0; k < VEC_WIDTH; k++)
+        *product *= lanes[k];
+    return (begin == 0 ? 1.0 : 0.0) + VEC_NAME(sumLanesCompensated)(sum, error);
+}
+
+VEC_TARGET static double VEC_NAME(griewangkKernel)(const Real* vector, int numDim){
+    double multValue = 1.0; /*!< The product of the vector*/
+    double addValue = VEC_NAME(griewangkPart)(vector, numDim, 0, numDim, &multValue); /*!< 1 plus the sum of the vector*/
+    return addValue - multValue;
+}
+
+VEC_TARGET static void VEC_NAME(griewangkBatch)(const Real* columns, int stride, int count, int numDim, double* fitness){
+    for(int v = 0; v < count; v += VEC_WIDTH){
+        VEC sum = VEC_SET1(0.0), error = VEC_SET1(0.0), product = VEC_SET1(1.0);
+        for(int first = 0; first < numDim; first += SUMMATION_BLOCK_TERMS){
+            int last = numDim - first < SUMMATION_BLOCK_TERMS ? numDim : first + SUMMATION_BLOCK_TERMS; /*!< The element after the block*/
+            VEC block = VEC_SET1(0.0);
+            for(int j = first; j < last; j++){
+                VEC x = VEC_LOAD_REAL(columns + (size_t)j * stride + v);
+                block = VEC_ADD(block, VEC_DIV(VEC_MUL(x, x), VEC_SET1(4000.0)));
+                product = VEC_MUL(product, VEC_NAME(vecCos)(VEC_DIV(x, VEC_SQRT(VEC_SET1(j + 1.0)))));
+            }
+            VEC_NAME(carryBlock)(&sum, &error, block);
+        }
+        VEC_NAME(storeLanes)(fitness + v, count - v, VEC_SUB(VEC_ADD(VEC_SET1(1.0), VEC_NAME(compensatedLanes)(sum, error)), product));
+    }
+}
+
+/*!
+ * Levy adds a term of the last element to every element's term and a term of the first element to the sum, so its
+ * kernels are written out around the shared term.
+ */
+VEC_TARGET static inline VEC VEC_NAME(levyTerm)(VEC x, VEC lastTerm){
+    VEC wi = VEC_FMA(VEC_SUB(x, VEC_SET1(1.0)), VEC_SET1(0.25), VEC_SET1(1.0)),
+    a = VEC_SUB(wi, VEC_SET1(1.0)),
+    s = VEC_NAME(vecSin)(VEC_FMA(VEC_SET1(M_PI), wi, VEC_SET1(1.0)));
+    return VEC_FMA(VEC_MUL(a, a), VEC_FMA(VEC_SET1(10.0), VEC_MUL(s, s), VEC_SET1(1.0)), lastTerm);
+}
+
+VEC_TARGET static double VEC_NAME(levyPart)(const Real* vector, int numDim, int begin, int end, double* product){
+    (void)product;
+    VEC sum = VEC_SET1(0.0), error = VEC_SET1(0.0), weight;
+    double levyLastConst = 1.0 + ((vector[numDim - 1] - 1.0) / 4.0), /*!< Wn of the vector*/
+    lastSine = sin(2.0 * M_PI * levyLastConst),
+    lastTerm = (levyLastConst - 1.0) * (levyLastConst - 1.0) * (1.0 + lastSine * lastSine), /*!< The Wn term added with every element*/
+    firstSine = begin == 0 ? sin(M_PI * (1.0 + ((vector[0] - 1.0) / 4.0))) : 0.0; /*!< The sine of W0, only added to the first part*/
+    for(int first = begin; first < end; first += SUMMATION_BLOCK_TERMS * VEC_WIDTH){
+        int last = end - first < SUMMATION_BLOCK_TERMS * VEC_WIDTH ? end : first + SUMMATION_BLOCK_TERMS * VEC_WIDTH; /*!< The element after the block*/
+        VEC block = VEC_SET1(0.0);
+        for(int j = first; j < last; j += VEC_WIDTH){
+            VEC x = VEC_NAME(loadElements)(vector, j, end, &weight);
+            block = VEC_FMA(weight, VEC_NAME(levyTerm)(x, VEC_SET1(lastTerm)), block);
+        }
+        VEC_NAME(carryBlock)(&sum, &error, block);
+    }
+    return firstSine * firstSine + VEC_NAME(sumLanesCompensated)(sum, error);
+}
+
+VEC_TARGET static double VEC_NAME(levyKernel)(const Real* vector, int numDim){
+    return VEC_NAME(levyPart)(vector, numDim, 0, numDim - 1, NULL); ///every element but the last
+}
+
+VEC_TARGET static void VEC_NAME(levyBatch)(const Real* columns, int stride, int count, int numDim, double* fitness){
+    for(int v = 0; v < count; v += VEC_WIDTH){
+        VEC first = VEC_FMA(VEC_SUB(VEC_LOAD_REAL(columns + v), VEC_SET1(1.0)), VEC_SET1(0.25), VEC_SET1(1.0)), /*!< W0 of every vector*/
+        last = VEC_FMA(VEC_SUB(VEC_LOAD_REAL(columns + (size_t)(numDim - 1) * stride + v), VEC_SET1(1.0)), VEC_SET1(0.25), VEC_SET1(1.0)), /*!< Wn of every vector*/
+        lastSine = VEC_NAME(vecSin)(VEC_MUL(VEC_SET1(2.0 * M_PI), last)),
+        firstSine = VEC_NAME(vecSin)(VEC_MUL(VEC_SET1(M_PI), first)),
+        lastOffset = VEC_SUB(last, VEC_SET1(1.0)),
+        lastTerm = VEC_MUL(VEC_MUL(lastOffset, lastOffset), VEC_FMA(lastSine, lastSine, VEC_SET1(1.0))), /*!< The Wn term of every vector*/
+        sum = VEC_SET1(0.0), error = VEC_SET1(0.0);
+        for(int first = 0; first < numDim - 1; first += SUMMATION_BLOCK_TERMS){
+            int last = numDim - 1 - first < SUMMATION_BLOCK_TERMS ? numDim - 1 : first + SUMMATION_BLOCK_TERMS; /*!< The element after the block*/
+            VEC block = VEC_SET1(0.0);
+            for(int j = first; j < last; j++)
+                block = VEC_ADD(block, VEC_NAME(levyTerm)(VEC_LOAD_REAL(columns + (size_t)j * stride + v), lastTerm));
+            VEC_NAME(carryBlock)(&sum, &error, block);
+        }
+        VEC_NAME(storeLanes)(fitness + v, count - v, VEC_FMA(firstSine, firstSine, VEC_NAME(compensatedLanes)(sum, error)));
+    }
+}
+
+/*!
+ * The parts of the functions whose terms use their index, with the signature of EquationPart in src/Utilities.h, along
+ * with griewangkPart and levyPart above. They compute the same terms as the kernels above over a part of a whole vector.
+ */
+VEC_TARGET static double VEC_NAME(michalewiczPart)(const Real* vector, int numDim, int begin, int end, double* product){
+    (void)numDim; (void)product;
+    return -1.0 * VEC_NAME(sumElementsPart)(vector, begin, end, VEC_NAME(michalewiczTerm));
+}
+
+VEC_TARGET static double VEC_NAME(quarticPart)(const Real* vector, int numDim, int begin, int end, double* product){
+    (void)numDim; (void)product;
+    return VEC_NAME(sumElementsPart)(vector, begin, end, VEC_NAME(quarticTerm));
+}
+
+/*!
+ * The fixed size drivers below are the drivers above with the number of elements a constant. Every fixed size kernel
+ * inlines them, so the loops have constant trip counts, the whole vectors of a single vector are unrolled completely
+ * without any check for the end, and the partial vector after them is only loaded for the sizes which have one. The indexed functions read their per element constants
+ * from the tables in src/SimdEquations.c instead of calculating them. No lane holds more than SUMMATION_BLOCK_TERMS
+ * terms at these sizes, so every lane is a single block added plainly.
+ */
+VEC_TARGET static ALWAYS_INLINE double VEC_NAME(sumElementsFixed)(const Real* vector, const int numDim, VEC_NAME(TermFunction) term, const double* table){
+    VEC sum = VEC_SET1(0.0), weight;
+    int whole = numDim - numDim % VEC_WIDTH; /*!< The elements filling whole vectors*/
+#pragma GCC unroll 32
+    for(int j = 0; j < whole; j += VEC_WIDTH){
+        VEC x = VEC_LOAD_REAL(vector + j);
+        sum = VEC_ADD(term(x, x, VEC_LOADU(table + j)), sum);
+    }
+    if(whole < numDim){
+        VEC x = VEC_NAME(loadElements)(vector, whole, numDim, &weight);
+        sum = VEC_FMA(weight, term(x, x, VEC_LOADU(table + whole)), sum);
+    }
+    return VEC_NAME(sumLanes)(sum);
+}
+
+VEC_TARGET static ALWAYS_INLINE double VEC_NAME(sumPairsFixed)(const Real* vector, const int numDim, VEC_NAME(TermFunction) term, const double* table){
+    VEC sum = VEC_SET1(0.0), y, weight;
+    int pairs = numDim - 1, /*!< The number of neighbouring pairs*/
+    whole = pairs - pairs % VEC_WIDTH; /*!< The pairs filling whole vectors*/
+#pragma GCC unroll 32
+    for(int j = 0; j < whole; j += VEC_WIDTH){
+        VEC x = VEC_LOAD_REAL(vector + j);
+        y = VEC_LOAD_REAL(vector + j + 1);
+        sum = VEC_ADD(term(x, y, VEC_LOADU(table + j)), sum);
+    }
+    if(whole < pairs){
+        VEC x = VEC_NAME(loadPairs)(vector, whole, pairs, &y, &weight);
+        sum = VEC_FMA(weight, term(x, y, VEC_LOADU(table + whole)), sum);
+    }
+    return VEC_NAME(sumLanes)(sum);
+}
+
+VEC_TARGET static ALWAYS_INLINE void VEC_NAME(batchElementsFixed)(const Real* columns, int stride, int count, const int numDim, VEC_NAME(TermFunction) term, const double* table, double* fitness){
+    for(int v = 0; v < count; v += VEC_WIDTH){
+        VEC sum = VEC_SET1(0.0);
+        for(int j = 0; j < numDim; j++){
+            VEC x = VEC_LOAD_REAL(columns + (size_t)j * stride + v);
+            sum = VEC_ADD(sum, term(x, x, VEC_SET1(table[j])));
+        }
+        VEC_NAME(storeLanes)(fitness + v, count - v, sum);
+    }
+}
+
+VEC_TARGET static ALWAYS_INLINE void VEC_NAME(batchPairsFixed)(const Real* columns, int stride, int count, const int numDim, VEC_NAME(TermFunction) term, const double* table, double* fitness){
+    for(int v = 0; v < count; v += VEC_WIDTH){
+        VEC sum = VEC_SET1(0.0),
+        x = VEC_LOAD_REAL(columns + v);
+        for(int j = 0; j < numDim - 1; j++){
+            VEC y = VEC_LOAD_REAL(columns + (size_t)(j + 1) * stride + v);
+            sum = VEC_ADD(sum, term(x, y, VEC_SET1(table[j])));
+            x = y;
+        }
+        VEC_NAME(storeLanes)(fitness + v, count - v, sum);
+    }
+}
+
+VEC_TARGET static ALWAYS_INLINE double VEC_NAME(griewangkFixed)(const Real* vector, const int numDim){
+    VEC sum = VEC_SET1(0.0), product = VEC_SET1(1.0), weight;
+    double lanes[VEC_WIDTH], /*!< The partial product of every lane*/
+    multValue = 1.0;
+    int whole = numDim - numDim % VEC_WIDTH; /*!< The elements filling whole vectors*/
+#pragma GCC unroll 32
+    for(int j = 0; j < whole; j += VEC_WIDTH){
+        VEC x = VEC_LOAD_REAL(vector + j);
+        sum = VEC_ADD(VEC_DIV(VEC_MUL(x, x), VEC_SET1(4000.0)), sum);
+        product = VEC_MUL(product, VEC_NAME(vecCos)(VEC_MUL(x, VEC_LOADU(fixedInvSqrt + j))));
+    }
+    if(whole < numDim){
+        VEC x = VEC_NAME(loadElements)(vector, whole, numDim, &weight);
+        sum = VEC_FMA(weight, VEC_DIV(VEC_MUL(x, x), VEC_SET1(4000.0)), sum);
+        VEC factor = VEC_NAME(vecCos)(VEC_MUL(x, VEC_LOADU(fixedInvSqrt + whole)));
+        product = VEC_MUL(product, VEC_SELECT_LT(weight, VEC_SET1(0.5), VEC_SET1(1.0), factor));
+    }
+    VEC_STOREU(lanes, product);
+    for(int k = 0; k < VEC_WIDTH; k++)
+        multValue *= lanes[k];
+    return 1.0 + VEC_NAME(sumLanes)(sum) - multValue;
+}
+
+VEC_TARGET static ALWAYS_INLINE void VEC_NAME(griewangkBatchFixed)(const Real* columns, int stride, int count, const int numDim, double* fitness){
+    for(int v = 0; v < count; v += VEC_WIDTH){
+        VEC sum = VEC_SET1(0.0), product = VEC_SET1(1.0);
+        for(int j = 0; j < numDim; j++){
+            VEC x = VEC_LOAD_REAL(columns + (size_t)j * stride + v);
+            sum = VEC_ADD(sum, VEC_DIV(VEC_MUL(x, x), VEC_SET1(4000.0)));
+            product = VEC_MUL(product, VEC_NAME(vecCos)(VEC_MUL(x, VEC_SET1(fixedInvSqrt[j]))));
+        }
+        VEC_NAME(storeLanes)(fitness + v, count - v, VEC_SUB(VEC_ADD(VEC_SET1(1.0), sum), product));
+    }
+}
+
+VEC_TARGET static ALWAYS_INLINE double VEC_NAME(levyFixed)(const Real* vector, const int numDim){
+    VEC sum = VEC_SET1(0.0), weight;
+    double levyFirstConst = 1.0 + ((vector[0] - 1.0) / 4.0), /*!< W0 of the vector*/
+    levyLastConst = 1.0 + ((vector[numDim - 1] - 1.0) / 4.0), /*!< Wn of the vector*/
+    lastSine = sin(2.0 * M_PI * levyLastConst),
+    lastTerm = (levyLastConst - 1.0) * (levyLastConst - 1.0) * (1.0 + lastSine * lastSine), /*!< The Wn term added with every element*/
+    firstSine = sin(M_PI * levyFirstConst);
+    int terms = numDim - 1, /*!< The elements summed, all but the last*/
+    whole = terms - terms % VEC_WIDTH; /*!< The elements filling whole vectors*/
+#pragma GCC unroll 32
+    for(int j = 0; j < whole; j += VEC_WIDTH)
+        sum = VEC_ADD(VEC_NAME(levyTerm)(VEC_LOAD_REAL(vector + j), VEC_SET1(lastTerm)), sum);
+    if(whole < terms){
+        VEC x = VEC_NAME(loadElements)(vector, whole, terms, &weight);
+        sum = VEC_FMA(weight, VEC_NAME(levyTerm)(x, VEC_SET1(lastTerm)), sum);
+    }
+    return firstSine * firstSine + VEC_NAME(sumLanes)(sum);
+}
+
+/*!
+ * Defines the kernel and the batch kernel of a function for one fixed size, from the fixed size driver summing its
+ * term, the table of per element constants the term is given and the function applied to the sum of every vector.
+ */
+#define VEC_FIXED_KERNELS(name, driver, term, table, finish, size) \
+VEC_TARGET static double VEC_NAME(name##Kernel##size)(const Real* vector, int numDim){ \
+    (void)numDim; \
+    return VEC_NAME(finish)(VEC_NAME(sum##driver##Fixed)(vector, size, VEC_NAME(term), table), size); \
+} \
+VEC_TARGET static void VEC_NAME(name##Batch##size)(const Real* columns, int stride, int count, int numDim, double* fitness){ \
+    (void)numDim; \
+    VEC_NAME(batch##driver##Fixed)(columns, stride, count, size, VEC_NAME(term), table, fitness); \
+    for(int v = 0; v < count; v++) \
+        fitness[v] = VEC_NAME(finish)(fitness[v], size); \
+}
+
+/*!
+ * Defines the fixed size kernels of a function for every size in FIXED_DIMENSIONS of src/SimdEquations.h.
+ */
+#define VEC_FIXED_SIZES(name, driver, term, table, finish) \
+VEC_FIXED_KERNELS(name, driver, term, table, finish, 10) \
+VEC_FIXED_KERNELS(name, driver, term, table, finish, 20) \
+VEC_FIXED_KERNELS(name, driver, term, table, finish, 30) \
+VEC_FIXED_KERNELS(name, driver, term, table, finish, 50)
+
+VEC_FIXED_SIZES(schwefel, Elements, schwefelTerm, fixedIndices, schwefelFinish)
+VEC_FIXED_SIZES(deJong, Elements, deJongTerm, fixedIndices, plainFinish)
+VEC_FIXED_SIZES(rosenbrock, Pairs, rosenbrockTerm, fixedIndices, plainFinish)
+VEC_FIXED_SIZES(rastgrin, Elements, rastgrinTerm, fixedIndices, rastgrinFinish)
+VEC_FIXED_SIZES(sineEnvSineWave, Pairs, sineEnvSineWaveTerm, fixedIndices, negatedFinish)
+VEC_FIXED_SIZES(stretchVSineWave, Pairs, stretchVSineWaveTerm, fixedIndices, plainFinish)
+VEC_FIXED_SIZES(ackleyOne, Pairs, ackleyOneTerm, fixedIndices, plainFinish)
+VEC_FIXED_SIZES(ackleyTwo, Pairs, ackleyTwoTerm, fixedIndices, plainFinish)
+VEC_FIXED_SIZES(eggHolder, Pairs, eggHolderTerm, fixedIndices, plainFinish)
+VEC_FIXED_SIZES(rana, Pairs, ranaTerm, fixedIndices, plainFinish)
+VEC_FIXED_SIZES(pathological, Pairs, pathologicalTerm, fixedIndices, plainFinish)
+VEC_FIXED_SIZES(michalewicz, Elements, michalewiczFixedTerm, fixedMichalewicz, negatedFinish)
+VEC_FIXED_SIZES(mastersCosineWave, Pairs, mastersCosineWaveTerm, fixedIndices, negatedFinish)
+VEC_FIXED_SIZES(quartic, Elements, quarticTerm, fixedIndices, plainFinish)
+VEC_FIXED_SIZES(step, Elements, stepTerm, fixedIndices, plainFinish)
+VEC_FIXED_SIZES(alpine, Elements, alpineTerm, fixedIndices, plainFinish)
+
+#undef VEC_FIXED_SIZES
+#undef VEC_FIXED_KERNELS
+
+/*!
+ * Defines the fixed size kernels of Griewangk and Levy, which are written out, and uses the generic batch kernel of
+ * Levy, whose loop only adds a term shared with the kernel.
+ */
+#define VEC_FIXED_WRITTEN(size) \
+VEC_TARGET static double VEC_NAME(griewangkKernel##size)(const Real* vector, int numDim){ \
+    (void)numDim; \
+    return VEC_NAME(griewangkFixed)(vector, size); \
+} \
+VEC_TARGET static void VEC_NAME(griewangkBatch##size)(const Real* columns, int stride, int count, int numDim, double* fitness){ \
+    (void)numDim; \
+    VEC_NAME(griewangkBatchFixed)(columns, stride, count, size, fitness); \
+} \
+VEC_TARGET static double VEC_NAME(levyKernel##size)(const Real* vector, int numDim){ \
+    (void)numDim; \
+    return VEC_NAME(levyFixed)(vector, size); \
+}
+
+VEC_FIXED_WRITTEN(10)
+VEC_FIXED_WRITTEN(20)
+VEC_FIXED_WRITTEN(30)
+VEC_FIXED_WRITTEN(50)
+
+#undef VEC_FIXED_WRITTEN
+
+/*!
+ * Applies an operation of src/Bytecode.h to every lane with formulaScalarOp, for the lanes the vectorized functions
+ * below are not accurate for.
+ */
+VEC_TARGET static VEC VEC_NAME(formulaLanes)(int code, VEC a, VEC b){
+    double left[VEC_WIDTH], /*!< The left operand of every lane*/
+    right[VEC_WIDTH]; /*!< The right operand of every lane*/
+    VEC_STOREU(left, a);
+    VEC_STOREU(right, b);
+    for(int k = 0; k < VEC_WIDTH; k++)
+        left[k] = formulaScalarOp(code, left[k], right[k]);
+    return VEC_LOADU(left);
+}
+
+/*!
+ * The exponential of a formula. Arguments the clamp of vecExp would change go to the C library, and adding a * 0 keeps
+ * a NaN argument NaN.
+ */
+VEC_TARGET static inline VEC VEC_NAME(formulaExp)(VEC a){
+    if(VEC_ANY_GT(VEC_ABS(a), VEC_SET1(-EXP_MIN_ARG)))
+        return VEC_NAME(formulaLanes)(FormulaExp, a, a);
+    return VEC_ADD(VEC_NAME(vecExp)(a), VEC_MUL(a, VEC_SET1(0.0)));
+}
+
+/*!
+ * The logarithm of a formula. Zero, negative, subnormal and infinite arguments go to the C library.
+ */
+VEC_TARGET static inline VEC VEC_NAME(formulaLog)(VEC a){
+    if(VEC_ANY_GT(VEC_SET1(DBL_MIN), a) || VEC_ANY_GT(a, VEC_SET1(DBL_MAX)))
+        return VEC_NAME(formulaLanes)(FormulaLog, a, a);
+    return VEC_ADD(VEC_NAME(vecLog)(a), VEC_MUL(a, VEC_SET1(0.0)));
+}
+
+/*!
+ * a^b as e^(b ln a) for a positive base, the powers with a constant integer exponent having been compiled to products.
+ * Any other base, or a result the exponential cannot hold, goes to the C library.
+ */
+VEC_TARGET static inline VEC VEC_NAME(formulaPow)(VEC a, VEC b){
+    if(VEC_ANY_GT(VEC_SET1(DBL_MIN), a) || VEC_ANY_GT(a, VEC_SET1(DBL_MAX)))
+        return VEC_NAME(formulaLanes)(FormulaPow, a, b);
+    VEC y = VEC_MUL(b, VEC_NAME(vecLog)(a)); /*!< The logarithm of the result*/
+    if(VEC_ANY_GT(VEC_ABS(y), VEC_SET1(-EXP_MIN_ARG)))
+        return VEC_NAME(formulaLanes)(FormulaPow, a, b);
+    return VEC_ADD(VEC_NAME(vecExp)(y), VEC_MUL(b, VEC_SET1(0.0)));
+}
+
+/*!
+ * Runs one operation over the lanes of its registers, VEC_WIDTH lanes at a time, an operation of two operands loading
+ * the right one as well.
+ */
+#define VEC_FORMULA_UNARY(result) \
+    for(int k = 0; k < width; k += VEC_WIDTH){ \
+        VEC a = VEC_LOADU(left + k); \
+        VEC_STOREU(dest + k, result); \
+    } \
+    break;
+#define VEC_FORMULA_BINARY(result) \
+    for(int k = 0; k < width; k += VEC_WIDTH){ \
+        VEC a = VEC_LOADU(left + k), b = VEC_LOADU(right + k); \
+        VEC_STOREU(dest + k, result); \
+    } \
+    break;
+
+/*!
+ * Runs a program of src/Bytecode.h with the signature of FormulaRunner. Every operation is decoded once and applied to
+ * the whole block, the lanes past count being computed with the rest of their vector and never accumulated.
+ */
+VEC_TARGET static void VEC_NAME(runFormula)(const FormulaProgram* program, double (*registers)[FORMULA_BLOCK], int count, double* accumulator){
+    int width = (count + VEC_WIDTH - 1) / VEC_WIDTH * VEC_WIDTH; /*!< The lanes covered by whole vectors*/
+    for(int o = 0; o < program->numOps; o++){
+        const FormulaOp* op = &program->ops[o]; /*!< The operation being run*/
+        double* dest = registers[op->dest];
+        const double* left = registers[op->left],
+        * right = registers[op->right];
+        switch(op->code){
+            case FormulaAdd: VEC_FORMULA_BINARY(VEC_ADD(a, b))
+            case FormulaSub: VEC_FORMULA_BINARY(VEC_SUB(a, b))
+            case FormulaMul: VEC_FORMULA_BINARY(VEC_MUL(a, b))
+            case FormulaDiv: VEC_FORMULA_BINARY(VEC_DIV(a, b))
+            case FormulaPow: VEC_FORMULA_BINARY(VEC_NAME(formulaPow)(a, b))
+            case FormulaNeg: VEC_FORMULA_UNARY(VEC_MUL(a, VEC_SET1(-1.0)))
+            case FormulaSqrt: VEC_FORMULA_UNARY(VEC_SQRT(a))
+            case FormulaAbs: VEC_FORMULA_UNARY(VEC_ABS(a))
+            case FormulaSin: VEC_FORMULA_UNARY(VEC_NAME(vecSin)(a))
+            case FormulaCos: VEC_FORMULA_UNARY(VEC_NAME(vecCos)(a))
+            case FormulaExp: VEC_FORMULA_UNARY(VEC_NAME(formulaExp)(a))
+            default: VEC_FORMULA_UNARY(VEC_NAME(formulaLog)(a))
+        }
+    }
+    if(!accumulator)
+        return;
+    const double* result = registers[program->result]; /*!< The result of every lane*/
+    int whole = count - count % VEC_WIDTH; /*!< The lanes filling whole vectors*/
+    for(int k = 0; k < whole; k += VEC_WIDTH){
+        VEC sum = VEC_LOADU(accumulator + k), value = VEC_LOADU(result + k);
+        VEC_STOREU(accumulator + k, program->product ? VEC_MUL(sum, value) : VEC_ADD(sum, value));
+    }
+    for(int k = whole; k < count; k++)
+        accumulator[k] = program->product ? accumulator[k] * result[k] : accumulator[k] + result[k];
+}
+
+#undef VEC_FORMULA_UNARY
+#undef VEC_FORMULA_BINARY
+
+/*!
+ * Applies a rotation in the layout of src/Rotation.h to count vectors. Every strip of 2 * VEC_WIDTH outputs is built
+ * for ROTATION_BLOCK_ROWS vectors at once in eight registers, so the two loads of a row of the matrix serve all of them,
+ * and the vectors left over are built one at a time with the even and odd rows in separate registers. The rows are taken
+ * a panel at a time, the outputs of a panel after the first starting from the sums of the panels before it.
+ */
+VEC_TARGET static void VEC_NAME(rotateRows)(const double* rotation, int stride, const double* inputs, int count, int dimensions, double* outputs){
+    for(int first = 0; first < dimensions; first += ROTATION_PANEL_ROWS){
+        int last = first + ROTATION_PANEL_ROWS < dimensions ? first + ROTATION_PANEL_ROWS : dimensions; /*!< The row after the last row of the panel*/
+        for(int i = 0; i < stride; i += 2 * VEC_WIDTH){
+            const double* panel = rotation + i; /*!< The strip of the matrix, one row every stride values*/
+            int c = 0;
+            for(; c + ROTATION_BLOCK_ROWS <= count; c += ROTATION_BLOCK_ROWS){
+                const double* y0 = inputs + (long)c * stride, /*!< The vectors being rotated*/
+                *y1 = y0 + stride,
+                *y2 = y1 + stride,
+                *y3 = y2 + stride;
+                double* z = outputs + (long)c * stride + i; /*!< The strip of the outputs of the first vector*/
+                VEC zero = VEC_SET1(0.0),
+                lo0 = first ? VEC_LOADU(z) : zero, /*!< The low and high half of the strip of every vector*/
+                hi0 = first ? VEC_LOADU(z + VEC_WIDTH) : zero,
+                lo1 = first ? VEC_LOADU(z + stride) : zero,
+                hi1 = first ? VEC_LOADU(z + stride + VEC_WIDTH) : zero,
+                lo2 = first ? VEC_LOADU(z + 2 * stride) : zero,
+                hi2 = first ? VEC_LOADU(z + 2 * stride + VEC_WIDTH) : zero,
+                lo3 = first ? VEC_LOADU(z + 3 * stride) : zero,
+                hi3 = first ? VEC_LOADU(z + 3 * stride + VEC_WIDTH) : zero;
+                for(int j = first; j < last; j++){
+                    const double* row = panel + (long)j * stride; /*!< The strip of row j*/
+                    VEC low = VEC_LOADU(row), high = VEC_LOADU(row + VEC_WIDTH), y;
+                    y = VEC_SET1(y0[j]);
+                    lo0 = VEC_FMA(y, low, lo0);
+                    hi0 = VEC_FMA(y, high, hi0);
+                    y = VEC_SET1(y1[j]);
+                    lo1 = VEC_FMA(y, low, lo1);
+                    hi1 = VEC_FMA(y, high, hi1);
+                    y = VEC_SET1(y2[j]);
+                    lo2 = VEC_FMA(y, low, lo2);
+                    hi2 = VEC_FMA(y, high, hi2);
+                    y = VEC_SET1(y3[j]);
+                    lo3 = VEC_FMA(y, low, lo3);
+                    hi3 = VEC_FMA(y, high, hi3);
+                }
+                VEC_STOREU(z, lo0);
+                VEC_STOREU(z + VEC_WIDTH, hi0);
+                VEC_STOREU(z + stride, lo1);
+                VEC_STOREU(z + stride + VEC_WIDTH, hi1);
+                VEC_STOREU(z + 2 * stride, lo2);
+                VEC_STOREU(z + 2 * stride + VEC_WIDTH, hi2);
+                VEC_STOREU(z + 3 * stride, lo3);
+                VEC_STOREU(z + 3 * stride + VEC_WIDTH, hi3);
+            }
+            for(; c < count; c++){
+                const double* y = inputs + (long)c * stride; /*!< The vector being rotated*/
+                double* z = outputs + (long)c * stride + i; /*!< The strip of its outputs*/
+                VEC zero = VEC_SET1(0.0),
+                loEven = first ? VEC_LOADU(z) : zero, /*!< The low and high half of the strip, summed over the even and odd rows*/
+                hiEven = first ? VEC_LOADU(z + VEC_WIDTH) : zero,
+                loOdd = zero,
+                hiOdd = zero;
+                int j = first;
+                for(; j + 1 < last; j += 2){
+                    const double* row = panel + (long)j * stride; /*!< The strip of row j*/
+                    VEC even = VEC_SET1(y[j]), odd = VEC_SET1(y[j + 1]);
+                    loEven = VEC_FMA(even, VEC_LOADU(row), loEven);
+                    hiEven = VEC_FMA(even, VEC_LOADU(row + VEC_WIDTH), hiEven);
+                    loOdd = VEC_FMA(odd, VEC_LOADU(row + stride), loOdd);
+                    hiOdd = VEC_FMA(odd, VEC_LOADU(row + stride + VEC_WIDTH), hiOdd);
+                }
+                if(j < last){
+                    const double* row = panel + (long)j * stride; /*!< The strip of the last row*/
+                    VEC even = VEC_SET1(y[j]);
+                    loEven = VEC_FMA(even, VEC_LOADU(row), loEven);
+                    hiEven = VEC_FMA(even, VEC_LOADU(row + VEC_WIDTH), hiEven);
+                }
+                VEC_STOREU(z, VEC_ADD(loEven, loOdd));
+                VEC_STOREU(z + VEC_WIDTH, VEC_ADD(hiEven, hiOdd));
+            }
+        }
+    }
+}
+
+/*!
+ * The fixed size kernels and batch kernels of one function, in the order of FIXED_DIMENSIONS.
+ */
+#define VEC_FIXED_ROW(name) {&VEC_NAME(name##10), &VEC_NAME(name##20), &VEC_NAME(name##30), &VEC_NAME(name##50)}
+
+/*!
+ * The fixed size kernels of this instruction set in the order of the EquationPosition enum in src/Utilities.h.
+ */
+static const void* VEC_NAME(fixedKernels)[][FIXED_DIMENSION_COUNT] = {
+        VEC_FIXED_ROW(schwefelKernel),
+        VEC_FIXED_ROW(deJongKernel),
+        VEC_FIXED_ROW(rosenbrockKernel),
+        VEC_FIXED_ROW(rastgrinKernel),
+        VEC_FIXED_ROW(griewangkKernel),
+        VEC_FIXED_ROW(sineEnvSineWaveKernel),
+        VEC_FIXED_ROW(stretchVSineWaveKernel),
+        VEC_FIXED_ROW(ackleyOneKernel),
+        VEC_FIXED_ROW(ackleyTwoKernel),
+        VEC_FIXED_ROW(eggHolderKernel),
+        VEC_FIXED_ROW(ranaKernel),
+        VEC_FIXED_ROW(pathologicalKernel),
+        VEC_FIXED_ROW(michalewiczKernel),
+        VEC_FIXED_ROW(mastersCosineWaveKernel),
+        VEC_FIXED_ROW(quarticKernel),
+        VEC_FIXED_ROW(levyKernel),
+        VEC_FIXED_ROW(stepKernel),
+        VEC_FIXED_ROW(alpineKernel)
+};
+
+/*!
+ * The fixed size batch kernels of this instruction set in the same order, Levy keeping its generic batch kernel.
+ */
+static const void* VEC_NAME(fixedBatches)[][FIXED_DIMENSION_COUNT] = {
+        VEC_FIXED_ROW(schwefelBatch),
+        VEC_FIXED_ROW(deJongBatch),
+        VEC_FIXED_ROW(rosenbrockBatch),
+        VEC_FIXED_ROW(rastgrinBatch),
+        VEC_FIXED_ROW(griewangkBatch),
+        VEC_FIXED_ROW(sineEnvSineWaveBatch),
+        VEC_FIXED_ROW(stretchVSineWaveBatch),
+        VEC_FIXED_ROW(ackleyOneBatch),
+        VEC_FIXED_ROW(ackleyTwoBatch),
+        VEC_FIXED_ROW(eggHolderBatch),
+        VEC_FIXED_ROW(ranaBatch),
+        VEC_FIXED_ROW(pathologicalBatch),
+        VEC_FIXED_ROW(michalewiczBatch),
+        VEC_FIXED_ROW(mastersCosineWaveBatch),
+        VEC_FIXED_ROW(quarticBatch),
+        {&VEC_NAME(levyBatch), &VEC_NAME(levyBatch), &VEC_NAME(levyBatch), &VEC_NAME(levyBatch)},
+        VEC_FIXED_ROW(stepBatch),
+        VEC_FIXED_ROW(alpineBatch)
+};
+
+#undef VEC_FIXED_ROW
+
+/*!
+ * The kernels of this instruction set in the order of the EquationPosition enum in src/Utilities.h.
+ */
+static const void* VEC_NAME(equationKernels)[] = {
+        &VEC_NAME(schwefelKernel),
+        &VEC_NAME(deJongKernel),
+        &VEC_NAME(rosenbrockKernel),
+        &VEC_NAME(rastgrinKernel),
+        &VEC_NAME(griewangkKernel),
+        &VEC_NAME(sineEnvSineWaveKernel),
+        &VEC_NAME(stretchVSineWaveKernel),
+        &VEC_NAME(ackleyOneKernel),
+        &VEC_NAME(ackleyTwoKernel),
+        &VEC_NAME(eggHolderKernel),
+        &VEC_NAME(ranaKernel),
+        &VEC_NAME(pathologicalKernel),
+        &VEC_NAME(michalewiczKernel),
+        &VEC_NAME(mastersCosineWaveKernel),
+        &VEC_NAME(quarticKernel),
+        &VEC_NAME(levyKernel),
+        &VEC_NAME(stepKernel),
+        &VEC_NAME(alpineKernel)
+};
+
+/*!
+ * The parts of this instruction set in the same order, empty for the functions run on a part through their kernel.
+ */
+static const void* VEC_NAME(equationParts)[] = {
+        NULL, NULL, NULL, NULL,
+        &VEC_NAME(griewangkPart),
+        NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+        &VEC_NAME(michalewiczPart),
+        NULL,
+        &VEC_NAME(quarticPart),
+        &VEC_NAME(levyPart),
+        NULL,
+        NULL
+};
+
+/*!
+ * The batch kernels of this instruction set in the same order.
+ */
+static const void* VEC_NAME(equationBatches)[] = {
+        &VEC_NAME(schwefelBatch),
+        &VEC_NAME(deJongBatch),
+        &VEC_NAME(rosenbrockBatch),
+        &VEC_NAME(rastgrinBatch),
+        &VEC_NAME(griewangkBatch),
+        &VEC_NAME(sineEnvSineWaveBatch),
+        &VEC_NAME(stretchVSineWaveBatch),
+        &VEC_NAME(ackleyOneBatch),
+        &VEC_NAME(ackleyTwoBatch),
+        &VEC_NAME(eggHolderBatch),
+        &VEC_NAME(ranaBatch),
+        &VEC_NAME(pathologicalBatch),
+        &VEC_NAME(michalewiczBatch),
+        &VEC_NAME(mastersCosineWaveBatch),
+        &VEC_NAME(quarticBatch),
+        &VEC_NAME(levyBatch),
+        &VEC_NAME(stepBatch),
+        &VEC_NAME(alpineBatch)
+};
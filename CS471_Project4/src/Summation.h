@@ -0,0 +1,82 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Summation.h
+ * \brief This is where the compensated and pairwise sums the built in functions add their terms with are defined.
+ *
+ *  Adding n terms one after another loses up to n * DBL_EPSILON / 2 of the sum of their magnitudes, which at 10^5
+ *  dimensions and more is enough to hide the difference between two close candidates, and ties the fitness to the order
+ *  the terms are added in. The built in functions therefore carry the rounding error of their sums alongside them.
+ *
+ *  - The scalar references of src/Equations.h add every term with addCompensated, the Neumaier variant of Kahan
+ *    summation.
+ *  - The kernels of src/SimdKernels.h add at most SUMMATION_BLOCK_TERMS terms in every lane plainly, carry every block
+ *    into a sum and error held in every lane with the error free addition of Knuth, which needs no comparison, and
+ *    combine the lanes with addCompensated.
+ *  - evaluateBounded in src/Utilities.h adds its blocks with addCompensated, and evaluateSplit adds the parts of a
+ *    vector with pairwiseSum in an order fixed by the number of parts.
+ *
+ *  For terms t_1 ... t_n with sum S, and u = DBL_EPSILON / 2, a reference returns S to within u * |S| and a kernel to
+ *  within u * |S| + SUMMATION_BLOCK_TERMS * u * (|t_1| + ... + |t_n|), leaving out terms of the order of n * u^2, however
+ *  large n is. The fixed size kernels of 10 to 50 dimensions sum every lane in a single block, which keeps them within
+ *  the same bound. A kernel and its reference so differ by at most both bounds plus the few ulp the vectorized sine,
+ *  cosine, exponential and logarithm differ from the C library by in every term, and a vector evaluated in parts adds
+ *  u * log2(parts) of the magnitudes of its parts. None of this depends on the number of threads.
+ */
+#ifndef TESTINGSUITE_SUMMATION_H
+#define TESTINGSUITE_SUMMATION_H
+
+#include <math.h>
+
+#define SUMMATION_BLOCK_TERMS 64 /*!< declare the constant for the most terms every lane of a kernel adds plainly before carrying them into its compensated sum*/
+
+/*!
+ * A sum and the rounding error lost by the additions that built it, so that sum + error is the exact sum up to terms of
+ * the order of DBL_EPSILON squared.
+ */
+typedef struct _CompensatedSum{
+    double sum;
+    double error;
+}CompensatedSum;
+
+/// \fn void addCompensated(CompensatedSum* total, double value)
+/// \brief Adds a value to a compensated sum, recovering the rounding error of the addition from whichever of the two
+/// has the larger magnitude.
+///
+/// \param total - the compensated sum
+/// \param value - the value to be added
+static inline void addCompensated(CompensatedSum* total, double value){
+    double sum = total->sum + value; /*!< The rounded sum*/
+    if(fabs(total->sum) >= fabs(value))
+        total->error += (total->sum - sum) + value;
+    else
+        total->error += (value - sum) + total->sum;
+    total->sum = sum;
+}
+
+/// \fn double compensatedTotal(const CompensatedSum* total)
+/// \brief Returns a compensated sum rounded once, or the sum alone once it is infinite or NaN, whose error is NaN.
+///
+/// \param total - the compensated sum
+/// \return the sum with its error added back
+static inline double compensatedTotal(const CompensatedSum* total){
+    return isfinite(total->sum) ? total->sum + total->error : total->sum;
+}
+
+/// \fn double pairwiseSum(double* values, int count)
+/// \brief Adds values together pairwise in place, neighbours first, so the order of the additions only depends on count
+/// and the error grows with log2(count) instead of count.
+///
+/// \param values - the values, which are overwritten with partial sums
+/// \param count - the number of values, at least 1
+/// \return the sum of the values
+static inline double pairwiseSum(double* values, int count){
+    for(int width = 1; width < count; width *= 2){
+        for(int i = 0; i + width < count; i += 2 * width)
+            values[i] += values[i + width];
+    }
+    return values[0];
+}
+
+#endif //TESTINGSUITE_SUMMATION_H
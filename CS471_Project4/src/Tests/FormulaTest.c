@@ -0,0 +1,136 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*! \file FormulaTest.c
+ *  \brief Checks that compiled objective formulas evaluate to the same values as the functions they are written from.
+ *
+ *  Every formula is compiled with compileFormula from src/Formulas.h and evaluated at a few vectors, one at a time and
+ *  as a batch, first with the scalar runner and then with the runner of the widest instruction set the processor
+ *  supports. The formulas read a node again after raising it to a power, which must not reuse its register.
+ */
+#include "../Utilities.h"
+#include "../Formulas.h"
+#include "../CpuFeatures.h"
+
+#define TEST_DIMENSIONS 3 /*!< The number of dimensions of every test vector*/
+#define TEST_VECTORS 3 /*!< The number of test vectors*/
+#define TEST_TOLERANCE 1e-9 /*!< The largest relative difference from the expected value*/
+
+static double cubePlus(const double* x, int numDim){
+    double sum = 0.0;
+    for(int i = 0; i < numDim; i++)
+        sum += pow(x[i] + 1.0, 3.0) + (x[i] + 1.0);
+    return sum;
+}
+
+static double sixthPower(const double* x, int numDim){
+    double sum = 0.0;
+    for(int i = 0; i < numDim; i++)
+        sum += pow(x[i] + 1.0, 5.0) * (x[i] + 1.0);
+    return sum;
+}
+
+static double inversePlus(const double* x, int numDim){
+    double sum = 0.0;
+    for(int i = 0; i < numDim; i++)
+        sum += 1.0 / (x[i] + 1.0) + (x[i] + 1.0);
+    return sum;
+}
+
+static double mixedPowers(const double* x, int numDim){
+    double sum = 0.0;
+    for(int i = 0; i < numDim; i++)
+        sum += pow(x[i], 7.0) - pow(x[i], 4.0) * x[i] + pow(x[i], -2.0);
+    return sum;
+}
+
+static double rosenbrock(const double* x, int numDim){
+    double sum = 0.0;
+    for(int i = 0; i < numDim - 1; i++)
+        sum += 100.0 * pow(x[i + 1] - x[i] * x[i], 2.0) + pow(1.0 - x[i], 2.0);
+    return sum;
+}
+
+static double rastrigin(const double* x, int numDim){
+    double sum = 0.0;
+    for(int i = 0; i < numDim; i++)
+        sum += x[i] * x[i] - 10.0 * cos(2.0 * M_PI * x[i]);
+    return 10.0 * numDim + sum;
+}
+
+/*!
+ * A formula and the function it is written from.
+ */
+typedef struct _FormulaCase{
+    char* name;
+    char* text;
+    double (*expected)(const double* x, int numDim);
+}FormulaCase;
+
+static const FormulaCase formulaCases[] = {
+        {"CubePlus", "sum((x[i]+1)^3 + (x[i]+1))", &cubePlus},
+        {"SixthPower", "sum((x[i]+1)^5 * (x[i]+1))", &sixthPower},
+        {"InversePlus", "sum((x[i]+1)^-1 + (x[i]+1))", &inversePlus},
+        {"MixedPowers", "sum(x[i]^7 - x[i]^4*x[i] + x[i]^-2)", &mixedPowers},
+        {"Rosenbrock", "sum(100*(x[i+1] - x[i]^2)^2 + (1 - x[i])^2)", &rosenbrock},
+        {"Rastrigin", "10*n + sum(x[i]^2 - 10*cos(2*pi*x[i]))", &rastrigin}
+};
+
+static const double testVectors[TEST_VECTORS][TEST_DIMENSIONS] = {
+        {1.0, 2.0, 0.5},
+        {-0.5, 0.25, 3.0},
+        {2.0, -1.5, 0.75}
+};
+
+/// \fn static int checkFormulas(const int* equations, int numCases, char* runner)
+/// \brief Evaluates every compiled formula at the test vectors, alone and as a batch, and prints every wrong value.
+///
+/// \param equations - the position every formula was compiled to
+/// \param numCases - the number of formulas
+/// \param runner - the name of the installed runner, for the output
+/// \return the number of wrong values
+static int checkFormulas(const int* equations, int numCases, char* runner){
+    int failures = 0; /*!< The number of wrong values*/
+    Real vectors[TEST_VECTORS * TEST_DIMENSIONS]; /*!< The test vectors one after another*/
+    Matrix columns = allocateEmptyMatrix(TEST_DIMENSIONS, TEST_VECTORS); /*!< The test vectors one row per element, for the batch kernel*/
+    double batch[TEST_VECTORS]; /*!< The fitness of every vector evaluated as a batch*/
+    for(int v = 0; v < TEST_VECTORS; v++){
+        for(int j = 0; j < TEST_DIMENSIONS; j++){
+            vectors[v * TEST_DIMENSIONS + j] = (Real)testVectors[v][j];
+            matrixRow(&columns, j)[v] = (Real)testVectors[v][j];
+        }
+    }
+    for(int c = 0; c < numCases; c++){
+        Objective objective = formulaObjective(equations[c], TEST_DIMENSIONS); /*!< The functions of the formula*/
+        objective.batch(columns.data, columns.stride, TEST_VECTORS, TEST_DIMENSIONS, batch);
+        for(int v = 0; v < TEST_VECTORS; v++){
+            double expected = formulaCases[c].expected(testVectors[v], TEST_DIMENSIONS), /*!< The value of the function*/
+            single = objective.function(vectors + v * TEST_DIMENSIONS, TEST_DIMENSIONS); /*!< The value of the formula*/
+            if(fabs(single - expected) > TEST_TOLERANCE * fmax(1.0, fabs(expected)) || fabs(batch[v] - expected) > TEST_TOLERANCE * fmax(1.0, fabs(expected))){
+                printf("%s runner: %s at vector %d is %.10g (batch %.10g), expected %.10g\n", runner, formulaCases[c].name, v, single, batch[v], expected);
+                failures++;
+            }
+        }
+    }
+    releaseMatrix(&columns);
+    return failures;
+}
+
+/// \fn int main()
+/// \brief Compiles every formula and checks it with the scalar runner and the vectorized one.
+/// \return 0 when every value is right, 1 otherwise.
+int main(){
+    int numCases = sizeof(formulaCases) / sizeof(formulaCases[0]), /*!< The number of formulas*/
+    equations[sizeof(formulaCases) / sizeof(formulaCases[0])], /*!< The position every formula was compiled to*/
+    failures; /*!< The number of wrong values*/
+    for(int c = 0; c < numCases; c++){
+        if((equations[c] = compileFormula(formulaCases[c].name, -10.0, 10.0, formulaCases[c].text)) < 0)
+            return 1;
+    }
+    failures = checkFormulas(equations, numCases, "Scalar");
+    detectSimdLevel();
+    installEquationKernels(AutoKernels);
+    failures += checkFormulas(equations, numCases, "Vectorized");
+    printf("%d of %d formula values were wrong\n", failures, 2 * numCases * TEST_VECTORS);
+    return failures > 0;
+}
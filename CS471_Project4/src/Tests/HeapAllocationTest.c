@@ -0,0 +1,143 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*! \file HeapAllocationTest.c
+ *  \brief Checks that the iterations of every algorithm never allocate from the heap.
+ *
+ *  The test is linked with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc so every allocation made by the program is
+ *  counted with countHeapAllocation from src/Matrix.h, on top of the aligned allocations which are always counted. Each
+ *  algorithm is run for a few iterations over the built in functions with the options which change the buffers of a
+ *  run, and the allocations the iterations made, recorded with recordHeapAllocations, must stay zero.
+ */
+#include "../Utilities.h"
+#include "../EquationHandlers.h"
+#include "../CpuFeatures.h"
+#include <pthread.h>
+#include <sys/stat.h>
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size){
+    countHeapAllocation();
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size){
+    countHeapAllocation();
+    return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size){
+    countHeapAllocation();
+    return __real_realloc(ptr, size);
+}
+
+/*!
+ * The ranges of the built in functions, in the order of the EquationsPosition enum in src/Utilities.h.
+ */
+static const double testRanges[NUM_BUILTIN_EQUATIONS][RANGE_SIZE] = {
+        {-512.0, 512.0}, {-100.0, 100.0}, {-100.0, 100.0}, {-30.0, 30.0}, {-500.0, 500.0}, {-30.0, 30.0},
+        {-30.0, 30.0}, {-32.0, 32.0}, {-32.0, 32.0}, {-500.0, 500.0}, {-500.0, 500.0}, {-100.0, 100.0},
+        {0.0, 3.14159265358979}, {-30.0, 30.0}, {-100.0, 100.0}, {-10.0, 10.0}, {-100.0, 100.0}, {-100.0, 100.0}
+};
+
+/*!
+ * The options of a single configuration of the test.
+ */
+typedef struct _HeapTestConfig{
+    char* name;
+    int layout;
+    int updateOrder;
+    int fitnessCache;
+    int memetic;
+}HeapTestConfig;
+
+static const HeapTestConfig testConfigs[] = {
+        {"Defaults", AutoLayout, SequentialUpdate, 0, 0},
+        {"Synchronous, dimension major", DimMajorLayout, SynchronousUpdate, 0, 0},
+        {"Synchronous, row major, cache and memetic", RowMajorLayout, SynchronousUpdate, 64, 5},
+        {"Sequential, dimension major and memetic", DimMajorLayout, SequentialUpdate, 0, 5}
+};
+
+static char* testNames[] = {"PSO", "FA", "H"};
+
+/// \fn static void fillInfo(Info* info)
+/// \brief Fills the Info struct with the parameters of src/init.txt, few vectors and few iterations.
+///
+/// \param info - the zeroed Info struct to be filled
+static void fillInfo(Info* info){
+    int dims[] = {10, 30}; /*!< The dimensions every run is tested with*/
+    info->numExperiments = 1;
+    info->numVectors = 20;
+    info->numDimensions = 2;
+    info->dimsToTest = calloc(info->numDimensions, sizeof(int));
+    memcpy(info->dimsToTest, dims, sizeof(dims));
+    info->numEquations = NUM_BUILTIN_EQUATIONS;
+    info->ranges = calloc(MAX_NUM_EQUATIONS, sizeof(double*));
+    for(int i = 0; i < MAX_NUM_EQUATIONS; i++){
+        info->ranges[i] = calloc(RANGE_SIZE, sizeof(double));
+        if(i < NUM_BUILTIN_EQUATIONS)
+            memcpy(info->ranges[i], testRanges[i], sizeof(testRanges[i]));
+    }
+    info->iterations = 10;
+    info->gamma = 0.00001;
+    info->alpha = 0.5;
+    info->beta = 0.2;
+    info->k = 0.3;
+    info->c1 = 0.8;
+    info->c2 = 1.2;
+    info->PAR = 0.2;
+    info->HMCR = 0.2;
+    info->bandwidth = 0.01;
+    info->seed = 471;
+    info->seedProvided = 1;
+}
+
+/// \fn int main()
+/// \brief Runs every algorithm with every configuration and fails when the iterations of any of them allocated.
+/// \return 0 when no iterations allocated, 1 otherwise.
+int main(){
+    Info info = {0}; /*!< The parameters shared by every configuration*/
+    long before, /*!< The allocations recorded before the configuration*/
+    after; /*!< The allocations recorded after it*/
+    int failures = 0; /*!< The number of configurations whose iterations allocated*/
+    long count = heapAllocationCount(); /*!< The allocations of this thread before the wrappers are checked*/
+    void* volatile probe = malloc(1); /*!< An allocation the wrapper must count, kept from being optimized away*/
+    free(probe);
+    if(heapAllocationCount() == count){
+        fprintf(stderr, "malloc was not counted, link the test with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc.\n");
+        return 1;
+    }
+    if(pthread_mutex_init(&mutex, NULL) != 0){
+        perror("There was an issue trying to initialize the mutex:");
+        return 1;
+    }
+    detectSimdLevel();
+    installEquationKernels(AutoKernels);
+    mkdir("../Results", 0755); ///the results of the runs are written next to the ones of the program
+    fillInfo(&info);
+    for(int c = 0; c < (int)(sizeof(testConfigs) / sizeof(testConfigs[0])); c++){
+        info.layout = testConfigs[c].layout;
+        info.updateOrder = testConfigs[c].updateOrder;
+        info.fitnessCache = testConfigs[c].fitnessCache;
+        info.memetic = testConfigs[c].memetic;
+        for(int t = ParticleSwarm; t <= Harmonic; t++){
+            info.testSelection = t;
+            readHeapAllocations(&before);
+            for(int eq = 0; eq < NUM_BUILTIN_EQUATIONS; eq++){
+                if(runEquationsAsThreads(eq, "Heap Allocation Test", &info) < 0){
+                    fprintf(stderr, "%s of equation %d could not be run.\n", testNames[t], eq);
+                    return 1;
+                }
+            }
+            readHeapAllocations(&after);
+            printf("%s (%s): %ld heap allocations in the iterations\n", testNames[t], testConfigs[c].name, after - before);
+            if(after != before)
+                failures++;
+        }
+    }
+    freeInfo(&info);
+    return failures > 0;
+}
@@ -9,7 +9,15 @@
 #include "Utilities.h"
 #include "MersenneMatrix.h"
 #include "HostCalls.h"
+#include "CpuFeatures.h"
+#include "SimdEquations.h"
+#include "Plugins.h"
+#include "Formulas.h"
+#include "Variants.h"
+#include "Summation.h"
+#include "Memetic.h"
 #include <fcntl.h>
+#include <inttypes.h>
 
 void lock(){
 #ifdef WIN32
@@ -31,7 +39,7 @@ void writeResultToFile(double bestFit, double worstFit, char* algorithm, int cur
     char filename [MAX_FILE_NAME_LEN], /*!< Declare the filename as a static char array of MAX_FILE_NAME_LENGTH defined in src/Utilities.h*/
             value[LINE_LENGTH];/*!< Declare the static char array of LINE_LENGTH size defined in src/Utilities.h which will store the values to be printed to the file*/
     lock();
-    sprintf(filename, "../Results/%d_Dimensions_results_%s.csv",info.dimToTest, algorithm); ///set the file name to our expected file
+    sprintf(filename, "../Results/%d_Dimensions_results_%s%s.csv",info.dimToTest, algorithm, info.replay ? "_replay" : ""); ///set the file name to our expected file, replays are kept apart from the full runs
     FILE* output = fopen(filename, "a+"); ///open the file in append mode
     if(!output){ ///if there is an error opening the file tell the user and exit failure
         fprintf(stderr, "There was an issue opening or creating %s. Make sure you have access to write to the directory.\n", filename);
@@ -44,10 +52,10 @@ void writeResultToFile(double bestFit, double worstFit, char* algorithm, int cur
     fclose(output); ///close the file
 }
 
-void writePopulationLogToFile(double** population, char* algorithm, int currIter, EquationInfo info){
+void writePopulationLogToFile(const Matrix* population, const int* slots, char* algorithm, int currIter, EquationInfo info){
     char filename [MAX_FILE_NAME_LEN], /*!< Declare the filename as a static char array of MAX_FILE_NAME_LENGTH defined in src/Utilities.h*/
             value[LINE_LENGTH];/*!< Declare the static char array of LINE_LENGTH size defined in src/Utilities.h which will store the values to be printed to the file*/
-    sprintf(filename, "../Results/%s_%d_Dimensions_log_%s.csv", info.equationName, info.dimToTest, algorithm); ///set the file name to our expected file
+    sprintf(filename, "../Results/%s_%d_Dimensions_log_%s%s.csv", info.equationName, info.dimToTest, algorithm, info.replay ? "_replay" : ""); ///set the file name to our expected file, replays are kept apart from the full runs
     FILE* output = fopen(filename, "a+"); ///open the file in append mode
     if(!output){ ///if there is an error opening the file tell the user and exit failure
         fprintf(stderr, "There was an issue opening or creating %s. Make sure you have access to write to the directory.\n", filename);
@@ -59,8 +67,9 @@ void writePopulationLogToFile(double** population, char* algorithm, int currIter
         /*!
          * Iterate through the dimensions of the row and write the value of the current dimension to the file.
          */
+        const Real* row = matrixRow(population, slots ? slots[i] : i); /*!< The row being written*/
         for(int j = 0; j < info.dimToTest; j++){
-            sprintf(value, ",%lf", population[i][j]);
+            sprintf(value, ",%lf", row[j]);
             fwrite(value, 1, strlen(value),output);
         }
         sprintf(value, "\n");
@@ -69,6 +78,39 @@ void writePopulationLogToFile(double** population, char* algorithm, int currIter
     fclose(output); ///close the file
 }
 
+void writeSeedManifest(char* algorithm, EquationInfo info){
+    char filename [MAX_FILE_NAME_LEN], /*!< Declare the filename as a static char array of MAX_FILE_NAME_LENGTH defined in src/Utilities.h*/
+            value[LINE_LENGTH];/*!< Declare the static char array of LINE_LENGTH size defined in src/Utilities.h which will store the values to be printed to the file*/
+    lock();
+    sprintf(filename, "../Results/seed_manifest_%s%s.csv", algorithm, info.replay ? "_replay" : ""); ///set the file name to our expected file
+    FILE* output = fopen(filename, "a+"); ///open the file in append mode
+    if(!output){ ///if there is an error opening the file tell the user and exit failure
+        fprintf(stderr, "There was an issue opening or creating %s. Make sure you have access to write to the directory.\n", filename);
+        exit(EXIT_FAILURE);
+    }
+    ///store the master seed, the position of the run and the seed derived for it to value to be written
+    sprintf(value, "%" PRIu64 ",%d,%s,%d,%d,%d,%" PRIu64 ",%d\n", info.seed, info.equationNum, info.equationName, info.dimIndex, info.dimToTest, info.currExperiment, info.cellSeed, info.printExperiment);
+    fwrite(value, 1, strlen(value),output); ///write this to the file
+    fclose(output); ///close the file
+    unlock();
+}
+
+void printCutShort(){
+    long evaluations, /*!< The bounded evaluations of every run*/
+    cutShort; /*!< The number of them which stopped early*/
+    readCutShort(&evaluations, &cutShort);
+    if(evaluations > 0)
+        printf("Evaluations cut short by the worst fitness: %ld of %ld (%.1f%%)\n", cutShort, evaluations, 100.0 * cutShort / evaluations);
+}
+
+void printCacheHits(){
+    long lookups, /*!< The vectors looked up in the cache of every run*/
+    hits; /*!< The number of them which were found*/
+    readCacheHits(&lookups, &hits);
+    if(lookups > 0)
+        printf("Candidates found in the fitness cache: %ld of %ld (%.1f%%)\n", hits, lookups, 100.0 * hits / lookups);
+}
+
 void printDArray(double* list, int size) {
     printf("[ ");///add a character indicating the start of an array to the buffer
     /*!
@@ -125,17 +167,6 @@ void printMatrix(double** matrix, int numRows, int numCols) {
     }
 }
 
-double** allocateEmptyMatrix(int popSize, int dimensions){
-    double** pop = calloc(popSize, sizeof(double*));///allocate space for population size number of pointers
-    /*!
-     * iterate for the population size and allocate space initializing the values to 0 for each pointer
-     */
-    for (int i = 0; i<popSize; i++){
-        pop[i] = calloc(dimensions, sizeof(double));
-    }
-    return pop;///return the pointer for your population
-}
-
 void copyArray(const double* in, double* out, int size){
     /*!
      * iterate through the array being copied, and store the value at the current position to that position in the new array
@@ -145,52 +176,507 @@ void copyArray(const double* in, double* out, int size){
     }
 }
 
-void copyMatrix(double** in, double** out, int height, int width){
+size_t runArenaBytes(int algorithm, int layout, int updateOrder, int numVectors, int dimensions, int cacheEntries, int memetic){
+    size_t values = arenaBlockBytes(numVectors, sizeof(double)), /*!< The size of an array with a value per vector*/
+    dimValues = arenaBlockBytes(dimensions, sizeof(double)), /*!< The size of an array with a value per dimension*/
+    bytes = arenaBlockBytes(1, sizeof(RandStream)) + RUN_ARENA_CONVERSIONS * dimValues; /*!< The generator and the rows of draws single precision converts through*/
     /*!
-     * iterate through the array being copied, and store the value at the current position to that position in the new array
+     * Add the population struct, its row pool and the arrays of the selected algorithm, matching what it allocates.
      */
-     for(int j = 0; j < height; j++) {
-         for (int i = 0; i < width; i++) {
-             out[j][i] = in[j][i];
-         }
-     }
+    if(algorithm == ParticleSwarm){
+        bytes += arenaBlockBytes(1, sizeof(Particle)) + rowPoolBytes(2 * numVectors, 2 * numVectors, dimensions) ///the positions and personal bests
+                 + arenaMatrixBytes(numVectors, dimensions) + 2 * values + 2 * dimValues; ///the velocities, both fitness arrays and the random scalars
+        if(useDimMajorLayout(layout, updateOrder, numVectors, dimensions)) ///the transposed matrices, the random scalars of every particle, the gathered rows and the log
+            bytes += 3 * arenaMatrixBytes(dimensions, numVectors) + arenaMatrixBytes(2 * dimensions, numVectors) + arenaMatrixBytes(numVectors, dimensions)
+                     + 2 * arenaBlockBytes(dimensions, sizeof(Real)) + arenaBlockBytes(numVectors, sizeof(int));
+        else ///the move logs, the ages of the fitness values and the particles gathered for a full evaluation
+            bytes += arenaBlockBytes(numVectors, sizeof(MoveLog)) + numVectors * moveLogBytes(dimensions) + 3 * arenaBlockBytes(numVectors, sizeof(int)) + values;
+    }
+    else if(algorithm == Firefly){
+        bytes += arenaBlockBytes(1, sizeof(FireflySwarm)) + rowPoolBytes(numVectors, 2 * numVectors + 1, dimensions) ///the fireflies, their snapshot and the scratch row
+                 + values + dimValues ///the fitness array and the random scalars
+                 + arenaMatrixBytes(numVectors, dimensions) + 2 * values + 2 * arenaBlockBytes(numVectors, sizeof(int)); ///the snapshot fitness and the candidates of a firefly
+        if(cacheEntries > 0) ///the cache, and the hashes and fitness of the candidates it did not hold
+            bytes += fitnessCacheBytes(cacheEntries, dimensions) + arenaBlockBytes(numVectors, sizeof(uint64_t)) + arenaBlockBytes(numVectors, sizeof(int)) + values;
+    }
+    else{
+        bytes += arenaBlockBytes(1, sizeof(HPop)) + rowPoolBytes(numVectors, numVectors + 1, dimensions) ///the harmonies and the scratch row
+                 + values + arenaBlockBytes(HARMONIC_RANDS_PER_DIM * dimensions, sizeof(double)) + arenaBlockBytes(dimensions, sizeof(int)) ///the fitness array and the random draws
+                 + arenaBlockBytes(numVectors, sizeof(int)) + arenaBlockBytes(1, sizeof(MoveLog)) + moveLogBytes(dimensions); ///the ages of the fitness values and the move log
+        bytes += fitnessCacheBytes(cacheEntries, dimensions);
+    }
+    if(memetic > 0) ///the points, gradients and remembered steps of the refinement
+        bytes += memeticBytes(dimensions);
+    return bytes;
 }
 
-void allocateHPop(HPop* pop, int popSize){
+void allocateHPop(HPop* pop, Arena* arena, int popSize, int dimensions){
     ///the fitness array storing fitness values for the population is allocated
-    pop->fitness = calloc(popSize, sizeof(double));
+    pop->fitness = arenaAlloc(arena, popSize, sizeof(double));
+    ///the buffers for the random values pre-generated each iteration are allocated
+    pop->randBuf = arenaAlloc(arena, HARMONIC_RANDS_PER_DIM * dimensions, sizeof(double));
+    pop->randIdx = arenaAlloc(arena, dimensions, sizeof(int));
+    ///the number of deltas the fitness of every harmony was built from, used when the harmonies are evaluated by their delta
+    pop->moveAge = arenaAlloc(arena, popSize, sizeof(int));
+}
+
+int useDimMajorLayout(int layout, int updateOrder, int numVectors, int dimensions){
+    if(layout == AutoLayout)
+        return updateOrder == SynchronousUpdate && dimensions <= SOA_MAX_DIMENSIONS && numVectors >= SOA_MIN_POPULATION;
+    return layout == DimMajorLayout;
 }
 
 void createParticles(Particle* particles, int numVectors, int dimensions, EquationInfo info){
-    particles->population = createMatrix(info); ///Create a random population matrix
+    particles->swarm = createRowPool(info.arena, 2 * numVectors, 2 * numVectors, dimensions); ///a row for every position and personal best
+    Matrix initial = poolMatrix(&particles->swarm, numVectors); /*!< The rows of the position slots*/
+    createMatrix(info, &initial); ///Create a random population in the rows of the position slots
     particles->velocities = createVelocities(info); ///create random initial velocities for the population
-    particles->personalBest = allocateEmptyMatrix(numVectors, dimensions); ///allocate an empty matrix to store the personal best particles
-    copyMatrix(particles->population, particles->personalBest,numVectors, dimensions); ///copy the initial matrix into the personal best matrix
-    particles->fitness = calloc(numVectors, sizeof(double)); ///allocate the fitness array
-    particles->pBestFit = calloc(numVectors, sizeof(double)); ///allocate the array storing personal best fitness
+    /*!
+     * Every personal best starts out as the particle itself, so it shares the row instead of copying it.
+     */
+    for(int i = 0; i < numVectors; i++)
+        shareSlot(&particles->swarm, numVectors + i, i);
+    particles->fitness = arenaAlloc(info.arena, numVectors, sizeof(double)); ///allocate the fitness array
+    particles->pBestFit = arenaAlloc(info.arena, numVectors, sizeof(double)); ///allocate the array storing personal best fitness
+    particles->rng = info.rng; ///the particles draw from the generator owned by the running thread
+    particles->randBuf = arenaAlloc(info.arena, 2 * dimensions, sizeof(double)); ///allocate the buffer for the random scalars pre-generated per particle
+    particles->dimMajor = useDimMajorLayout(info.layout, info.updateOrder, numVectors, dimensions);
+    particles->sequential = info.updateOrder == SequentialUpdate;
+    /*!
+     * If the matrices will be stored dimension major allocate the buffers only that layout uses. The matrices themselves
+     * are transposed by the algorithm once the initial population has been evaluated.
+     */
+    if(particles->dimMajor){
+        particles->randoms = arenaMatrix(info.arena, 2 * dimensions, numVectors); ///the random scalars of every particle, one row per term and dimension
+        particles->scratch = arenaAlloc(info.arena, dimensions, sizeof(Real)); ///a single particle gathered from its column for evaluation
+        particles->gBestRow = arenaAlloc(info.arena, dimensions, sizeof(Real)); ///the global best particle at the start of an iteration
+        particles->improved = arenaAlloc(info.arena, numVectors, sizeof(int)); ///which particles improved their personal best in an iteration
+    }
+    /*!
+     * A row major swarm logs the coordinates every particle changes so sparse moves are evaluated by their delta, and
+     * gathers the rest into a single batch.
+     */
+    else if((particles->moves = createMoveLogs(info, numVectors))){
+        particles->moveAge = arenaAlloc(info.arena, numVectors, sizeof(int)); ///the number of deltas every fitness was built from
+        particles->denseRows = arenaAlloc(info.arena, numVectors, sizeof(int)); ///the rows of the particles evaluated in full
+        particles->densePos = arenaAlloc(info.arena, numVectors, sizeof(int)); ///the positions of the particles evaluated in full
+        particles->denseFit = arenaAlloc(info.arena, numVectors, sizeof(double)); ///the fitness of the particles evaluated in full
+    }
+}
+
+void installEquationKernels(int selection){
+    static const char* levelNames[] = {"Scalar", "SSE2", "AVX2", "AVX512"}; /*!< The name of every SimdLevel*/
+    int supported = detectSimdLevel(), /*!< The widest instruction set of the processor*/
+    level = selection == AutoKernels ? supported : selection - ScalarKernels; /*!< The SimdLevel of the selected kernels*/
+    if(level > supported){ ///the processor cannot run the selected kernels, use the widest it can
+        printf("The %s objective kernels are not supported by this processor, using %s.\n", levelNames[level], levelNames[supported]);
+        level = supported;
+    }
+    /*!
+     * Replace every built in function with its kernel, keeping the scalar reference where there is none.
+     */
+    for(int i = 0; i < NUM_BUILTIN_EQUATIONS; i++){
+        const void* kernel = equationKernel(level, i); /*!< The kernel of this function, NULL for the scalar level*/
+        if(kernel)
+            equationHostCalls[i] = kernel;
+        if((kernel = equationPartKernel(level, i)))
+            equationPartCalls[i] = kernel;
+        equationBatchCalls[i] = equationBatchKernel(level, i);
+        for(int slot = 0; slot < FIXED_DIMENSION_COUNT; slot++){
+            equationFixedCalls[i][slot] = equationFixedKernel(level, i, slot);
+            equationFixedBatchCalls[i][slot] = equationFixedBatchKernel(level, i, slot);
+        }
+    }
+    installFormulaRunner(formulaKernel(level));
+    installVariantKernels(rotationKernel(level));
+    printf("Objective kernels: %s%s\n", levelNames[level], level > SimdScalar ? ", fixed size kernels for 10, 20, 30 and 50 dimensions" : "");
+}
+
+/*!
+ * The function evaluating a single vector of the given size, its fixed size kernel if there is one.
+ */
+static EquationFunction equationCall(int equation, int dimensions){
+    int slot = fixedDimensionSlot(dimensions); /*!< The slot of the fixed size kernels of the size, -1 if there are none*/
+    if(slot >= 0 && equationFixedCalls[equation][slot])
+        return (EquationFunction)equationFixedCalls[equation][slot];
+    return (EquationFunction)equationHostCalls[equation];
+}
+
+/*!
+ * How a built in function is evaluated in parts. The functions with an entry in equationPartCalls run it on every part,
+ * and the others their kernel of any size, a part of pair terms taking the first element of the next part as well, and
+ * scaled by the number of dimensions over the number of terms of the part when the sum is scaled by the number of
+ * dimensions.
+ */
+typedef struct _SplitForm{
+    int pairs;
+    int scaled;
+    int product; /*!< Whether the product of the parts is subtracted from the sum of the parts*/
+}SplitForm;
+
+//! The parts of the objective functions, in the order of the EquationPosition enum
+/*!
+ * Schwefel's constant is a sum over every element and the signs of Sine Envelope, Michalewicz and Masters' Cosine Wave
+ * distribute over the sum, so a part of each is the function itself on the elements of the part.
+ */
+static const SplitForm splitForms[NUM_BUILTIN_EQUATIONS] = {
+    {0, 0, 0}, /*!< Schwefel*/
+    {0, 0, 0}, /*!< DeJong*/
+    {1, 0, 0}, /*!< Rosenbrock*/
+    {0, 1, 0}, /*!< Rastgrin, scaled by the number of dimensions*/
+    {0, 0, 1}, /*!< Griewangk, a sum less a product over the index of every element*/
+    {1, 0, 0}, /*!< Sine Envelope*/
+    {1, 0, 0}, /*!< Stretched V*/
+    {1, 0, 0}, /*!< Ackley One*/
+    {1, 0, 0}, /*!< Ackley Two*/
+    {1, 0, 0}, /*!< EggHolder*/
+    {1, 0, 0}, /*!< Rana*/
+    {1, 0, 0}, /*!< Pathological*/
+    {0, 0, 0}, /*!< Michalewicz, the terms depend on their index*/
+    {1, 0, 0}, /*!< Masters' Cosine Wave*/
+    {0, 0, 0}, /*!< Quartic, the terms depend on their index*/
+    {1, 0, 0}, /*!< Levy, the ends of the vector are added to every term*/
+    {0, 0, 0}, /*!< Step*/
+    {0, 0, 0} /*!< Alpine*/
+};
+
+/*!
+ * A vector being evaluated in parts, shared with the workers of the work pool which each evaluate a range of its parts.
+ */
+typedef struct _SplitJob{
+    const SplitForm* form;
+    EquationFunction anySize; /*!< The kernel of any size of the function*/
+    EquationPart part; /*!< The part of the function, NULL to run the kernel on every part*/
+    const Real* vector;
+    int dimensions;
+    int terms; /*!< The number of terms of the function*/
+    int block; /*!< The number of terms of every part but the last*/
+    double sums[MAX_SPLIT_BLOCKS]; /*!< The sum of every part*/
+    double products[MAX_SPLIT_BLOCKS]; /*!< The product of every part*/
+}SplitJob;
+
+static void evaluatePartRange(void* context, int begin, int end){
+    SplitJob* job = context;
+    const SplitForm* form = job->form; /*!< How the function is split*/
+    for(int b = begin; b < end; b++){
+        int start = b * job->block, /*!< The first term of the part*/
+        count = job->terms - start < job->block ? job->terms - start : job->block; /*!< The terms in the part*/
+        job->products[b] = 1.0;
+        if(job->part)
+            job->sums[b] = job->part(job->vector, job->dimensions, start, start + count, &job->products[b]);
+        else if(form->scaled)
+            job->sums[b] = job->anySize(job->vector + start, count) * ((double)job->dimensions / count);
+        else
+            job->sums[b] = job->anySize(job->vector + start, count + form->pairs);
+    }
+}
+
+double evaluateSplit(int equation, const Real* vector, int numDim){
+    SplitJob job; /*!< The parts shared with the work pool*/
+    int blocks; /*!< The number of parts*/
+    double sum; /*!< The sum of the parts*/
+    job.form = &splitForms[equation];
+    job.anySize = equationHostCalls[equation];
+    job.part = equationPartCalls[equation];
+    job.vector = vector;
+    job.dimensions = numDim;
+    job.terms = job.form->pairs ? numDim - 1 : numDim;
+    job.block = (job.terms + MAX_SPLIT_BLOCKS - 1) / MAX_SPLIT_BLOCKS;
+    if(job.block < SPLIT_BLOCK_DIMENSIONS)
+        job.block = SPLIT_BLOCK_DIMENSIONS;
+    job.block = (job.block + BOUND_BLOCK_DIMENSIONS - 1) / BOUND_BLOCK_DIMENSIONS * BOUND_BLOCK_DIMENSIONS; ///whole blocks of the kernels, so every part starts on the same boundary
+    blocks = (job.terms + job.block - 1) / job.block;
+    parallelFor(blocks, 1, evaluatePartRange, &job);
+    /*!
+     * Add the parts together pairwise, so the order of the additions never depends on which thread evaluated which part,
+     * and multiply the products of the parts in the same fixed order.
+     */
+    for(int b = 1; b < blocks; b++)
+        job.products[0] *= job.products[b];
+    sum = pairwiseSum(job.sums, blocks);
+    return job.form->product ? sum - job.products[0] : sum;
+}
+
+/*!
+ * Defines the EquationFunction evaluating a built in function in parts with evaluateSplit. They take no context, so
+ * every function has its own.
+ */
+#define SPLIT_EQUATION(equation) \
+static double splitEvaluate##equation(const Real* vector, int numDim){ \
+    return evaluateSplit(equation, vector, numDim); \
+}
+
+SPLIT_EQUATION(Schwefel)
+SPLIT_EQUATION(DeJong)
+SPLIT_EQUATION(Rosenbrock)
+SPLIT_EQUATION(Rastgrin)
+SPLIT_EQUATION(Griewangk)
+SPLIT_EQUATION(SineEnvelope)
+SPLIT_EQUATION(StretchedWave)
+SPLIT_EQUATION(AckleyOne)
+SPLIT_EQUATION(AckleyTwo)
+SPLIT_EQUATION(EggHolder)
+SPLIT_EQUATION(Rana)
+SPLIT_EQUATION(Pathological)
+SPLIT_EQUATION(Michalewicz)
+SPLIT_EQUATION(MastersCosineWave)
+SPLIT_EQUATION(Quartic)
+SPLIT_EQUATION(Levy)
+SPLIT_EQUATION(Step)
+SPLIT_EQUATION(Alpine)
+
+#undef SPLIT_EQUATION
+
+//! The functions evaluating every built in function in parts, in the order of the EquationPosition enum
+static const EquationFunction splitEvaluates[NUM_BUILTIN_EQUATIONS] = {
+    &splitEvaluateSchwefel, &splitEvaluateDeJong, &splitEvaluateRosenbrock, &splitEvaluateRastgrin,
+    &splitEvaluateGriewangk, &splitEvaluateSineEnvelope, &splitEvaluateStretchedWave, &splitEvaluateAckleyOne,
+    &splitEvaluateAckleyTwo, &splitEvaluateEggHolder, &splitEvaluateRana, &splitEvaluatePathological,
+    &splitEvaluateMichalewicz, &splitEvaluateMastersCosineWave, &splitEvaluateQuartic, &splitEvaluateLevy,
+    &splitEvaluateStep, &splitEvaluateAlpine
+};
+
+Objective resolveObjective(int equation, int dimensions){
+    Objective objective; /*!< Declare the functions of the run to be returned*/
+    int slot = fixedDimensionSlot(dimensions); /*!< The slot of the fixed size kernels of the size, -1 if there are none*/
+    if(equation >= FIRST_VARIANT_EQUATION) ///a shifted, rotated, hybrid or composition variant
+        return variantObjective(equation, dimensions);
+    if(equation >= FIRST_FORMULA_EQUATION) ///an objective formula
+        return formulaObjective(equation, dimensions);
+    if(equation >= NUM_BUILTIN_EQUATIONS) ///the function of an objective plugin
+        return pluginObjective(equation, dimensions);
+    objective.equation = equation;
+    objective.dimensions = dimensions;
+    objective.function = dimensions >= SPLIT_VECTOR_DIMENSIONS ? splitEvaluates[equation] : equationCall(equation, dimensions); ///a vector this long is shared with the work pool
+    objective.anySize = equationHostCalls[equation];
+    objective.batch = slot >= 0 && equationFixedBatchCalls[equation][slot] ? equationFixedBatchCalls[equation][slot] : equationBatchCalls[equation];
+    objective.rows = NULL;
+    objective.delta = deltaFunction(equation);
+    objective.gradient = gradientFunction(equation);
+    return objective;
+}
+
+int equationInRun(const Info* info, int equation){
+    if(equation < NUM_BUILTIN_EQUATIONS)
+        return equation < info->numEquations;
+    if(equation < FIRST_FORMULA_EQUATION)
+        return equation - NUM_BUILTIN_EQUATIONS < info->numPlugins;
+    if(equation < FIRST_VARIANT_EQUATION)
+        return equation - FIRST_FORMULA_EQUATION < info->numFormulas;
+    return equation - FIRST_VARIANT_EQUATION < info->numVariants;
 }
 
-double evaluateFitness(double* firefly, int dimensions, int equation){
-    double(*eqFunction)(); /*!< Declare a function pointer of type double to represent the current equation to be used*/
-    eqFunction = equationHostCalls[equation]; /*!< Set the function to the appropriate function reference defined above*/
-    return eqFunction(firefly, dimensions); ///return the result of the calculation on the vector
+MoveLog* createMoveLogs(EquationInfo info, int count){
+    if(info.delta == DeltaOff || !info.objective.delta)
+        return NULL;
+    MoveLog* logs = arenaAlloc(info.arena, count, sizeof(MoveLog)); /*!< The log of every vector*/
+    for(int i = 0; i < count; i++)
+        logs[i] = createMoveLog(info.arena, info.dimToTest);
+    return logs;
+}
+
+int moveIsSparse(const MoveLog* log, int baseAge){
+    return log->count == 0 || (log->count > 0 && baseAge < DELTA_REFRESH_MOVES);
+}
+
+double evaluateMove(const Real* vector, const Objective* objective, const MoveLog* log, double baseFit, int baseAge, int* age){
+    /*!
+     * A vector the move left unchanged keeps its fitness, a sparse move adds its delta and anything else is evaluated in full.
+     */
+    if(log->count == 0){
+        *age = baseAge;
+        return baseFit;
+    }
+    if(moveIsSparse(log, baseAge)){
+        *age = baseAge + 1;
+        return objective->delta(vector, objective->dimensions, log, baseFit);
+    }
+    *age = 0;
+    return objective->function(vector, objective->dimensions);
 }
 
-void evaluatePop(double** pop, double* fitness, int popSize, int dimensions, int equation, int* objBestPos, int* objWorstPos, double* objBestFit, double* objWorstFit){
+/*!
+ * The arguments of a batch, shared with the workers of the work pool which each evaluate a range of its vectors.
+ */
+typedef struct _BatchJob{
+    const Matrix* vectors;
+    const int* slots;
+    const Objective* objective;
+    double* fitness;
+    Real* scratch;
+    double bound;
+    int* cutShort;
+}BatchJob;
+
+/*!
+ * How a function is evaluated in blocks of BOUND_BLOCK_DIMENSIONS elements. The kernel run on a block gives the part of
+ * the fitness from the terms of that block, and no term adds less than minTerm to the fitness.
+ */
+typedef struct _BoundForm{
+    int supported;
+    int pairs;
+    double minTerm;
+}BoundForm;
+
+//! The blocks of the objective functions, in the order of the EquationPosition enum
+/*!
+ * Functions with an unbounded term, a scale or constant depending on the number of dimensions, or terms depending on
+ * their index or on the ends of the vector are always evaluated in full.
+ */
+static const BoundForm boundForms[MAX_NUM_EQUATIONS] = {
+    {0, 0, 0.0}, /*!< Schwefel, the terms are only bounded by the range*/
+    {1, 0, 0.0}, /*!< DeJong, squares*/
+    {1, 1, 0.0}, /*!< Rosenbrock, sums of squares*/
+    {0, 0, 0.0}, /*!< Rastgrin, scaled by the number of dimensions*/
+    {0, 0, 0.0}, /*!< Griewangk, a product over every element*/
+    {1, 1, -1.5}, /*!< Sine Envelope, -0.5 minus a sine over at least 1*/
+    {0, 1, 0.0}, /*!< Stretched V, the terms are only bounded by the range*/
+    {1, 1, -6.0}, /*!< Ackley One, a root plus three times a cosine and a sine*/
+    {1, 1, 0.0}, /*!< Ackley Two, 20 + e less at most 20 and e*/
+    {0, 1, 0.0}, /*!< EggHolder, the terms are only bounded by the range*/
+    {0, 1, 0.0}, /*!< Rana, the terms are only bounded by the range*/
+    {1, 1, -1.0}, /*!< Pathological, 0.5 plus a sine less 0.5 over at least 1*/
+    {0, 0, 0.0}, /*!< Michalewicz, the terms depend on their index*/
+    {1, 1, -1.0}, /*!< Masters' Cosine Wave, minus an exponential of at most 1 times a cosine*/
+    {0, 0, 0.0}, /*!< Quartic, the terms depend on their index*/
+    {0, 0, 0.0}, /*!< Levy, the ends of the vector are added to every term*/
+    {1, 0, 0.0}, /*!< Step, squares*/
+    {1, 0, 0.0} /*!< Alpine, absolute values*/
+};
+
+int canCutShort(const Objective* objective, double bound){
+    return boundForms[objective->equation].supported && objective->dimensions > BOUND_BLOCK_DIMENSIONS &&
+           objective->dimensions < SPLIT_VECTOR_DIMENSIONS && !isinf(bound);
+}
+
+double evaluateBounded(const Real* vector, const Objective* objective, double bound, int* cutShort){
+    const BoundForm* form = &boundForms[objective->equation]; /*!< How the function is split into blocks*/
+    int dimensions = objective->dimensions, /*!< The number of dimensions in the vector*/
+    terms = form->pairs ? dimensions - 1 : dimensions; /*!< The number of terms in the sum*/
+    CompensatedSum partial = {0.0, 0.0}; /*!< The fitness of the blocks evaluated so far*/
+    *cutShort = 0;
+    if(!canCutShort(objective, bound))
+        return objective->function(vector, dimensions);
+    /*!
+     * Evaluate the terms a block at a time, a block of pair terms taking the first element of the next block as well,
+     * and stop once even the lowest the remaining terms can add leaves the fitness above the bound.
+     */
+    for(int start = 0; start < terms; start += BOUND_BLOCK_DIMENSIONS){
+        int count = terms - start < BOUND_BLOCK_DIMENSIONS ? terms - start : BOUND_BLOCK_DIMENSIONS, /*!< The terms in this block*/
+        remaining = terms - start - count; /*!< The terms after this block*/
+        addCompensated(&partial, objective->anySize(vector + start, count + form->pairs));
+        if(remaining > 0 && compensatedTotal(&partial) + form->minTerm * remaining > bound){
+            *cutShort = 1;
+            return compensatedTotal(&partial) + form->minTerm * remaining; ///the lowest the fitness can be, which is above the bound
+        }
+    }
+    return compensatedTotal(&partial);
+}
+
+static int batchGrain(int dimensions){
+    int grain = BATCH_THREAD_VALUES / (dimensions > 0 ? dimensions : 1); /*!< The vectors holding BATCH_THREAD_VALUES values*/
+    return (grain + MATRIX_ALIGN_VALUES - 1) / MATRIX_ALIGN_VALUES * MATRIX_ALIGN_VALUES; ///whole groups, so every range of a dimension major batch starts on a padded boundary
+}
+
+static void evaluateRowRange(void* context, int begin, int end){
+    const BatchJob* job = context;
+    int dimensions = job->vectors->cols; /*!< The number of dimensions of every vector*/
+    EquationBatch batch = job->objective->batch; /*!< The batch kernel of the equation, if there is one*/
+    EquationFunction eqFunction = job->objective->function; /*!< The function evaluating a single vector*/
+    EquationRows rows = job->objective->rows; /*!< The batch function of an objective plugin, if there is one*/
+    if(rows){
+        const Real* group[ROW_BATCH_VECTORS]; /*!< The rows of a group of vectors*/
+        /*!
+         * Pass every group of up to ROW_BATCH_VECTORS vectors to the plugin together, as the rows they are stored in.
+         */
+        for(int v = begin; v < end; v += ROW_BATCH_VECTORS){
+            int count = end - v < ROW_BATCH_VECTORS ? end - v : ROW_BATCH_VECTORS; /*!< The vectors in this group*/
+            for(int k = 0; k < count; k++)
+                group[k] = matrixRow(job->vectors, job->slots ? job->slots[v + k] : v + k);
+            rows(group, count, dimensions, job->fitness + v);
+        }
+    }else if(batch && dimensions <= BATCH_TILE_DIMENSIONS && end - begin > 1){
+        Real tile[BATCH_TILE_DIMENSIONS * MATRIX_ALIGN_VALUES]; /*!< A group of vectors stored one row per dimension*/
+        /*!
+         * Gather every group of MATRIX_ALIGN_VALUES vectors into the tile, padding the last one with zeros, and
+         * evaluate the whole group with the batch kernel.
+         */
+        for(int v = begin; v < end; v += MATRIX_ALIGN_VALUES){
+            int count = end - v < MATRIX_ALIGN_VALUES ? end - v : MATRIX_ALIGN_VALUES; /*!< The vectors in this group*/
+            for(int k = 0; k < MATRIX_ALIGN_VALUES; k++){
+                const Real* row = k < count ? matrixRow(job->vectors, job->slots ? job->slots[v + k] : v + k) : NULL;
+                for(int j = 0; j < dimensions; j++)
+                    tile[j * MATRIX_ALIGN_VALUES + k] = row ? row[j] : 0;
+            }
+            batch(tile, MATRIX_ALIGN_VALUES, count, dimensions, job->fitness + v);
+        }
+    }else if(job->cutShort){
+        for(int v = begin; v < end; v++)
+            job->fitness[v] = evaluateBounded(matrixRow(job->vectors, job->slots ? job->slots[v] : v), job->objective, job->bound, &job->cutShort[v]);
+    }else{
+        for(int v = begin; v < end; v++)
+            job->fitness[v] = eqFunction(matrixRow(job->vectors, job->slots ? job->slots[v] : v), dimensions);
+    }
+}
+
+static void evaluateColumnRange(void* context, int begin, int end){
+    const BatchJob* job = context;
+    const Matrix* columns = job->vectors; /*!< The vectors, one per column*/
+    EquationBatch batch = job->objective->batch; /*!< The batch kernel of the equation, if there is one*/
+    EquationFunction eqFunction = job->objective->function; /*!< The function evaluating a single vector*/
+    if(batch){
+        batch(columns->data + begin, columns->stride, end - begin, columns->rows, job->fitness + begin);
+        return;
+    }
+    for(int v = begin; v < end; v++){
+        for(int j = 0; j < columns->rows; j++)
+            job->scratch[j] = matrixRow(columns, j)[v];
+        job->fitness[v] = eqFunction(job->scratch, columns->rows);
+    }
+}
+
+void evaluateBatch(const Matrix* vectors, const int* slots, int count, const Objective* objective, double* fitness){
+    BatchJob job = {vectors, slots, objective, fitness, NULL, INFINITY, NULL}; /*!< The batch shared with the work pool*/
+    parallelFor(count, batchGrain(vectors->cols), evaluateRowRange, &job);
+}
+
+int evaluateBatchBounded(const Matrix* vectors, const int* slots, int count, const Objective* objective, double bound, double* fitness, int* cutShort){
+    BatchJob job = {vectors, slots, objective, fitness, NULL, bound, cutShort}; /*!< The batch shared with the work pool*/
+    int total = 0; /*!< The number of vectors cut short*/
+    if(!canCutShort(objective, bound)){ ///nothing can be cut short, so the batch kernels are used as they are
+        evaluateBatch(vectors, slots, count, objective, fitness);
+        return 0;
+    }
+    parallelFor(count, batchGrain(vectors->cols), evaluateRowRange, &job);
+    for(int i = 0; i < count; i++)
+        total += cutShort[i];
+    return total;
+}
+
+void evaluateColumns(const Matrix* columns, const Objective* objective, double* fitness, Real* scratch){
+    BatchJob job = {columns, NULL, objective, fitness, scratch, INFINITY, NULL}; /*!< The batch shared with the work pool*/
+    if(!objective->batch){ ///every vector is gathered into the single scratch buffer, so it stays on this thread
+        evaluateColumnRange(&job, 0, columns->cols);
+        return;
+    }
+    parallelFor(columns->cols, batchGrain(columns->rows), evaluateColumnRange, &job);
+}
+
+void evaluatePop(const Matrix* pop, double* fitness, const Objective* objective, int* objBestPos, int* objWorstPos, double* objBestFit, double* objWorstFit){
     double bestFit = 0, /*!< Initialize the best fitness to 0*/
             worstFit = 0, /*!< Initialize the worst fitness to 0*/
             currFit = 0; /*!< Initialize the current fitness to 0*/
     int bestPos = 0, /*!< Initialize the position of the best fitness to 0*/
             worstPos = 0; /*!< Initialize the position of the worst fitness to 0*/
     /*!
-     * Iterate through the population, evaluate the fitness of the current vector, store that fitness, and if its the first iteration
+     * Evaluate the whole population in a single batch, then iterate through it and if its the first iteration
      * store this as the best and worst fitness to be compared against. Otherwise for other iterations if it is less than the best fitness
      * save this value and position as the best otherwise if it is greater than the worst fitness store this value and
      * position as the worst.
      */
-    for (int i = 0; i < popSize; i++){
-        currFit = evaluateFitness(pop[i], dimensions, equation);
-        fitness[i] = currFit;
+    evaluateBatch(pop, NULL, pop->rows, objective, fitness);
+    for (int i = 0; i < pop->rows; i++){
+        currFit = fitness[i];
         if(i == 0){
             bestFit = currFit;
             worstFit = currFit;
@@ -246,25 +732,7 @@ void freeMatrix(double** matrix, int height){
 void freeInfo(Info* info){
     free(info->dimsToTest); ///free the pointer storing the dimensions which will be tested as part of the program
     if(info->ranges != NULL) {///if ranges exists free the matrix of ranges
-        freeMatrix(info->ranges, info->numEquations);
+        freeMatrix(info->ranges, MAX_NUM_EQUATIONS);
         free(info->ranges);
     }
 }
-
-void freeHPop(HPop* pop, int popSize){
-    freeMatrix(pop->population, popSize); ///free the population matrix
-    free(pop->fitness); ///free the fitness array
-}
-
-void freeFireflySwarm(FireflySwarm* pop, int popSize){
-    freeMatrix(pop->population, popSize); ///free the population matrix
-    free(pop->fitness); ///free the fitness array
-}
-
-void freeParticles(Particle* particles, int popSize){
-    free(particles->pBestFit); ///free the array of personal best fitness values
-    free(particles->fitness); ///free the array of fitness values
-    freeMatrix(particles->population, popSize); ///free the population matrix
-    freeMatrix(particles->personalBest, popSize); ///free the personal best population matrix
-    freeMatrix(particles->velocities, popSize); ///free the velocities matrix
-}
\ No newline at end of file
@@ -9,6 +9,15 @@
 #ifndef TESTINGSUITE_UTILITIES_H
 #define TESTINGSUITE_UTILITIES_H
 #include "Equations.h"
+#include "m19937ar-cok.h"
+#include "BulkRandom.h"
+#include "CounterRandom.h"
+#include "Matrix.h"
+#include "Arena.h"
+#include "RowPool.h"
+#include "DeltaEquations.h"
+#include "FitnessCache.h"
+#include "Gradients.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -26,17 +35,38 @@
 #define RANGE_MIN_POS 0 /*!< declare a constant representing the location of the minimum value in the range*/
 #define RANGE_MAX_POS 1 /*!< declare a constant representing the location of the maximum value in the range*/
 #define LINE_LENGTH 10000 /*!< declare a constant for reading in lines of a certain length for the input file*/
-#define MAX_NUM_EQUATIONS 18 /*!< declare the constant for the maximum number of equations being evaluated*/
+#define NUM_BUILTIN_EQUATIONS 18 /*!< declare the constant for the number of equations built into the program*/
+#define MAX_NUM_PLUGINS 8 /*!< declare the constant for the most objective plugins loaded, each with a PLUGIN_SLOT in src/Plugins.c*/
+#define MAX_NUM_FORMULAS 8 /*!< declare the constant for the most objective formulas compiled, each with a FORMULA_SLOT in src/Formulas.c*/
+#define FIRST_FORMULA_EQUATION (NUM_BUILTIN_EQUATIONS + MAX_NUM_PLUGINS) /*!< declare the constant for the position of the first objective formula*/
+#define MAX_NUM_VARIANTS 8 /*!< declare the constant for the most shifted, rotated, hybrid and composition variants, each with a VARIANT_SLOT in src/Variants.c*/
+#define FIRST_VARIANT_EQUATION (FIRST_FORMULA_EQUATION + MAX_NUM_FORMULAS) /*!< declare the constant for the position of the first variant*/
+#define MAX_NUM_EQUATIONS (FIRST_VARIANT_EQUATION + MAX_NUM_VARIANTS) /*!< declare the constant for the maximum number of equations being evaluated*/
 #define MAX_FILE_NAME_LEN 255 /*!< declare the constant for creating the filename string*/
 #define DEFAULT_INIT_FILE "../src/init.txt" /*!< declare the constant representing the default input file location for the program*/
 #define FILE_ARGUMENT 1 /*!< declare the constant for the */
 #define NS_PER_MS 1000000 /*!< declare the constant for converting nanoseconds to milliseconds*/
 #define MS_PER_SEC 1000 /*!< declare the constant to convert milliseconds to seconds*/
+#define RAND_INIT_ITERATION 0xFFFFFFFFU /*!< declare the constant for the iteration used to address random values drawn before the first iteration*/
+#define HARMONIC_RANDS_PER_DIM 3 /*!< declare the constant for the number of random scalars pre-generated per dimension each harmonic iteration*/
+#define SOA_MAX_DIMENSIONS 10 /*!< declare the constant for the most dimensions the automatic layout stores dimension major*/
+#define SOA_MIN_POPULATION 16 /*!< declare the constant for the fewest particles the automatic layout stores dimension major*/
+#define RUN_ARENA_CONVERSIONS 2 /*!< declare the constant for the most rows of draws a single precision run converts through*/
+#define BYTES_PER_MB (1024 * 1024) /*!< declare the constant to convert megabytes to bytes*/
+#define BATCH_TILE_DIMENSIONS 64 /*!< declare the constant for the most dimensions a batch of separate rows is evaluated one lane per vector*/
+#define BATCH_THREAD_VALUES 8192 /*!< declare the constant for the number of values a worker evaluates at a time when a batch is shared*/
+#define BOUND_BLOCK_DIMENSIONS 64 /*!< declare the constant for the number of terms a bounded evaluation adds up between checks against its bound*/
+#define SPLIT_VECTOR_DIMENSIONS 65536 /*!< declare the constant for the fewest dimensions a single vector of a built in function is evaluated in parts shared with the work pool*/
+#define SPLIT_BLOCK_DIMENSIONS 16384 /*!< declare the constant for the fewest terms in every part of a vector evaluated in parts*/
+#define MAX_SPLIT_BLOCKS 256 /*!< declare the constant for the most parts a vector is evaluated in*/
+#define ROW_BATCH_VECTORS 64 /*!< declare the constant for the most vectors passed to the batch function of a plugin at a time*/
 
 
 /*!
  * The enum which represents the position of the different functions utilized through the application.
- * Referenced in src/EquationHandlers.c, and src/EquationHandlers32.c
+ * Referenced in src/EquationHandlers.c, and src/EquationHandlers32.c. The functions of the objective plugins take the
+ * positions from NUM_BUILTIN_EQUATIONS on, the objective formulas the positions from FIRST_FORMULA_EQUATION on and the
+ * variants of src/Variants.h the positions from FIRST_VARIANT_EQUATION on.
  */
 enum EquationPosition{
     Schwefel,
@@ -66,6 +96,93 @@ enum TestType{
     ParticleSwarm, Firefly, Harmonic
 };
 
+/*!
+ * enum representing how the random values used by the algorithms are generated, selected in the init file
+ */
+enum RandomMode{
+    StreamGenerator, /*!< Values are drawn in order from the bulk generator of the thread*/
+    CounterGenerator /*!< Values are computed from their address with the counter based generator in src/CounterRandom.h*/
+};
+
+/*!
+ * enum representing how the initial populations and velocities are filled, selected in the init file
+ */
+enum Initializer{
+    UniformInit, /*!< Every value is drawn independently and uniformly*/
+    SobolInit, /*!< The rows are points of a digitally shifted Sobol sequence*/
+    HaltonInit, /*!< The rows are points of a Halton sequence with randomly permuted digits*/
+    LatinHypercubeInit /*!< The rows form a Latin hypercube sample*/
+};
+
+/*!
+ * enum representing which versions of the objective functions are run, selected in the init file
+ */
+enum KernelSelection{
+    AutoKernels, /*!< The vectorized kernels of the widest instruction set the processor supports*/
+    ScalarKernels, /*!< The scalar reference functions in src/Equations.c*/
+    SSE2Kernels, /*!< The SSE2 kernels*/
+    AVX2Kernels, /*!< The AVX2 kernels*/
+    AVX512Kernels /*!< The AVX-512 kernels*/
+};
+
+/*!
+ * enum representing how the particle swarm matrices are stored, selected in the init file
+ */
+enum PopulationLayout{
+    AutoLayout, /*!< Dimension major for a synchronous update of low dimensions with enough particles to fill vectors, row major otherwise*/
+    RowMajorLayout, /*!< Every row is a particle, the update vectorizes across the dimensions of a particle*/
+    DimMajorLayout /*!< Every row is a dimension, the update vectorizes across the particles*/
+};
+
+/*!
+ * enum representing when the particles and attracted fireflies of an iteration are evaluated, selected in the init file
+ */
+enum UpdateOrder{
+    SequentialUpdate, /*!< Every particle or attracted firefly is evaluated as soon as it moves, so the moves after it see it*/
+    SynchronousUpdate /*!< Every particle or attracted firefly moves against the population as it was at the start of the iteration*/
+};
+
+/*!
+ * enum representing whether moves changing few coordinates are evaluated by their delta, selected in the init file
+ */
+enum DeltaMode{
+    DeltaOn, /*!< Sparse moves of the Harmonic Search and row major PSO are evaluated with deltaFitness in src/DeltaEquations.h*/
+    DeltaOff /*!< Every moved vector is evaluated in full*/
+};
+
+/*!
+ * enum representing whether candidates which cannot beat the worst fitness are cut short, selected in the init file
+ */
+enum BoundedMode{
+    BoundedOn, /*!< Harmonic Search and the Firefly Algorithm stop evaluating a candidate once it cannot beat the worst fitness*/
+    BoundedOff /*!< Every candidate is evaluated in full*/
+};
+
+/*!
+ * enum representing what a set of random values is drawn for. Combined with the iteration, the particle and the
+ * partner it forms the address of the values when the CounterGenerator mode is used.
+ */
+enum RandPurpose{
+    RandPopulation,
+    RandVelocity,
+    RandVelocityUpdate,
+    RandMovement,
+    RandHarmony,
+    RandHarmonyIndex
+};
+
+/*!
+ * The random number generator context owned by a single algorithm thread. Every random draw made while running
+ * an algorithm goes through one of these so that no locking is required in the hot loops.
+ */
+typedef struct _RandStream{
+    MTState mt;
+    BulkRandState bulk;
+    int mode;
+    CounterKey key;
+    uint32_t iteration;
+}RandStream;
+
 /*!
  * stores all of the necessary information for the program to run for all functions and all test types
  */
@@ -87,8 +204,67 @@ typedef struct _Info{
     double c1;
     double c2;
     double k;
+    uint64_t seed;
+    int seedProvided;
+    int randomMode;
+    int initializer;
+    int layout;
+    int updateOrder;
+    int pinThreads;
+    int hugePages;
+    size_t memoryCap;
+    int kernels;
+    int batchThreads;
+    int delta;
+    int bounded;
+    int fitnessCache;
+    int memetic;
+    int numPlugins;
+    int numFormulas;
+    int numVariants;
+    int replay;
+    int replayEquation;
+    int replayDimIndex;
+    int replayExperiment;
 } Info;
 
+/*!
+ * The signature of the objective functions in src/Equations.h and their kernels in src/SimdEquations.h.
+ */
+typedef double (*EquationFunction)(const Real* vector, int numDim);
+
+/*!
+ * The signature of the parts in src/Equations.h and src/SimdKernels.h evaluating the terms begin up to end of a whole
+ * vector, for the functions whose terms depend on their index or which multiply their terms.
+ */
+typedef double (*EquationPart)(const Real* vector, int numDim, int begin, int end, double* product);
+
+/*!
+ * The signature of the batch kernels in src/SimdEquations.h, which evaluate count vectors stored one row per element.
+ */
+typedef void (*EquationBatch)(const Real* columns, int stride, int count, int numDim, double* fitness);
+
+/*!
+ * The signature of the batch functions of the objective plugins in src/ObjectivePlugin.h, which evaluate count vectors
+ * stored one per row.
+ */
+typedef void (*EquationRows)(const Real* const* vectors, int count, int numDim, double* fitness);
+
+/*!
+ * The functions evaluating one objective function at the size of one run. resolveObjective looks them up once when the
+ * run is created, so the loops of the algorithms call them directly instead of looking them up for every evaluation.
+ */
+typedef struct _Objective{
+    int equation;
+    int dimensions;
+    EquationFunction function; /*!< The kernel of the size of the run, its fixed size kernel if it has one*/
+    EquationFunction anySize; /*!< The kernel of any size, for evaluating parts of a vector*/
+    EquationBatch batch; /*!< The batch kernel of the size of the run, NULL if there is none*/
+    EquationRows rows; /*!< The batch function of an objective plugin or variant, NULL for the built in functions*/
+    DeltaFunction delta; /*!< The delta function of src/DeltaEquations.h, NULL if there is none*/
+    EquationGradient gradient; /*!< The gradient function of src/Gradients.h or of an objective plugin, NULL if there is none*/
+}Objective;
+
 /*!
  * stores all of the information required by a single equation for a single set of dimensions to be processed in the selected test type.
  * used in Win32/EquationsHandlers32.c and PThread/EquationHandlers.c
@@ -101,6 +277,7 @@ typedef struct _EquationInfo{
     int numVectors;
     double* range;
     int dimToTest;
+    int dimIndex;
     int iterations;
     double bandwidth;
     double PAR;
@@ -111,6 +288,21 @@ typedef struct _EquationInfo{
     double c1;
     double c2;
     double k;
+    uint64_t seed;
+    uint64_t cellSeed;
+    int randomMode;
+    int initializer;
+    int layout;
+    int updateOrder;
+    int delta;
+    int bounded;
+    int fitnessCache;
+    int memetic;
+    int cpu;
+    int replay;
+    Objective objective;
+    RandStream* rng;
+    Arena* arena;
 }EquationInfo;
 
 /*!
@@ -120,25 +312,54 @@ typedef struct _Particle{
     double* pBestFit;
     double gBestFit;
     double gWorstFit;
-    double** velocities;
-    double** personalBest;
-    double** population;
+    RowPool swarm;
+    Matrix velocities;
+    Matrix personalBest;
+    Matrix population;
     double* fitness;
     int worstPos;
     int bestPos;
+    RandStream* rng;
+    double* randBuf;
+    int dimMajor;
+    int sequential; /*!< Whether every particle is evaluated as soon as it moves, see the UpdateOrder enum*/
+    Matrix randoms;
+    Real* scratch;
+    Real* gBestRow;
+    int* improved;
+    MoveLog* moves;
+    int* moveAge;
+    int* denseRows;
+    int* densePos;
+    double* denseFit;
 }Particle;
 
 /*!
  * Stores all information related to a population necessary for the Firefly Algorithm meta heuristics
  */
 typedef struct _FireflySwarm{
-    double** population;
+    RowPool population;
     double* fitness;
     int dimensions;
     double bestFit;
     int bestPos;
     double worstFit;
     int worstPos;
+    RandStream* rng;
+    double* randBuf;
+    double* pinnedFit;
+    Matrix candidates;
+    double* candidateFit;
+    int* candidatePos;
+    int* candidateCut;
+    int cutWorst;
+    int sequential; /*!< Whether every attracted firefly is evaluated as soon as it is built, see the UpdateOrder enum*/
+    long bounded;
+    long cutShort;
+    FitnessCache* cache;
+    uint64_t* candidateHash;
+    int* cacheMisses;
+    double* missFit;
 }FireflySwarm;
 
 /*!
@@ -149,11 +370,29 @@ typedef struct _HarmonicPop{
     int bestPos;
     double worstFit;
     int worstPos;
-    double** population;
+    RowPool population;
     double* fitness;
-    double* newHarmonic;
+    Real* newHarmonic;
+    RandStream* rng;
+    double* randBuf;
+    int* randIdx;
+    MoveLog* move;
+    int* moveAge;
+    int newAge;
+    long bounded;
+    long cutShort;
+    FitnessCache* cache;
 }HPop;
 
+/*!
+ * The signature of the bodies run by parallelFor, which process the items from begin up to end.
+ */
+typedef void (*ParallelBody)(void* context, int begin, int end);
+
+/*!
+ * The locked methods below draw from the generator shared by the whole program and are only meant for setup work
+ * outside of the algorithms, which draw from their own RandStream.
+ */
 #ifdef WIN32
 HANDLE mutex; /*!< declare the Windows 32 mutex handle to be used when generating random numbers*/
 int genRandInt32(int modulo); /*!< declare the win32 method for threaded random integers*/
@@ -164,6 +403,66 @@ int genRandIntP(int modulo); /*!< declare the POSIX method for threaded random i
 double genRandRealP(); /*!< declare the POSIX method for threaded random real numbers*/
 #endif
 
+/// \fn void pinThread(int cpu)
+/// \brief Pins the calling thread to a single CPU, so the pages it touches first are placed on that CPU's memory node
+/// and it is never moved away from them. Implemented for each platform in src/PThread/UtilP.c and src/Win32/Util32.c.
+///
+/// \param cpu - the CPU to run on, or -1 to leave the thread where the scheduler puts it
+void pinThread(int cpu);
+/// \fn int cpuCount()
+/// \brief Returns the number of CPUs online, which the CPU of every run is wrapped around.
+///
+/// \return the number of CPUs, at least 1
+int cpuCount();
+/// \fn size_t physicalMemoryBytes()
+/// \brief Returns the physical memory of the machine, which the 'Auto' memory cap is set to.
+///
+/// \return the number of bytes, or 0 if it could not be determined
+size_t physicalMemoryBytes();
+/// \fn void acquireMemory(size_t bytes, size_t cap)
+/// \brief Waits until the memory in use by the running tasks leaves room for bytes more under the cap, then adds them.
+/// A task is always let through when nothing else is running, so a task larger than the cap still runs on its own.
+///
+/// \param bytes - the memory the task about to start uses
+/// \param cap - the most memory the running tasks may use together, 0 for no cap
+void acquireMemory(size_t bytes, size_t cap);
+/// \fn void releaseMemory(size_t bytes, size_t cap)
+/// \brief Returns the memory of a finished task and wakes the tasks waiting for it.
+///
+/// \param bytes - the memory the finished task used, as passed to acquireMemory
+/// \param cap - the cap passed to acquireMemory, 0 for no cap
+void releaseMemory(size_t bytes, size_t cap);
+/// \fn void* openLibrary(const char* path)
+/// \brief Opens a shared library for the objective plugins of src/Plugins.h. It is never closed, as its functions are used
+/// until the program exits.
+///
+/// \param path - the path of the library
+/// \return the library, or NULL if it could not be opened, having printed the reason given by the system
+void* openLibrary(const char* path);
+/// \fn void* librarySymbol(void* library, const char* name)
+/// \brief Looks up a symbol exported by a library opened with openLibrary.
+///
+/// \param library - the library
+/// \param name - the name of the symbol
+/// \return the address of the symbol, or NULL if the library does not export it
+void* librarySymbol(void* library, const char* name);
+/// \fn void startWorkPool(int threads)
+/// \brief Starts the workers parallelFor shares its work with. They wait for work until the program exits, so this is
+/// called once from main before any threads are started.
+///
+/// \param threads - the number of threads working on every shared job, the calling thread included
+void startWorkPool(int threads);
+/// \fn void parallelFor(int count, int grain, ParallelBody body, void* context)
+/// \brief Runs body over the items 0 to count in chunks of grain items, shared between the calling thread and the idle
+/// workers of the work pool, and returns once every chunk has finished. Without workers, or with a single chunk, body is
+/// simply called once on the calling thread. Nothing is allocated, so it may be called from the iterations.
+///
+/// \param count - the number of items
+/// \param grain - the number of items in every chunk
+/// \param body - the function processing a chunk
+/// \param context - passed to every call of body
+void parallelFor(int count, int grain, ParallelBody body, void* context);
+
 /// \fn void writeResultToFile(double bestFit, double worstFit, char* algorithm, int currIter, double time, EquationInfo info)
 /// \brief This is the method which writes the results of the current Iteration to the designated result file
 ///
@@ -175,15 +474,24 @@ double genRandRealP(); /*!< declare the POSIX method for threaded random real nu
 /// \param info - The EquationInfo struct which houses the information for setting up the process
 /// \return No return as it simply prints to a file
 void writeResultToFile(double bestFit, double worstFit, char* algorithm, int currIter, double time, EquationInfo info);
-/// \fn void writePopulationLogToFile(double** population, char* algorithm, int currIter, EquationInfo info)
+/// \fn void writePopulationLogToFile(const Matrix* population, const int* slots, char* algorithm, int currIter, EquationInfo info)
 /// \brief This is the method which writes the population log to a file tracking the changes in the population per iteration of an experiment
 ///
 /// \param population - The population resulting from the current iteration
+/// \param slots - The row of every vector when the population is held in a row pool, or NULL when vector i is row i
 /// \param algorithm - the algorithm name being run, used for file name
 /// \param currIter - the current iteration being written to the file
 /// \param info - The EquationInfo struct which houses the information for setting up the process
 /// \return No return as it simply prints to a file
-void writePopulationLogToFile(double** population, char* algorithm, int currIter, EquationInfo info);
+void writePopulationLogToFile(const Matrix* population, const int* slots, char* algorithm, int currIter, EquationInfo info);
+/// \fn void writeSeedManifest(char* algorithm, EquationInfo info)
+/// \brief This is the method which records the seeds of a single run to the seed manifest of the algorithm, so the run can
+/// later be replayed on its own with the Seed and Replay lines of the init file.
+///
+/// \param algorithm - the algorithm name being run, used for file name
+/// \param info - The EquationInfo struct of the run about to start
+/// \return No return as it simply prints to a file
+void writeSeedManifest(char* algorithm, EquationInfo info);
 /// \fn void printDArray(double* list, int size)
 /// \brief This is the method which prints a double array to the console for debugging
 ///
@@ -206,22 +514,53 @@ void printIArray(int* list, int size);
 /// \param numCols - the number of columns per row in matrix
 /// \return No return as it simply prints to console
 void printMatrix(double** matrix, int numRows, int numCols);
-/// \fn double** allocateEmptyMatrix(int popSize, int dimensions)
-/// \brief This is the method which allocates the space for an empty population of a certain size with a certain number of dimensions
+/// \fn void installEquationKernels(int selection)
+/// \brief Replaces the entries of equationHostCalls in src/HostCalls.h with the selected kernels of src/SimdEquations.h,
+/// and fills equationBatchCalls with their batch kernels.
+/// A selected instruction set the processor does not support falls back to the widest one it does. Must be called
+/// before any threads are started.
 ///
-/// \param popSize - The number of rows to be allocated
-/// \param dimensions - The number of columns to be allocated per row
-/// \return returns an empty matrix
-double** allocateEmptyMatrix(int, int);
-/// \fn void allocateHPop(HPop* pop, int popSize)
-/// \brief This is the method which allocates the fitness array for the HPop struct
+/// \param selection - the KernelSelection enum value read from the init file
+/// \return No return as it only replaces the function references
+void installEquationKernels(int selection);
+/// \fn size_t runArenaBytes(int algorithm, int layout, int updateOrder, int numVectors, int dimensions, int cacheEntries, int memetic)
+/// \brief Calculates the size of the arena a single run of an algorithm allocates all of its buffers from. This is also
+/// all the memory the run uses, so src/MemoryPlan.h plans the whole experiment grid from it.
+///
+/// \param algorithm - The TestType enum value of the algorithm being run
+/// \param layout - The PopulationLayout enum value of the run, a dimension major particle swarm keeps both layouts
+/// \param updateOrder - The UpdateOrder enum value of the run, which AutoLayout depends on
+/// \param numVectors - The size of the population of the run
+/// \param dimensions - The number of dimensions per vector
+/// \param cacheEntries - The number of vectors the fitness cache of the run holds, 0 when it is off
+/// \param memetic - The number of iterations between the refinements of src/Memetic.h, 0 when they are off
+/// \return the number of bytes the arena must hold
+size_t runArenaBytes(int algorithm, int layout, int updateOrder, int numVectors, int dimensions, int cacheEntries, int memetic);
+/// \fn void allocateHPop(HPop* pop, Arena* arena, int popSize, int dimensions)
+/// \brief This is the method which allocates the fitness array and the random number buffers for the HPop struct
 ///
 /// \param pop - The HPop struct being initialized
+/// \param arena - The arena of the run the buffers are allocated from
 /// \param popSize - The size of the population being initialized
+/// \param dimensions - The number of dimensions per harmonic
 /// \return No return as it modifies the struct directly
-void allocateHPop(HPop* pop, int popSize);
+void allocateHPop(HPop* pop, Arena* arena, int popSize, int dimensions);
+/// \fn int useDimMajorLayout(int layout, int updateOrder, int numVectors, int dimensions)
+/// \brief Decides whether the particle swarm matrices are stored dimension major. With AutoLayout they are when the
+/// update is synchronous and there are at most SOA_MAX_DIMENSIONS dimensions and at least SOA_MIN_POPULATION particles,
+/// so the update vectorizes across the particles instead of the few dimensions. The sequential update moves a single
+/// particle at a time, which the dimension major layout only slows down. Either layout gives the same results.
+///
+/// \param layout - the PopulationLayout enum value selected in the init file
+/// \param updateOrder - the UpdateOrder enum value selected in the init file
+/// \param numVectors - the number of particles in the population
+/// \param dimensions - the dimensions of the particles in the population
+/// \return 1 if the matrices are stored dimension major, 0 otherwise
+int useDimMajorLayout(int layout, int updateOrder, int numVectors, int dimensions);
 /// \fn void createParticles(Particle* particles, int numVectors, int dimensions, EquationInfo info)
-/// \brief Initializes a Particle struct for the algorithm implemented in src/PSO.c
+/// \brief Initializes a Particle struct for the algorithm implemented in src/PSO.c from the arena of the run. The positions
+/// are held in the first numVectors slots of the swarm row pool and the personal bests in the rest, each sharing the row of
+/// its particle to begin with. When useDimMajorLayout selects it the buffers the dimension major layout needs are allocated as well.
 ///
 /// \param particles - the struct to be initialized
 /// \param numVectors  - the number of particles to be stored in the population
@@ -236,37 +575,166 @@ void createParticles(Particle* particles, int numVectors, int dimensions, Equati
 /// \param size - number of values in the array being copied
 /// \return No return as it modifies the pointer directly
 void copyArray(const double*, double*, int);
-/// \fn void copyMatrix(double** in, double** out, int height, int width)
-/// \brief This method is used to copy the values from one matrix into another so the original can be freed
-///
-/// \param in - the matrix to be copied
-/// \param out - the matrix to story the values being copied
-/// \param height - number of rows in the matrix being copied
-/// \param width - numbver of columns in the matrix being copied
-/// \return No return as it modifies the pointer directly
-void copyMatrix(double**, double**, int, int);
-/// \fn double evaluateFitness(double* firefly, int dimensions, int equation)
-/// \brief This method is responsible for executing the appropriate objective function on the given vector.
+/// \fn Objective resolveObjective(int equation, int dimensions)
+/// \brief Looks up the kernels and the delta function of an objective function for the size of a run, once the
+/// kernels have been installed. Every evaluation of the run then goes through the returned Objective.
 ///
-/// \param firefly - The given vector to be sent to the objective function
-/// \param dimensions - the number of dimensions in the vector
 /// \param equation - the objective function number to be run against
+/// \param dimensions - the number of dimensions of the vectors of the run
+/// \return the functions of the run
+Objective resolveObjective(int equation, int dimensions);
+/// \fn int equationInRun(const Info* info, int equation)
+/// \brief Tells whether a position holds one of the functions the program runs, which are the first numEquations built
+/// in functions, the function of every objective plugin, every objective formula and every variant.
+///
+/// \param info - the Info struct of the program
+/// \param equation - the position of the function
+/// \return 1 if the function is run, 0 otherwise
+int equationInRun(const Info* info, int equation);
+/// \fn int canCutShort(const Objective* objective, double bound)
+/// \brief Tells whether evaluateBounded can stop early for the function, which needs a lower bound on its terms, more
+/// than BOUND_BLOCK_DIMENSIONS dimensions and a finite bound. Vectors of at least SPLIT_VECTOR_DIMENSIONS dimensions are
+/// evaluated in parts on several threads instead, as the blocks have to be checked in order.
+///
+/// \param objective - the functions of the run
+/// \param bound - the fitness a candidate has to reach to be kept
+/// \return 1 if the evaluation can stop early, 0 otherwise
+int canCutShort(const Objective* objective, double bound);
+/// \fn double evaluateSplit(int equation, const Real* vector, int numDim)
+/// \brief Evaluates a single vector of a built in function in parts, shared with the work pool with parallelFor. The
+/// terms are split into at most MAX_SPLIT_BLOCKS parts of at least SPLIT_BLOCK_DIMENSIONS terms, which only depend on the
+/// number of dimensions, and the parts are added together pairwise in a fixed order, so the fitness is the same however
+/// many threads share it. resolveObjective uses it for vectors of at least SPLIT_VECTOR_DIMENSIONS dimensions.
+///
+/// \param equation - the EquationPosition of the built in function
+/// \param vector - The given vector to be sent to the objective function
+/// \param numDim - the number of dimensions of the vector
+/// \return the fitness of the vector
+double evaluateSplit(int equation, const Real* vector, int numDim);
+/// \fn double evaluateBounded(const Real* vector, const Objective* objective, double bound, int* cutShort)
+/// \brief Evaluates a candidate which is only kept if its fitness is at most bound. The terms are added a block of
+/// BOUND_BLOCK_DIMENSIONS at a time, and once the fitness is above the bound whatever the remaining terms add the
+/// evaluation stops. Functions whose terms have no lower bound, and an infinite bound, are evaluated in full.
+///
+/// \param vector - The given vector to be sent to the objective function
+/// \param objective - the functions of the run
+/// \param bound - the fitness the candidate has to reach to be kept, INFINITY to keep every candidate
+/// \param cutShort - stores 1 if the evaluation stopped early, 0 otherwise
+/// \return the fitness of the vector, or a fitness above the bound the vector is sure to reach if it stopped early
+double evaluateBounded(const Real* vector, const Objective* objective, double bound, int* cutShort);
+/// \fn int evaluateBatchBounded(const Matrix* vectors, const int* slots, int count, const Objective* objective, double bound, double* fitness, int* cutShort)
+/// \brief The version of evaluateBatch for candidates which are only kept if their fitness is at most bound, evaluating
+/// every vector with evaluateBounded when it can be cut short and with the batch kernels otherwise.
+///
+/// \param vectors - the matrix holding the vectors, one per row
+/// \param slots - the row of every vector when they are held in a row pool, or NULL when vector i is row i
+/// \param count - the number of vectors to evaluate
+/// \param objective - the functions of the run
+/// \param bound - the fitness a candidate has to reach to be kept
+/// \param fitness - stores the fitness of every vector
+/// \param cutShort - a buffer of count values storing whether each evaluation stopped early
+/// \return the number of evaluations which stopped early
+int evaluateBatchBounded(const Matrix* vectors, const int* slots, int count, const Objective* objective, double bound, double* fitness, int* cutShort);
+/// \fn void recordCutShort(long evaluations, long cutShort)
+/// \brief Adds the bounded evaluations of a run and how many of them stopped early to the totals of the program.
+///
+/// \param evaluations - the number of bounded evaluations the run made
+/// \param cutShort - the number of them which stopped early
+void recordCutShort(long evaluations, long cutShort);
+/// \fn void readCutShort(long* evaluations, long* cutShort)
+/// \brief Reads the totals of the program added with recordCutShort.
+///
+/// \param evaluations - stores the number of bounded evaluations of every run
+/// \param cutShort - stores the number of them which stopped early
+void readCutShort(long* evaluations, long* cutShort);
+/// \fn void recordHeapAllocations(long count)
+/// \brief Adds the heap allocations the iterations of a run made to the total of the program, which stays zero as long
+/// as every buffer comes from the arena of the run.
+///
+/// \param count - the number of allocations the iterations of the run made
+void recordHeapAllocations(long count);
+/// \fn void readHeapAllocations(long* count)
+/// \brief Reads the total of the program added with recordHeapAllocations.
+///
+/// \param count - stores the number of allocations the iterations of every run made
+void readHeapAllocations(long* count);
+/// \fn void printCutShort()
+/// \brief Prints how many of the bounded evaluations of every run stopped early, if any were made.
+void printCutShort();
+/// \fn void recordCacheHits(const FitnessCache* cache)
+/// \brief Adds the lookups of the fitness cache of a run and how many of them were found to the totals of the program.
+///
+/// \param cache - the cache of the run, or NULL when the cache is off
+void recordCacheHits(const FitnessCache* cache);
+/// \fn void readCacheHits(long* lookups, long* hits)
+/// \brief Reads the totals of the program added with recordCacheHits.
+///
+/// \param lookups - stores the number of vectors looked up in the cache of every run
+/// \param hits - stores the number of them which were found
+void readCacheHits(long* lookups, long* hits);
+/// \fn void printCacheHits()
+/// \brief Prints how many of the vectors looked up in the fitness caches were found, if the caches were used.
+void printCacheHits();
+/// \fn MoveLog* createMoveLogs(EquationInfo info, int count)
+/// \brief Allocates the logs of the moves of count vectors from the arena of a run when their deltas will be used.
+///
+/// \param info - the EquationInfo struct housing equation specific info
+/// \param count - the number of vectors moved each iteration
+/// \return the empty logs, or NULL when the delta evaluation line turned it off or the function has no delta
+MoveLog* createMoveLogs(EquationInfo info, int count);
+/// \fn int moveIsSparse(const MoveLog* log, int baseAge)
+/// \brief Tells whether evaluateMove would use the delta of a move instead of evaluating the vector in full, which is
+/// when the move changed nothing, or changed few enough coordinates and the fitness before it was built from fewer
+/// than DELTA_REFRESH_MOVES deltas.
+///
+/// \param log - the coordinates the move changed
+/// \param baseAge - the number of deltas the fitness before the move was built from since the vector was last evaluated in full
+/// \return 1 if the delta is used, 0 otherwise
+int moveIsSparse(const MoveLog* log, int baseAge);
+/// \fn double evaluateMove(const Real* vector, const Objective* objective, const MoveLog* log, double baseFit, int baseAge, int* age)
+/// \brief Evaluates a moved vector, from the fitness it had before the move when the move is sparse and in full
+/// otherwise. A full evaluation every DELTA_REFRESH_MOVES deltas keeps the rounding of the deltas from adding up.
+///
+/// \param vector - the vector after the move
+/// \param objective - the functions of the run, which must have a delta function
+/// \param log - the coordinates the move changed
+/// \param baseFit - the fitness of the vector before the move
+/// \param baseAge - the number of deltas baseFit was built from
+/// \param age - stores the number of deltas the returned fitness was built from
 /// \return the fitness of the vector with regards to the objective function
-double evaluateFitness(double* firefly, int dimensions, int equation);
-/// \fn void evaluatePop(double** pop, double* fitness, int popSize, int dimensions, int equation, int* objBestPos, int* objWorstPos, double* objBestFit, double* objWorstFit)
+double evaluateMove(const Real* vector, const Objective* objective, const MoveLog* log, double baseFit, int baseAge, int* age);
+/// \fn void evaluateBatch(const Matrix* vectors, const int* slots, int count, const Objective* objective, double* fitness)
+/// \brief Evaluates many vectors held in the rows of a matrix with the functions of the run. Vectors
+/// of at most BATCH_TILE_DIMENSIONS dimensions are gathered into groups and run through the batch kernel one lane per
+/// vector, longer ones through the kernel one at a time. Large batches are shared with the work pool.
+///
+/// \param vectors - the matrix holding the vectors, one per row
+/// \param slots - the row of every vector when they are held in a row pool, or NULL when vector i is row i
+/// \param count - the number of vectors to evaluate
+/// \param objective - the functions of the run
+/// \param fitness - stores the fitness of every vector
+void evaluateBatch(const Matrix* vectors, const int* slots, int count, const Objective* objective, double* fitness);
+/// \fn void evaluateColumns(const Matrix* columns, const Objective* objective, double* fitness, Real* scratch)
+/// \brief Evaluates every vector of a dimension major matrix, where row j holds dimension j of every vector, running the
+/// batch kernel straight on the rows. Without a batch kernel every vector is gathered into scratch and evaluated alone.
+///
+/// \param columns - the matrix holding one vector per column
+/// \param objective - the functions of the run
+/// \param fitness - stores the fitness of every vector
+/// \param scratch - a buffer of columns->rows values a vector is gathered into
+void evaluateColumns(const Matrix* columns, const Objective* objective, double* fitness, Real* scratch);
+/// \fn void evaluatePop(const Matrix* pop, double* fitness, const Objective* objective, int* objBestPos, int* objWorstPos, double* objBestFit, double* objWorstFit)
 /// \brief Takes an entire population, evaluates the fitness of the entire population and stores the best and worst fitness, and the positions in the population
 /// of these fitnesses for aiding the algorithm processing.
 ///
-/// \param pop - the population matrix for the struct being processed
+/// \param pop - the population matrix for the struct being processed, every row is evaluated
 /// \param fitness - pointer to the fitness array of the processed population
-/// \param popSize - The number of rows to be evaluated
-/// \param dimensions - The number of columns in the row to be evaluated
-/// \param equation - the objective function number to be run against
+/// \param objective - the functions of the run
 /// \param objBestPos - pointer to the structs best position
 /// \param objWorstPos - pointer to the structs worst position
 /// \param objBestFit - pointer to the structs best fitness
 /// \param objWorstFit - pointer to the structs worst fitness
-void evaluatePop(double** pop, double* fitness, int popSize, int dimensions, int equation, int* objBestPos, int* objWorstPos, double* objBestFit, double* objWorstFit);
+void evaluatePop(const Matrix* pop, double* fitness, const Objective* objective, int* objBestPos, int* objWorstPos, double* objBestFit, double* objWorstFit);
 /// \fn void evalNewWorst(const double* fitness, int popSize, double newResult, int* objWorstPos, double* objWorstFit)
 /// \brief Evaluates the population to determine the fitness and position of the worst vector in the population.
 ///
@@ -296,23 +764,5 @@ void freeInfo(Info*);
 /// \param height - number of rows in the matrix
 /// \return No return as it only frees memory
 void freeMatrix(double**, int);
-/// \fn void freeHPop(HPop* pop, int popSize)
-/// \brief frees the HPop struct
-///
-/// \param pop - the struct to be freed
-/// \param popSize - the size of the population which is being freed
-void freeHPop(HPop* pop, int popSize);
-/// \fn void freeFireflySwarm(FireflySwarm* pop, int popSize)
-/// \brief frees the FireflySwarm struct
-///
-/// \param pop - the struct to be freed
-/// \param popSize - the size of the population which is being freed
-void freeFireflySwarm(FireflySwarm* pop, int popSize);
-/// \fn void freeParticles(Particle* particles, int popSize)
-/// \brief frees the Particle struct passed in
-///
-/// \param particles - the struct to be freed
-/// \param popSize - the size of the population which is being freed
-void freeParticles(Particle* particles, int popSize);
 
 #endif //TESTINGSUITE_UTILITIES_H
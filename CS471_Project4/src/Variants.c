@@ -0,0 +1,425 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Variants.c
+ * \brief This is where the methods defined in src/Variants.h are implemented.
+ *
+ *  Every variant holds one instance per dimension to be tested, with the shift, rotation and permutation drawn for it
+ *  and the kernels of its built in functions at the sizes they are called with. A batch is evaluated a block of rows at
+ *  a time: every row is shifted into a scratch matrix, the whole block is rotated at once by the installed
+ *  RotationKernel of src/Rotation.h, and every rotated row is handed to the built in functions.
+ *
+ *  The variants are only registered and built while the init file is read, and their kernels looked up before any
+ *  threads are started, so the registry below is never written while a run reads it.
+ */
+#include "Variants.h"
+#include "Rotation.h"
+
+#define VARIANT_SEED 0x56415249414E5453ULL /*!< declare the constant for the seed the key of the variant in the first slot is made from*/
+#define VARIANT_STREAMS 4 /*!< declare the constant for the number of random streams every function of a variant draws from*/
+#define VARIANT_SCRATCH_VALUES 8192 /*!< declare the constant for the number of values in each of the scratch matrices of a block*/
+#define VARIANT_BLOCK_ROWS 64 /*!< declare the constant for the most rows evaluated as one block*/
+#define VARIANT_BIAS 100.0 /*!< declare the constant for the bias added to every function of a composition after the first*/
+#define VARIANT_SIGMA_DIVISOR 20.0 /*!< declare the constant for the fraction of the range the basin of the first function of a composition spreads over*/
+
+/*!
+ * The purposes random values are drawn for, each with its own stream for every function of a variant.
+ */
+enum VariantStream{
+    ShiftStream,
+    RotationStream,
+    PermutationStream
+};
+
+/*!
+ * A variant built for one number of dimensions.
+ */
+typedef struct _VariantInstance{
+    int dimensions;
+    int stride; /*!< The padded length of every row of the rotations and the scratch matrices*/
+    double* shifts[VARIANT_MAX_FUNCTIONS]; /*!< The shift of every function of a composition, or of the variant*/
+    double* rotations[VARIANT_MAX_FUNCTIONS]; /*!< The transposed rotation matching every shift, NULL for a shifted variant*/
+    int* permutation; /*!< The coordinate of the rotated vector every position of the groups of a hybrid reads*/
+    int groupStarts[VARIANT_MAX_FUNCTIONS + 1]; /*!< The first position of the group of every function of a hybrid and the end of the last*/
+    EquationFunction functions[VARIANT_MAX_FUNCTIONS]; /*!< The kernel of every function at the size it is called with*/
+}VariantInstance;
+
+/*!
+ * A registered variant.
+ */
+typedef struct _Variant{
+    int kind;
+    int numFunctions;
+    int bases[VARIANT_MAX_FUNCTIONS]; /*!< The EquationPosition of every built in function*/
+    double lower;
+    double upper;
+    VariantInstance* instances; /*!< The instance of every dimension to be tested*/
+    int numInstances;
+}Variant;
+
+static Variant variants[MAX_NUM_VARIANTS]; /*!< Every variant registered*/
+static char* variantNames[MAX_NUM_VARIANTS]; /*!< The name every variant was registered under*/
+static int numVariants = 0; /*!< The number of variants registered*/
+static RotationKernel variantRotation = &rotateRowsScalar; /*!< The rotation kernel of the installed instruction set*/
+
+
+static int variantStream(int function, int purpose){
+    return function * VARIANT_STREAMS + purpose;
+}
+
+static int numComponents(const Variant* variant){
+    return variant->kind == CompositionVariant ? variant->numFunctions : 1; ///only the functions of a composition have a shift and rotation each
+}
+
+static const VariantInstance* findInstance(const Variant* variant, int numDim){
+    for(int i = 0; i < variant->numInstances; i++){
+        if(variant->instances[i].dimensions == numDim)
+            return &variant->instances[i];
+    }
+    return &variant->instances[0]; ///every run has one of the dimensions the variants were built for
+}
+
+/*!
+ * Hands a row of doubles to the built in functions, converting it to the buffer when they take single precision.
+ */
+static const Real* realRow(const double* row, int numDim, Real* buffer){
+#ifdef SINGLE_PRECISION
+    for(int j = 0; j < numDim; j++)
+        buffer[j] = (Real)row[j];
+    return buffer;
+#else
+    (void)numDim;
+    (void)buffer;
+    return row;
+#endif
+}
+
+/*!
+ * Shifts a block of rows into inputs, storing the squared distance of every row to the shift when distances is not NULL,
+ * and rotates them into outputs. Returns the rows the functions are evaluated on.
+ */
+static const double* transformRows(const VariantInstance* instance, int component, const Real* const* vectors, int rows, double* inputs, double* outputs, double* distances){
+    const double* shift = instance->shifts[component]; /*!< The shift of the function*/
+    for(int r = 0; r < rows; r++){
+        double* y = inputs + (long)r * instance->stride; /*!< The shifted row*/
+        double distance = 0; /*!< The squared distance of the row to the shift*/
+        for(int j = 0; j < instance->dimensions; j++){
+            y[j] = (double)vectors[r][j] - shift[j];
+            distance += y[j] * y[j];
+        }
+        if(distances)
+            distances[r] = distance;
+    }
+    if(!instance->rotations[component])
+        return inputs;
+    variantRotation(instance->rotations[component], instance->stride, inputs, rows, instance->dimensions, outputs);
+    return outputs;
+}
+
+static double hybridValue(const Variant* variant, const VariantInstance* instance, const double* z, Real* buffer){
+    double sum = 0; /*!< The sum of the value of every function on its group*/
+    for(int g = 0; g < variant->numFunctions; g++){
+        int first = instance->groupStarts[g], /*!< The first position of the group*/
+        length = instance->groupStarts[g + 1] - first; /*!< The number of coordinates in the group*/
+        for(int k = 0; k < length; k++)
+            buffer[k] = (Real)z[instance->permutation[first + k]];
+        sum += instance->functions[g](buffer, length);
+    }
+    return sum;
+}
+
+/*!
+ * Evaluates a block of rows of a composition. Every function is weighted by exp(-d^2 / (2 n sigma^2)) / d with d the
+ * distance of the row to its shift, so a row on a shift takes the value of that function alone, and rows too far from
+ * every shift for any weight to be represented take the mean of the values.
+ */
+static void composeRows(const Variant* variant, const VariantInstance* instance, const Real* const* vectors, int rows, double* inputs, double* outputs, Real* buffer, double* fitness){
+    double distances[VARIANT_BLOCK_ROWS], /*!< The squared distance of every row to the shift of the function*/
+    weights[VARIANT_BLOCK_ROWS] = {0}, /*!< The sum of the weights of every row*/
+    weighted[VARIANT_BLOCK_ROWS] = {0}, /*!< The sum of the weighted values of every row, or its value when it is on a shift*/
+    values[VARIANT_BLOCK_ROWS] = {0}; /*!< The sum of the values of every row*/
+    int exact[VARIANT_BLOCK_ROWS] = {0}; /*!< Whether every row is on the shift of a function*/
+    int n = instance->dimensions;
+    for(int c = 0; c < variant->numFunctions; c++){
+        double sigma = (c + 1) * (variant->upper - variant->lower) / VARIANT_SIGMA_DIVISOR, /*!< The spread of the basin of the function*/
+        spread = 1.0 / (2.0 * n * sigma * sigma); /*!< The factor of the squared distance in the exponent*/
+        const double* z = transformRows(instance, c, vectors, rows, inputs, outputs, distances); /*!< The rows rotated for the function*/
+        for(int r = 0; r < rows; r++){
+            double value, /*!< The biased value of the function*/
+            weight; /*!< The weight of the function*/
+            if(exact[r]) ///the row already took the value of the function it is on
+                continue;
+            value = instance->functions[c](realRow(z + (long)r * instance->stride, n, buffer), n) + VARIANT_BIAS * c;
+            if(distances[r] == 0){
+                exact[r] = 1;
+                weighted[r] = value;
+                continue;
+            }
+            weight = exp(-distances[r] * spread) / sqrt(distances[r]);
+            weights[r] += weight;
+            weighted[r] += weight * value;
+            values[r] += value;
+        }
+    }
+    for(int r = 0; r < rows; r++)
+        fitness[r] = exact[r] ? weighted[r] : weights[r] > 0 ? weighted[r] / weights[r] : values[r] / variant->numFunctions;
+}
+
+static void evaluateRows(const Variant* variant, const Real* const* vectors, int count, int numDim, double* fitness){
+    const VariantInstance* instance = findInstance(variant, numDim); /*!< The instance of the size of the run*/
+    double inputs[VARIANT_SCRATCH_VALUES], /*!< The shifted rows of a block*/
+    outputs[VARIANT_SCRATCH_VALUES]; /*!< The rotated rows of a block*/
+    Real buffer[VARIANT_MAX_DIMENSIONS]; /*!< The row or group handed to a built in function*/
+    int block = VARIANT_SCRATCH_VALUES / instance->stride; /*!< The number of rows in a block*/
+    if(block > VARIANT_BLOCK_ROWS)
+        block = VARIANT_BLOCK_ROWS;
+    /*!
+     * Evaluate the rows a block at a time, so every block is rotated with a single matrix-matrix product.
+     */
+    for(int first = 0; first < count; first += block){
+        int rows = count - first < block ? count - first : block; /*!< The number of rows in this block*/
+        const double* z; /*!< The rotated rows*/
+        if(variant->kind == CompositionVariant){
+            composeRows(variant, instance, vectors + first, rows, inputs, outputs, buffer, fitness + first);
+            continue;
+        }
+        z = transformRows(instance, 0, vectors + first, rows, inputs, outputs, NULL);
+        for(int r = 0; r < rows; r++){
+            const double* row = z + (long)r * instance->stride; /*!< The rotated row*/
+            fitness[first + r] = variant->kind == HybridVariant ? hybridValue(variant, instance, row, buffer)
+                                                                : instance->functions[0](realRow(row, numDim, buffer), numDim);
+        }
+    }
+}
+
+/*!
+ * Defines the EquationFunction and EquationRows of the variant in a slot of the registry. They take no context, so
+ * every slot has its own pair, each forwarding to the variant stored in its slot.
+ */
+#define VARIANT_SLOT(slot) \
+static double variantEvaluate##slot(const Real* vector, int numDim){ \
+    double fitness; \
+    evaluateRows(&variants[slot], &vector, 1, numDim, &fitness); \
+    return fitness; \
+} \
+static void variantRows##slot(const Real* const* vectors, int count, int numDim, double* fitness){ \
+    evaluateRows(&variants[slot], vectors, count, numDim, fitness); \
+}
+
+VARIANT_SLOT(0)
+VARIANT_SLOT(1)
+VARIANT_SLOT(2)
+VARIANT_SLOT(3)
+VARIANT_SLOT(4)
+VARIANT_SLOT(5)
+VARIANT_SLOT(6)
+VARIANT_SLOT(7)
+
+#undef VARIANT_SLOT
+
+//! The functions of every slot of the registry evaluating a single vector, in slot order
+static const EquationFunction slotEvaluates[MAX_NUM_VARIANTS] = {
+    &variantEvaluate0, &variantEvaluate1, &variantEvaluate2, &variantEvaluate3,
+    &variantEvaluate4, &variantEvaluate5, &variantEvaluate6, &variantEvaluate7
+};
+
+//! The batch functions of every slot of the registry, in slot order
+static const EquationRows slotRows[MAX_NUM_VARIANTS] = {
+    &variantRows0, &variantRows1, &variantRows2, &variantRows3,
+    &variantRows4, &variantRows5, &variantRows6, &variantRows7
+};
+
+/*!
+ * Draws a random rotation, the rows of a matrix of normally distributed values made orthonormal by modified
+ * Gram-Schmidt. The rows are stored as the rows of the transposed rotation, with zeros after the last dimension.
+ */
+static double* drawRotation(const CounterKey* key, int component, int dimensions, int stride, double* uniforms){
+    double* rotation = alignedCalloc((size_t)dimensions * stride, sizeof(double)); /*!< The transposed rotation*/
+    if(!rotation)
+        return NULL;
+    for(int j = 0; j < dimensions; j++){
+        double* row = rotation + (long)j * stride; /*!< The row being drawn*/
+        double norm = 0; /*!< The length of the row once the rows before it are removed*/
+        counterRandDoubles(key, (uint32_t)dimensions, (uint32_t)j, variantStream(component, RotationStream), uniforms, 2 * dimensions, 0, 1);
+        for(int i = 0; i < dimensions; i++) ///Box-Muller, with 1 - u so the logarithm is never taken of 0
+            row[i] = sqrt(-2.0 * log(1.0 - uniforms[i])) * cos(2.0 * M_PI * uniforms[dimensions + i]);
+        for(int p = 0; p < j; p++){
+            const double* previous = rotation + (long)p * stride; /*!< A row already made orthonormal*/
+            double dot = 0; /*!< The part of the row along the previous row*/
+            for(int i = 0; i < dimensions; i++)
+                dot += row[i] * previous[i];
+            for(int i = 0; i < dimensions; i++)
+                row[i] -= dot * previous[i];
+        }
+        for(int i = 0; i < dimensions; i++)
+            norm += row[i] * row[i];
+        norm = sqrt(norm);
+        for(int i = 0; i < dimensions; i++)
+            row[i] /= norm;
+    }
+    return rotation;
+}
+
+static int buildInstance(const Variant* variant, int slot, int dimensions, VariantInstance* instance){
+    CounterKey key = makeCounterKey(VARIANT_SEED + (uint64_t)slot); /*!< The key the values of the variant are drawn with*/
+    double* uniforms = malloc(2 * (size_t)dimensions * sizeof(double)); /*!< The uniform values a row is drawn from*/
+    double range = variant->upper - variant->lower; /*!< The width of the range*/
+    int failed = !uniforms; /*!< Whether an allocation failed*/
+    instance->dimensions = dimensions;
+    instance->stride = (dimensions + ROTATION_COLUMN_BLOCK - 1) / ROTATION_COLUMN_BLOCK * ROTATION_COLUMN_BLOCK;
+    /*!
+     * Draw the shift of every function inside the middle 80% of the range, and its rotation unless the variant is only
+     * shifted.
+     */
+    for(int c = 0; c < numComponents(variant) && !failed; c++){
+        double* shift = instance->shifts[c] = alignedCalloc(instance->stride, sizeof(double)); /*!< The shift of the function*/
+        if(!shift){
+            failed = 1;
+            break;
+        }
+        counterRandDoubles(&key, (uint32_t)dimensions, (uint32_t)c, variantStream(c, ShiftStream), shift, dimensions, 0.1, 0.9);
+        for(int j = 0; j < dimensions; j++)
+            shift[j] = variant->lower + range * shift[j];
+        if(variant->kind != ShiftedVariant)
+            failed = !(instance->rotations[c] = drawRotation(&key, c, dimensions, instance->stride, uniforms));
+    }
+    /*!
+     * Shuffle the coordinates of a hybrid with Fisher-Yates and split them evenly into one group per function, the last
+     * group taking what is left over.
+     */
+    if(variant->kind == HybridVariant && !failed){
+        failed = !(instance->permutation = malloc(dimensions * sizeof(int)));
+        if(!failed){
+            counterRandDoubles(&key, (uint32_t)dimensions, 0, variantStream(0, PermutationStream), uniforms, dimensions, 0, 1);
+            for(int j = 0; j < dimensions; j++)
+                instance->permutation[j] = j;
+            for(int j = dimensions - 1; j > 0; j--){
+                int k = (int)(uniforms[j] * (j + 1)), /*!< The position swapped with j*/
+                temp;
+                if(k > j)
+                    k = j;
+                temp = instance->permutation[j];
+                instance->permutation[j] = instance->permutation[k];
+                instance->permutation[k] = temp;
+            }
+            for(int g = 0; g < variant->numFunctions; g++)
+                instance->groupStarts[g] = g * (dimensions / variant->numFunctions);
+            instance->groupStarts[variant->numFunctions] = dimensions;
+        }
+    }
+    free(uniforms);
+    return failed ? -1 : 0;
+}
+
+int registerVariant(const char* name, const char* kind, const int* bases, int numBases, double lower, double upper){
+    static const char* kinds[] = {"Shifted", "Rotated", "Hybrid", "Composition"}; /*!< The name of every kind, in VariantKind order*/
+    Variant* variant = &variants[numVariants]; /*!< The variant being registered*/
+    int k = 0; /*!< The VariantKind named*/
+    if(numVariants == MAX_NUM_VARIANTS){
+        printf("Too many objective variants were given. Please give at most %d and try again.\n", MAX_NUM_VARIANTS);
+        return -1;
+    }
+    while(k <= CompositionVariant && strcmp(kind, kinds[k]) != 0)
+        k++;
+    if(k > CompositionVariant){
+        printf("The objective variant %s has an unknown kind %s. Please use Shifted, Rotated, Hybrid or Composition and try again.\n", name, kind);
+        return -1;
+    }
+    if(k <= RotatedVariant ? numBases != 1 : numBases < 2 || numBases > VARIANT_MAX_FUNCTIONS){
+        if(k <= RotatedVariant)
+            printf("The objective variant %s needs exactly one function. Please check the input file and try again.\n", name);
+        else
+            printf("The objective variant %s needs between 2 and %d functions. Please check the input file and try again.\n", name, VARIANT_MAX_FUNCTIONS);
+        return -1;
+    }
+    if(!(lower < upper)){
+        printf("The objective variant %s needs a lower bound below its upper bound. Please check the input file and try again.\n", name);
+        return -1;
+    }
+    memset(variant, 0, sizeof(Variant));
+    for(int i = 0; i < numBases; i++){
+        if(bases[i] < 0 || bases[i] >= NUM_BUILTIN_EQUATIONS){
+            printf("The objective variant %s can only be built from the built in functions 0 to %d. Please check the input file and try again.\n", name, NUM_BUILTIN_EQUATIONS - 1);
+            return -1;
+        }
+        variant->bases[i] = bases[i];
+    }
+    variant->kind = k;
+    variant->numFunctions = numBases;
+    variant->lower = lower;
+    variant->upper = upper;
+    variantNames[numVariants] = malloc(strlen(name) + 1);
+    strcpy(variantNames[numVariants], name);
+    return FIRST_VARIANT_EQUATION + numVariants++;
+}
+
+int buildVariants(const int* dimsToTest, int numDimensions){
+    /*!
+     * Build every variant for every dimension to be tested, and if it is too large, too small for the groups of a
+     * hybrid or could not be allocated tell the user and return failure.
+     */
+    for(int v = 0; v < numVariants; v++){
+        Variant* variant = &variants[v]; /*!< The variant being built*/
+        variant->instances = calloc(numDimensions, sizeof(VariantInstance));
+        if(!variant->instances){
+            printf("The objective variant %s could not be allocated.\n", variantNames[v]);
+            return -1;
+        }
+        for(int i = 0; i < numDimensions; i++){
+            int dimensions = dimsToTest[i]; /*!< The dimension being built*/
+            if(dimensions > VARIANT_MAX_DIMENSIONS || (variant->kind == HybridVariant && dimensions < variant->numFunctions)){
+                printf("The objective variant %s cannot be built for %d dimensions. Please check the input file and try again.\n", variantNames[v], dimensions);
+                return -1;
+            }
+            if(buildInstance(variant, v, dimensions, &variant->instances[i]) < 0){
+                printf("The objective variant %s could not be allocated for %d dimensions.\n", variantNames[v], dimensions);
+                return -1;
+            }
+            variant->numInstances++;
+        }
+    }
+    return 0;
+}
+
+char* variantName(int equation){
+    return variantNames[equation - FIRST_VARIANT_EQUATION];
+}
+
+void variantRange(int equation, double* range){
+    range[RANGE_MIN_POS] = variants[equation - FIRST_VARIANT_EQUATION].lower;
+    range[RANGE_MAX_POS] = variants[equation - FIRST_VARIANT_EQUATION].upper;
+}
+
+Objective variantObjective(int equation, int dimensions){
+    int slot = equation - FIRST_VARIANT_EQUATION; /*!< The slot of the variant in the registry*/
+    Objective objective; /*!< Declare the functions of the run to be returned*/
+    objective.equation = equation;
+    objective.dimensions = dimensions;
+    objective.function = slotEvaluates[slot];
+    objective.anySize = objective.function;
+    objective.batch = NULL;
+    objective.rows = slotRows[slot];
+    objective.delta = NULL;
+    objective.gradient = NULL; ///refined with finite differences by src/Memetic.h
+    return objective;
+}
+
+void installVariantKernels(const void* kernel){
+    if(kernel)
+        variantRotation = kernel;
+    /*!
+     * Look up the kernel of every function of every instance at the size it is called with, a group of a hybrid or the
+     * whole vector otherwise.
+     */
+    for(int v = 0; v < numVariants; v++){
+        Variant* variant = &variants[v]; /*!< The variant being looked up*/
+        for(int i = 0; i < variant->numInstances; i++){
+            VariantInstance* instance = &variant->instances[i]; /*!< The instance being looked up*/
+            for(int f = 0; f < variant->numFunctions; f++){
+                int size = variant->kind == HybridVariant ? instance->groupStarts[f + 1] - instance->groupStarts[f] : instance->dimensions; /*!< The number of dimensions the function is called with*/
+                instance->functions[f] = resolveObjective(variant->bases[f], size).function;
+            }
+        }
+    }
+}
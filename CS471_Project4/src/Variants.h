@@ -0,0 +1,92 @@
+//
+// Created by Taylor Apple on 10/17/2026.
+//
+/*!
+ * \file Variants.h
+ * \brief This is where the shifted, rotated, hybrid and composition variants of the built in functions are registered.
+ *
+ *  Every variant named in the optional 'Objective Variants' line of the init file is built from built in functions in
+ *  the style of the CEC benchmark suites, where the optimum is moved away from the center of the range and the
+ *  coordinates are mixed so a function can no longer be solved one coordinate at a time.
+ *
+ *  - Shifted evaluates f(x - o).
+ *  - Rotated evaluates f(M(x - o)).
+ *  - Hybrid rotates x - o, permutes the coordinates and splits them into one group per function, adding the value of
+ *    every function on its group.
+ *  - Composition gives every function its own shift and rotation plus a bias of 100 per function, and weights them by
+ *    how close x is to the shift of each, so every function has its own basin with its optimum at its shift.
+ *
+ *  The shifts o, rotations M and permutations are not read from the CEC data files. They are drawn once for every
+ *  dimension to be tested while the init file is read, from the counter based generator of src/CounterRandom.h with a
+ *  key fixed by the position of the variant, so every run and every experiment sees the same instance. A variant takes
+ *  the next position from FIRST_VARIANT_EQUATION on, and variantObjective hands resolveObjective in src/Utilities.h a
+ *  function and a batch function for it, the batch function rotating all of the vectors of a batch with one
+ *  matrix-matrix product in the layout of src/Rotation.h.
+ */
+#ifndef TESTINGSUITE_VARIANTS_H
+#define TESTINGSUITE_VARIANTS_H
+
+#include "Utilities.h"
+
+#define VARIANT_MAX_FUNCTIONS 8 /*!< declare the constant for the most functions a hybrid or composition variant is built from*/
+#define VARIANT_MAX_DIMENSIONS 4096 /*!< declare the constant for the most dimensions a variant is built for*/
+
+/*!
+ * The kinds of variant, in the order of their names in the init file.
+ */
+enum VariantKind{
+    ShiftedVariant,
+    RotatedVariant,
+    HybridVariant,
+    CompositionVariant
+};
+
+/// \fn int registerVariant(const char* name, const char* kind, const int* bases, int numBases, double lower, double upper)
+/// \brief Registers a variant under name, after the formula slots and the variants registered before it. Its instances
+/// are built by buildVariants once the dimensions to be tested are known.
+///
+/// \param name - the name of the function, used in the output and the names of the result files
+/// \param kind - Shifted, Rotated, Hybrid or Composition
+/// \param bases - the EquationPosition of every built in function the variant is built from
+/// \param numBases - the number of functions, 1 for Shifted and Rotated and 2 to VARIANT_MAX_FUNCTIONS otherwise
+/// \param lower - the lowest value of every coordinate
+/// \param upper - the highest value of every coordinate
+/// \return the EquationPosition of the variant, or -1 if it could not be registered, having told the user why
+int registerVariant(const char* name, const char* kind, const int* bases, int numBases, double lower, double upper);
+/// \fn int buildVariants(const int* dimsToTest, int numDimensions)
+/// \brief Draws the shift, rotation and permutation of every variant registered for every dimension to be tested,
+/// called once the whole init file has been read.
+///
+/// \param dimsToTest - the dimensions to be tested
+/// \param numDimensions - the number of dimensions to be tested
+/// \return 0 for success, or -1 if a variant cannot be built for a dimension, having told the user why
+int buildVariants(const int* dimsToTest, int numDimensions);
+/// \fn char* variantName(int equation)
+/// \brief Returns the name a variant was registered under.
+///
+/// \param equation - the position of the variant, at least FIRST_VARIANT_EQUATION
+/// \return the name of the variant
+char* variantName(int equation);
+/// \fn void variantRange(int equation, double* range)
+/// \brief Stores the bounds a variant was registered with into a range.
+///
+/// \param equation - the position of the variant, at least FIRST_VARIANT_EQUATION
+/// \param range - the range, RANGE_SIZE values
+void variantRange(int equation, double* range);
+/// \fn Objective variantObjective(int equation, int dimensions)
+/// \brief Looks up the functions evaluating a variant at the size of one run, called by resolveObjective for every
+/// position from FIRST_VARIANT_EQUATION on.
+///
+/// \param equation - the position of the variant, at least FIRST_VARIANT_EQUATION
+/// \param dimensions - the number of dimensions of every vector of the run
+/// \return the functions of the run
+Objective variantObjective(int equation, int dimensions);
+/// \fn void installVariantKernels(const void* kernel)
+/// \brief Rotates with the kernel of an instruction set from rotationKernel in src/SimdEquations.h and looks up the
+/// kernels of the built in functions every variant is built from, called by installEquationKernels once the built in
+/// kernels are installed and before any threads are started.
+///
+/// \param kernel - a function with the signature of RotationKernel in src/Rotation.h, or NULL to keep the scalar kernel
+void installVariantKernels(const void* kernel);
+
+#endif //TESTINGSUITE_VARIANTS_H
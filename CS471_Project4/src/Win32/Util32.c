@@ -3,12 +3,13 @@
 //
 
 /*! \file Util32.c
- * \brief contains the implementations for the methods declared in src/Utilities.h which produce random numbers using a mutex in WIN332 format.
+ * \brief contains the implementations for the methods declared in src/Utilities.h which produce random numbers using a mutex, pin threads, open plugins and run the work pool in WIN332 format.
  *
  */
 
 #include "../src/Utilities.h"
 #include "../src/m19937ar-cok.h"
+#include "../src/Memetic.h"
 
 int genRandInt32(int modulo){
     int result = 0; /*!< Initialize the result*/
@@ -24,4 +25,232 @@ double genRandReal32(){
     result = genrand_real1(); ///generate a random real number with the method defined in ../src/m19937ar-cok.h
     ReleaseMutex(mutex);/// done accessing the random number generator
     return result; ///return the result
-}
\ No newline at end of file
+}
+void pinThread(int cpu){
+    if(cpu < 0)
+        return;
+    SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << (cpu % (8 * sizeof(DWORD_PTR)))); ///a failure leaves the thread unpinned, which only costs locality
+}
+
+int cpuCount(){
+    SYSTEM_INFO sysInfo; /*!< The system information holding the number of CPUs*/
+    GetSystemInfo(&sysInfo);
+    return sysInfo.dwNumberOfProcessors > 0 ? (int)sysInfo.dwNumberOfProcessors : 1;
+}
+
+size_t physicalMemoryBytes(){
+    MEMORYSTATUSEX status; /*!< The memory status holding the physical memory*/
+    status.dwLength = sizeof(status);
+    if(!GlobalMemoryStatusEx(&status))
+        return 0;
+    return (size_t)status.ullTotalPhys;
+}
+
+void* openLibrary(const char* path){
+    HMODULE library = LoadLibraryA(path); /*!< The loaded DLL*/
+    if(!library)
+        printf("LoadLibrary failed with error %lu\n", GetLastError());
+    return (void*)library;
+}
+
+void* librarySymbol(void* library, const char* name){
+    return (void*)GetProcAddress((HMODULE)library, name);
+}
+
+static SRWLOCK budgetLock = SRWLOCK_INIT; /*!< The lock guarding the memory in use by the running tasks*/
+static CONDITION_VARIABLE budgetFreed = CONDITION_VARIABLE_INIT; /*!< Woken whenever a task returns its memory*/
+static size_t budgetUsed = 0; /*!< The memory in use by the running tasks*/
+
+void acquireMemory(size_t bytes, size_t cap){
+    if(!cap)
+        return;
+    AcquireSRWLockExclusive(&budgetLock);
+    while(budgetUsed > 0 && budgetUsed + bytes > cap) ///wait for running tasks to finish until this one fits
+        SleepConditionVariableSRW(&budgetFreed, &budgetLock, INFINITE, 0);
+    budgetUsed += bytes;
+    ReleaseSRWLockExclusive(&budgetLock);
+}
+
+void releaseMemory(size_t bytes, size_t cap){
+    if(!cap)
+        return;
+    AcquireSRWLockExclusive(&budgetLock);
+    budgetUsed -= bytes;
+    WakeAllConditionVariable(&budgetFreed); ///every waiting task checks whether it fits now
+    ReleaseSRWLockExclusive(&budgetLock);
+}
+
+static SRWLOCK cutShortLock = SRWLOCK_INIT; /*!< The lock guarding the totals of the bounded evaluations*/
+static long cutShortEvaluations = 0, /*!< The bounded evaluations of every finished run*/
+cutShortCount = 0; /*!< The number of them which stopped early*/
+
+void recordCutShort(long evaluations, long cutShort){
+    AcquireSRWLockExclusive(&cutShortLock);
+    cutShortEvaluations += evaluations;
+    cutShortCount += cutShort;
+    ReleaseSRWLockExclusive(&cutShortLock);
+}
+
+void readCutShort(long* evaluations, long* cutShort){
+    AcquireSRWLockShared(&cutShortLock);
+    *evaluations = cutShortEvaluations;
+    *cutShort = cutShortCount;
+    ReleaseSRWLockShared(&cutShortLock);
+}
+
+static SRWLOCK heapLock = SRWLOCK_INIT; /*!< The lock guarding the total of the heap allocations*/
+static long heapAllocationTotal = 0; /*!< The heap allocations the iterations of every finished run made*/
+
+void recordHeapAllocations(long count){
+    AcquireSRWLockExclusive(&heapLock);
+    heapAllocationTotal += count;
+    ReleaseSRWLockExclusive(&heapLock);
+}
+
+void readHeapAllocations(long* count){
+    AcquireSRWLockShared(&heapLock);
+    *count = heapAllocationTotal;
+    ReleaseSRWLockShared(&heapLock);
+}
+
+static SRWLOCK cacheLock = SRWLOCK_INIT; /*!< The lock guarding the totals of the fitness caches*/
+static long cacheLookups = 0, /*!< The vectors looked up in the cache of every finished run*/
+cacheHits = 0; /*!< The number of them which were found*/
+
+void recordCacheHits(const FitnessCache* cache){
+    if(!cache)
+        return;
+    AcquireSRWLockExclusive(&cacheLock);
+    cacheLookups += cache->lookups;
+    cacheHits += cache->hits;
+    ReleaseSRWLockExclusive(&cacheLock);
+}
+
+void readCacheHits(long* lookups, long* hits){
+    AcquireSRWLockShared(&cacheLock);
+    *lookups = cacheLookups;
+    *hits = cacheHits;
+    ReleaseSRWLockShared(&cacheLock);
+}
+
+static SRWLOCK memeticLock = SRWLOCK_INIT; /*!< The lock guarding the totals of the memetic refinements*/
+static long memeticRefinements = 0, /*!< The refinements of every finished run*/
+memeticImproved = 0, /*!< The number of them which replaced the best vector*/
+memeticEvaluations = 0; /*!< The evaluations they made*/
+
+void recordRefinements(const Memetic* memetic){
+    if(!memetic)
+        return;
+    AcquireSRWLockExclusive(&memeticLock);
+    memeticRefinements += memetic->refinements;
+    memeticImproved += memetic->improved;
+    memeticEvaluations += memetic->evaluations;
+    ReleaseSRWLockExclusive(&memeticLock);
+}
+
+void readRefinements(long* refinements, long* improved, long* evaluations){
+    AcquireSRWLockShared(&memeticLock);
+    *refinements = memeticRefinements;
+    *improved = memeticImproved;
+    *evaluations = memeticEvaluations;
+    ReleaseSRWLockShared(&memeticLock);
+}
+
+/*!
+ * A call to parallelFor waiting in the queue of the work pool. It lives on the stack of the calling thread, which
+ * takes chunks of it as well and only returns once no chunk is unfinished.
+ */
+typedef struct _WorkJob{
+    ParallelBody body;
+    void* context;
+    int count;
+    int grain;
+    int next;
+    int unfinished;
+    struct _WorkJob* nextJob;
+}WorkJob;
+
+static SRWLOCK poolLock = SRWLOCK_INIT; /*!< The lock guarding the queue of the work pool*/
+static CONDITION_VARIABLE poolWork = CONDITION_VARIABLE_INIT; /*!< Woken whenever a job is queued*/
+static CONDITION_VARIABLE poolDone = CONDITION_VARIABLE_INIT; /*!< Woken whenever a job finishes its last chunk*/
+static WorkJob* poolJobs = NULL; /*!< The jobs with chunks left to take, oldest first*/
+static int poolWorkers = 0; /*!< The number of worker threads started*/
+
+static void takeChunk(WorkJob* job, int* begin, int* end){
+    *begin = job->next;
+    *end = job->next + job->grain < job->count ? job->next + job->grain : job->count;
+    job->next = *end;
+    if(job->next == job->count){ ///the last chunk is taken, so the job leaves the queue
+        WorkJob** link = &poolJobs;
+        while(*link != job)
+            link = &(*link)->nextJob;
+        *link = job->nextJob;
+    }
+}
+
+static void finishChunk(WorkJob* job, int begin, int end){
+    job->unfinished -= end - begin;
+    if(!job->unfinished)
+        WakeAllConditionVariable(&poolDone);
+}
+
+static DWORD WINAPI poolWorker(LPVOID unused){
+    (void)unused;
+    int begin, end;
+    AcquireSRWLockExclusive(&poolLock);
+    /*!
+     * Take chunks from the oldest job in the queue until the program exits, waiting whenever the queue is empty.
+     */
+    for(;;){
+        while(!poolJobs)
+            SleepConditionVariableSRW(&poolWork, &poolLock, INFINITE, 0);
+        WorkJob* job = poolJobs;
+        takeChunk(job, &begin, &end);
+        ReleaseSRWLockExclusive(&poolLock);
+        job->body(job->context, begin, end);
+        AcquireSRWLockExclusive(&poolLock);
+        finishChunk(job, begin, end);
+    }
+    return 0;
+}
+
+void startWorkPool(int threads){
+    /*!
+     * The thread calling parallelFor works on its own job, so one fewer worker is started than threads requested.
+     */
+    for(int i = poolWorkers; i < threads - 1; i++){
+        HANDLE thread = CreateThread(NULL, 0, poolWorker, NULL, 0, NULL);
+        if(!thread)
+            break; ///the pool runs with the workers it has, parallelFor still finishes every job on the calling thread
+        CloseHandle(thread);
+        poolWorkers++;
+    }
+}
+
+void parallelFor(int count, int grain, ParallelBody body, void* context){
+    int begin, end;
+    if(!poolWorkers || count <= grain){ ///too little work to share, run it all here
+        body(context, 0, count);
+        return;
+    }
+    WorkJob job = {body, context, count, grain, 0, count, NULL}, /*!< The job shared with the workers*/
+    **link = &poolJobs; /*!< The end of the queue*/
+    AcquireSRWLockExclusive(&poolLock);
+    while(*link)
+        link = &(*link)->nextJob;
+    *link = &job;
+    WakeAllConditionVariable(&poolWork);
+    /*!
+     * Work on the job alongside the workers, then wait for the chunks they took to finish.
+     */
+    while(job.next < job.count){
+        takeChunk(&job, &begin, &end);
+        ReleaseSRWLockExclusive(&poolLock);
+        body(context, begin, end);
+        AcquireSRWLockExclusive(&poolLock);
+        finishChunk(&job, begin, end);
+    }
+    while(job.unfinished)
+        SleepConditionVariableSRW(&poolDone, &poolLock, INFINITE, 0);
+    ReleaseSRWLockExclusive(&poolLock);
+}
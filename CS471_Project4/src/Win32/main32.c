@@ -11,6 +11,11 @@
 #include "../src/Utilities.h"
 #include "../src/Init.h"
 #include "../src/EquationHandlers.h"
+#include "../src/MemoryPlan.h"
+#include "../src/CpuFeatures.h"
+#include "../src/Memetic.h"
+#include <inttypes.h>
+#include <time.h>
 #include <process.h>
 #include <windows.h>
 
@@ -73,11 +78,7 @@ int main(int argc, char*argv[]) {
             FALSE,             /// initially not owned
             NULL);             /// unnamed
 
-    unsigned long seed = clock(); /*! < generating a value to seed the Mersenne Twister algorithm*/
-    /*!
-     * Seed the Mersenne Twister algorithm defined in src/m19937ar-cok.h
-     */
-    init_genrand(seed);
+    detectSimdLevel(); ///detect the SIMD instruction sets once before any threads are started
     /*!
      * Once the filename is set, process the init file, passing in the Info struct and the file name
      * to the init function of src/Init.h. The init method will print the subsequent errors and
@@ -87,6 +88,14 @@ int main(int argc, char*argv[]) {
         freeInfo(&progInfo);
         return -1;
     }
+    /*!
+     * If no seed line was provided generate the master seed from the clock. Print it so the run can be reproduced, then
+     * seed the Mersenne Twister algorithm defined in src/m19937ar-cok.h with it.
+     */
+    if(!progInfo.seedProvided)
+        progInfo.seed = ((uint64_t)time(NULL) << 32) ^ (uint64_t)clock();
+    printf("Master seed: %" PRIu64 "\n", progInfo.seed);
+    init_genrand((unsigned long)progInfo.seed);
 
     int numExp = progInfo.numExperiments,/*! < creating a local variable for the number of experiments to avoid accessing the struct multiple times*/
     numEq = progInfo.numEquations; /*! < creating a local variable for the number of equations to avoid accessing the struct multiple times*/
@@ -96,16 +105,34 @@ int main(int argc, char*argv[]) {
      */
     printMatrix(progInfo.ranges, numEq, RANGE_SIZE);
     printIArray(progInfo.dimsToTest, progInfo.numDimensions);
+    printMemoryPlan(&progInfo); ///plan the memory of every run before any of them start
+    installEquationKernels(progInfo.kernels); ///replace the objective functions with the selected kernels before any threads are started
+    startWorkPool(progInfo.batchThreads); ///start the workers every batch of vectors is shared with, none unless the batch threads line asks for them
     /*!
      * Create an array of Handles which is how threads are referenced in Win32 threads.
      * Iterate from 0 to (numExp - 1) and set the current experiment number to our iteration.
-     * Iterate from 0 to (numEq - 1) and start a thread for each equation handler from
+     * Iterate through the equations to be run and start a thread for each equation handler from
      * the constant defined above. Each thread will be passed a reference to the progInfo
      * struct. If it fails, print the error message, free progInfo, and return failure.
      */
-    HANDLE *threads = calloc(numEq, sizeof(HANDLE));
-    for (int i = 0; i < numEq; i++) {
-        if ((threads[i] = (HANDLE) _beginthread(equationHandlers[i], 0, &progInfo)) == NULL) {
+    HANDLE *threads = calloc(MAX_NUM_EQUATIONS, sizeof(HANDLE));
+    EquationRun *equationRuns = calloc(MAX_NUM_EQUATIONS - NUM_BUILTIN_EQUATIONS, sizeof(EquationRun)); /*!< The Info struct and position passed to the thread of every objective plugin, formula and variant*/
+    int numThreads = 0; /*!< The number of equation threads started*/
+    /*!
+     * The built in functions are followed by the objective plugins, formulas and variants, whose threads are passed their
+     * EquationRun. In replay mode only the replayed equation is run.
+     */
+    for (int i = 0; i < MAX_NUM_EQUATIONS; i++) {
+        if (progInfo.replay ? i != progInfo.replayEquation : !equationInRun(&progInfo, i))
+            continue;
+        const void* handler = i < NUM_BUILTIN_EQUATIONS ? equationHandlers[i] : i < FIRST_FORMULA_EQUATION ? (const void*)&pluginHandler : i < FIRST_VARIANT_EQUATION ? (const void*)&formulaHandler : (const void*)&variantHandler; /*!< The handler of the equation*/
+        void* argument = &progInfo; /*!< The struct passed to the handler*/
+        if (i >= NUM_BUILTIN_EQUATIONS) {
+            equationRuns[i - NUM_BUILTIN_EQUATIONS].data = &progInfo;
+            equationRuns[i - NUM_BUILTIN_EQUATIONS].equationPos = i;
+            argument = &equationRuns[i - NUM_BUILTIN_EQUATIONS];
+        }
+        if ((threads[numThreads++] = (HANDLE) _beginthread(handler, 0, argument)) == NULL) {
             fprintf(stderr, "There was an error creating the equation thread at position: %d\n", i);
             freeInfo(&progInfo);
             return -1;
@@ -114,17 +141,21 @@ int main(int argc, char*argv[]) {
     /*!
      * Wait for all the threads to finish, and if there was an error, print the last error and return failure.
      */
-    WaitForMultipleObjects(numEq, threads, TRUE, INFINITE);
+    WaitForMultipleObjects(numThreads, threads, TRUE, INFINITE);
     if (GetLastError() != 0) {
         printf("Error while waiting on equation threads: %lu\n", GetLastError());
         return -1;
     }
+    printCutShort();
+    printCacheHits();
+    printRefinements();
 
     /*!
      * The program has finished. Free progInfo and threads, and close the mutex handle then return success.
      */
     freeInfo(&progInfo);
     free(threads);
+    free(equationRuns);
     CloseHandle(mutex);
     return 0;
 }
\ No newline at end of file
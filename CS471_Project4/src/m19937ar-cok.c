@@ -44,9 +44,10 @@
 */
 
 #include <stdio.h>
+#include "m19937ar-cok.h"
 
 /* Period parameters */
-#define N 624
+#define N MT_STATE_SIZE
 #define M 397
 #define MATRIX_A 0x9908b0dfUL   /* constant vector a */
 #define UMASK 0x80000000UL /* most significant w-r bits */
@@ -54,15 +55,14 @@
 #define MIXBITS(u,v) ( ((u) & UMASK) | ((v) & LMASK) )
 #define TWIST(u,v) ((MIXBITS(u,v) >> 1) ^ ((v)&1UL ? MATRIX_A : 0UL))
 
-static unsigned long state[N]; /* the array for the state vector  */
-static int left = 1;
-static int initf = 0;
-static unsigned long *next;
+/* the generator shared by the non-reentrant interface below */
+static MTState global = { {0}, 1, 0, NULL };
 
 /* initializes state[N] with a seed */
-void init_genrand(unsigned long s)
+void init_genrand_r(MTState *mt, unsigned long s)
 {
     int j;
+    unsigned long *state = mt->state;
     state[0]= s & 0xffffffffUL;
     for (j=1; j<N; j++) {
         state[j] = (1812433253UL * (state[j-1] ^ (state[j-1] >> 30)) + j);
@@ -72,17 +72,18 @@ void init_genrand(unsigned long s)
         /* 2002/01/09 modified by Makoto Matsumoto             */
         state[j] &= 0xffffffffUL;  /* for >32 bit machines */
     }
-    left = 1; initf = 1;
+    mt->left = 1; mt->initf = 1;
 }
 
 /* initialize by an array with array-length */
 /* init_key is the array for initializing keys */
 /* key_length is its length */
 /* slight change for C++, 2004/2/26 */
-void init_by_array(unsigned long init_key[], int key_length)
+void init_by_array_r(MTState *mt, unsigned long init_key[], int key_length)
 {
     int i, j, k;
-    init_genrand(19650218UL);
+    unsigned long *state = mt->state;
+    init_genrand_r(mt, 19650218UL);
     i=1; j=0;
     k = (N>key_length ? N : key_length);
     for (; k; k--) {
@@ -102,20 +103,21 @@ void init_by_array(unsigned long init_key[], int key_length)
     }
 
     state[0] = 0x80000000UL; /* MSB is 1; assuring non-zero initial array */
-    left = 1; initf = 1;
+    mt->left = 1; mt->initf = 1;
 }
 
-static void next_state(void)
+static void next_state_r(MTState *mt)
 {
+    unsigned long *state = mt->state;
     unsigned long *p=state;
     int j;
 
     /* if init_genrand() has not been called, */
     /* a default initial seed is used         */
-    if (initf==0) init_genrand(5489UL);
+    if (mt->initf==0) init_genrand_r(mt, 5489UL);
 
-    left = N;
-    next = state;
+    mt->left = N;
+    mt->next = state;
 
     for (j=N-M+1; --j; p++)
         *p = p[M] ^ TWIST(p[0], p[1]);
@@ -127,12 +129,12 @@ static void next_state(void)
 }
 
 /* generates a random number on [0,0xffffffff]-interval */
-unsigned long genrand_int32(void)
+unsigned long genrand_int32_r(MTState *mt)
 {
     unsigned long y;
 
-    if (--left == 0) next_state();
-    y = *next++;
+    if (--mt->left == 0) next_state_r(mt);
+    y = *mt->next++;
 
     /* Tempering */
     y ^= (y >> 11);
@@ -143,74 +145,61 @@ unsigned long genrand_int32(void)
     return y;
 }
 
-/* generates a random number on [0,0x7fffffff]-interval */
-long genrand_int31(void)
+/* generates a random number on [0,1]-real-interval */
+double genrand_real1_r(MTState *mt)
 {
-    unsigned long y;
+    return (double)genrand_int32_r(mt) * (1.0/4294967295.0);
+    /* divided by 2^32-1 */
+}
 
-    if (--left == 0) next_state();
-    y = *next++;
+/* generates a random number on [0,1)-real-interval */
+double genrand_real2_r(MTState *mt)
+{
+    return (double)genrand_int32_r(mt) * (1.0/4294967296.0);
+    /* divided by 2^32 */
+}
 
-    /* Tempering */
-    y ^= (y >> 11);
-    y ^= (y << 7) & 0x9d2c5680UL;
-    y ^= (y << 15) & 0xefc60000UL;
-    y ^= (y >> 18);
+/* The non-reentrant interface below operates on the single shared generator. */
+/* Callers sharing it between threads must serialize access themselves.       */
 
-    return (long)(y>>1);
+void init_genrand(unsigned long s)
+{
+    init_genrand_r(&global, s);
 }
 
-/* generates a random number on [0,1]-real-interval */
-double genrand_real1(void)
+void init_by_array(unsigned long init_key[], int key_length)
 {
-    unsigned long y;
+    init_by_array_r(&global, init_key, key_length);
+}
 
-    if (--left == 0) next_state();
-    y = *next++;
+/* generates a random number on [0,0xffffffff]-interval */
+unsigned long genrand_int32(void)
+{
+    return genrand_int32_r(&global);
+}
 
-    /* Tempering */
-    y ^= (y >> 11);
-    y ^= (y << 7) & 0x9d2c5680UL;
-    y ^= (y << 15) & 0xefc60000UL;
-    y ^= (y >> 18);
+/* generates a random number on [0,0x7fffffff]-interval */
+long genrand_int31(void)
+{
+    return (long)(genrand_int32_r(&global)>>1);
+}
 
-    return (double)y * (1.0/4294967295.0);
-    /* divided by 2^32-1 */
+/* generates a random number on [0,1]-real-interval */
+double genrand_real1(void)
+{
+    return genrand_real1_r(&global);
 }
 
 /* generates a random number on [0,1)-real-interval */
 double genrand_real2(void)
 {
-    unsigned long y;
-
-    if (--left == 0) next_state();
-    y = *next++;
-
-    /* Tempering */
-    y ^= (y >> 11);
-    y ^= (y << 7) & 0x9d2c5680UL;
-    y ^= (y << 15) & 0xefc60000UL;
-    y ^= (y >> 18);
-
-    return (double)y * (1.0/4294967296.0);
-    /* divided by 2^32 */
+    return genrand_real2_r(&global);
 }
 
 /* generates a random number on (0,1)-real-interval */
 double genrand_real3(void)
 {
-    unsigned long y;
-
-    if (--left == 0) next_state();
-    y = *next++;
-
-    /* Tempering */
-    y ^= (y >> 11);
-    y ^= (y << 7) & 0x9d2c5680UL;
-    y ^= (y << 15) & 0xefc60000UL;
-    y ^= (y >> 18);
-
-    return ((double)y + 0.5) * (1.0/4294967296.0);
+    return ((double)genrand_int32_r(&global) + 0.5) * (1.0/4294967296.0);
     /* divided by 2^32 */
 }
 
@@ -221,4 +210,3 @@ double genrand_res53(void)
     return(a*67108864.0+b)*(1.0/9007199254740992.0);
 }
 /* These real versions are due to Isaku Wada, 2002/01/09 added */
-
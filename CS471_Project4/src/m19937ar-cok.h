@@ -5,9 +5,21 @@
 #ifndef TESTINGSUITE_M19937AR_COK_H
 #define TESTINGSUITE_M19937AR_COK_H
 
+#define MT_STATE_SIZE 624 /*!< declare the constant for the number of words in the Mersenne Twister state*/
+
+/*!
+ * The state of a single Mersenne Twister generator. Each thread owning one of these can draw random numbers
+ * through the *_r methods without any locking.
+ */
+typedef struct _MTState{
+    unsigned long state[MT_STATE_SIZE];
+    int left;
+    int initf;
+    unsigned long* next;
+}MTState;
+
 void init_genrand(unsigned long s);
 void init_by_array(unsigned long init_key[], int key_length);
-static void next_state(void);
 unsigned long genrand_int32(void);
 long genrand_int31(void);
 double genrand_real1(void);
@@ -15,5 +27,11 @@ double genrand_real2(void);
 double genrand_real3(void);
 double genrand_res53(void);
 
+void init_genrand_r(MTState* mt, unsigned long s);
+void init_by_array_r(MTState* mt, unsigned long init_key[], int key_length);
+unsigned long genrand_int32_r(MTState* mt);
+double genrand_real1_r(MTState* mt);
+double genrand_real2_r(MTState* mt);
+
 
 #endif //TESTINGSUITE_M19937AR_COK_H